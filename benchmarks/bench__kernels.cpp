@@ -0,0 +1,548 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : bench__kernels.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Microbenchmarks of the program's most frequently called
+//				 functions, each timed on fixed synthetic inputs
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//     *C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__file_io.h"
+#include "support__general.h"
+#include "support__bioinformatics.h"
+#include "uORF__compile.h"
+#include "uORF__process.h"
+#include "lbg_clustering.h"
+
+// Header file for the benchmark support classes
+#include "bench__support.h"
+
+
+
+// Sizes of the synthetic inputs
+#define BENCH_CHROM_LENGTH_NT			1000000		// Roughly the size of a mid-sized S. cerevisiae chromosome
+#define BENCH_NUM_INPUTS				1024		// Inputs are cycled through so that consecutive operations differ
+#define BENCH_EXTRACT_LENGTH_NT			1000
+#define BENCH_ORF_LENGTH_NT				999
+#define BENCH_NUM_GFF_GENES				500
+#define BENCH_AMI_SEQ_LENGTH_NT			20000
+#define BENCH_NUM_TRAINING_VECTORS		2000
+#define BENCH_CODEBOOK_SIZE				16
+#define BENCH_GO_TREE_DEPTH				8
+#define BENCH_GO_TREE_BRANCHING			3
+#define BENCH_NUM_CSV_ROWS				5000
+#define BENCH_NUM_CSV_COLUMNS			10
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+// Synthetic inputs, generated once by 'generate_benchmark_inputs()'
+static TPacked_Chrom Bench_Chrom;
+static vector <unsigned int> Bench_Coords;
+static vector <string> Bench_ORF_Seqs;
+static vector <vector <unsigned int> > Bench_ORF_Seqs_Numeric;
+static vector <string> Bench_Start_Contexts;
+static vector <string> Bench_CSV_Fields;
+
+static string Bench_GFF_Annotation;
+static vector <string> Bench_GFF_Gene_Names;
+static vector <bool> Bench_GFF_Gene_Strands;
+
+static string Bench_AMI_Seq;
+static vector <vector <double> > Bench_Joint_Prob_nt;
+static vector <double> Bench_Marginal_Prob_nt;
+
+static TContext_Profile_Matrix Bench_Training_Set;
+static float ** Bench_Codebook = NULL;
+static unsigned int Bench_Vector_Dimension = MAX_NUM_BASES_APART_CONTEXT - MIN_NUM_BASES_APART_CONTEXT + 1;
+
+static TGO_Annotation Bench_GO_Annotation( "biological_process" );
+static vector <string> Bench_GO_Leaf_Terms;
+
+static unsigned int Bench_Input_It = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Add a GO term and, recursively, its children, in the pre-order the hierarchy files list them (parents before children)
+static void add_bench_GO_subtree( const string & term_name, const string & parent_name, const unsigned int level )
+{
+	Bench_GO_Annotation.add_term( term_name, "IEA", level, parent_name );
+
+	if( level == BENCH_GO_TREE_DEPTH )
+	{
+		Bench_GO_Leaf_Terms.push_back( term_name );
+		return;
+	}
+
+	for( unsigned int child_it = 0; child_it < BENCH_GO_TREE_BRANCHING; child_it++ )
+	{
+		add_bench_GO_subtree( term_name + "." + get_str( child_it ), term_name, level + 1 );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Synthetic annotation for a single chromosome in the SGD .gff layout, alternating Watson and Crick genes
+static void generate_bench_GFF_annotation( TBenchmark_Random * const Random )
+{
+	ostringstream gff_oss;
+	unsigned int gene_spacing = BENCH_CHROM_LENGTH_NT / ( BENCH_NUM_GFF_GENES + 1 );
+
+	gff_oss << "chrI\tSGD\tchromosome\t1\t" << BENCH_CHROM_LENGTH_NT << "\t.\t.\t.\tID=chrI;dbxref=NCBI:NC_001133;Name=chrI\n";
+
+	for( unsigned int gene_it = 0; gene_it < BENCH_NUM_GFF_GENES; gene_it++ )
+	{
+		bool opposite_strand = ( gene_it % 2 == 1 );
+		unsigned int gene_start = ( gene_it + 1 ) * gene_spacing - Random->next_below( gene_spacing / 4 );
+		unsigned int gene_end 	= gene_start + 3 * ( 100 + Random->next_below( 200 ) ) - 1;
+
+		char gene_name[16];
+		sprintf( gene_name, "YBM%03d%c", gene_it, ( opposite_strand ? 'C' : 'W' ) );
+
+		Bench_GFF_Gene_Names.push_back( gene_name );
+		Bench_GFF_Gene_Strands.push_back( opposite_strand );
+
+		const char strand = ( opposite_strand ? '-' : '+' );
+
+		gff_oss << "chrI\tSGD\tgene\t" << gene_start << "\t" << gene_end << "\t.\t" << strand << "\t.\t"
+				<< "ID=" << gene_name << ";Name=" << gene_name << ";orf_classification=Verified\n"
+				<< "chrI\tSGD\tCDS\t"  << gene_start << "\t" << gene_end << "\t.\t" << strand << "\t0\t"
+				<< "Parent=" << gene_name << "_mRNA;Name=" << gene_name << "_CDS;orf_classification=Verified\n"
+				<< "chrI\tSGD\tmRNA\t" << gene_start << "\t" << gene_end << "\t.\t" << strand << "\t.\t"
+				<< "ID=" << gene_name << "_mRNA;Name=" << gene_name << "_mRNA;Parent=" << gene_name << "\n";
+	}
+
+	Bench_GFF_Annotation = gff_oss.str();
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+static void generate_benchmark_inputs( void )
+{
+	TBenchmark_Random Random;
+
+
+	// ------------------------------
+	// Sequences
+	Bench_Chrom = TPacked_Chrom( Random.next_DNA_seq( BENCH_CHROM_LENGTH_NT ) );
+
+	for( unsigned int i = 0; i < BENCH_NUM_INPUTS; i++ )
+	{
+		// 1-based coordinates at which both a Watson and a Crick extraction of 'BENCH_EXTRACT_LENGTH_NT' stay in range
+		Bench_Coords.push_back( BENCH_EXTRACT_LENGTH_NT + Random.next_below( BENCH_CHROM_LENGTH_NT - 2 * BENCH_EXTRACT_LENGTH_NT ) );
+
+		Bench_ORF_Seqs.push_back( "ATG" + Random.next_DNA_seq( BENCH_ORF_LENGTH_NT - 6, FALSE ) + "TAA" );
+		Bench_ORF_Seqs_Numeric.push_back( convert_DNA_string_to_num( Bench_ORF_Seqs.back() ) );
+
+		Bench_Start_Contexts.push_back( Random.next_DNA_seq( START_CONTEXT_NT_BEFORE_AUG ) + "ATG" +
+										Random.next_DNA_seq( START_CONTEXT_LENGTH_NT - START_CONTEXT_NT_BEFORE_AUG - 3 ) );
+	}
+
+	Bench_AMI_Seq = Random.next_DNA_seq( BENCH_AMI_SEQ_LENGTH_NT );
+	calc_joint_prob_nt_sequence( Bench_AMI_Seq, &Bench_Joint_Prob_nt, &Bench_Marginal_Prob_nt );
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// CSV fields, a mix of plain fields, fields needing quotes, and fields that would be read as formulas
+	for( unsigned int i = 0; i < BENCH_NUM_INPUTS; i++ )
+	{
+		switch( Random.next_below( 4 ) )
+		{
+			case 0 : Bench_CSV_Fields.push_back( Random.next_DNA_seq( 20 + Random.next_below( 40 ) ) );
+					 break;
+
+			case 1 : Bench_CSV_Fields.push_back( "GO:" + get_str( (unsigned int)Random.next_below( 100000 ) ) + ", GO:" + get_str( (unsigned int)Random.next_below( 100000 ) ) );
+					 break;
+
+			case 2 : Bench_CSV_Fields.push_back( "\"" + Random.next_DNA_seq( 8 ) + "\", with \"quotes\"" );
+					 break;
+
+			default: Bench_CSV_Fields.push_back( "-" + get_str( (unsigned int)Random.next_below( 1000 ) ) );
+					 break;
+		}
+	}
+
+	ostringstream csv_oss;
+	for( unsigned int row_it = 0; row_it < BENCH_NUM_CSV_ROWS; row_it++ )
+	{
+		for( unsigned int col_it = 0; col_it < BENCH_NUM_CSV_COLUMNS; col_it++ )
+		{
+			string field = ( row_it == 0 ? "Column " + get_str( col_it ) : Bench_CSV_Fields[ Random.next_below( Bench_CSV_Fields.size() ) ] );
+
+			csv_oss << format_csv_field_with_quotes( &field ) << ( col_it != BENCH_NUM_CSV_COLUMNS - 1 ? "," : "\n" );
+		}
+	}
+
+	if( write_file_contents( PATH_BENCHMARK_OUTPUT_FOLDER, BENCHMARK_INPUT_CSV_FILE_NAME, csv_oss.str(), TRUE ) )
+	{
+		Errors.handle_error( FATAL, "Error in 'generate_benchmark_inputs()': Benchmark input .csv could not be written. ", __FILE__, __LINE__ );
+	}
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Annotations
+	generate_bench_GFF_annotation( &Random );
+
+	add_bench_GO_subtree( "GO:0008150", "", 1 );
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Clustering training set (held as 'cluster_uORF_context_profiles()' holds it, for 'lbg_clustering()')
+	Bench_Training_Set.resize( BENCH_NUM_TRAINING_VECTORS, Bench_Vector_Dimension );
+
+	for( unsigned int i = 0; i < BENCH_NUM_TRAINING_VECTORS; i++ )
+	{
+		float * const training_vector = Bench_Training_Set.get_row( i );
+
+		for( unsigned int j = 0; j < Bench_Vector_Dimension; j++ )
+		{
+			training_vector[j] = (float)Random.next_below( 10000 ) / 10000.0f;
+		}
+	}
+
+	lbg_clustering( Bench_Vector_Dimension, BENCH_CODEBOOK_SIZE, BENCH_NUM_TRAINING_VECTORS, Bench_Training_Set.get_rows(), &Bench_Codebook );
+	// ------------------------------
+
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+static void free_benchmark_inputs( void )
+{
+	for( unsigned int i = 0; i < BENCH_CODEBOOK_SIZE; i++ ) { free( Bench_Codebook[i] ); }
+
+	free( Bench_Codebook );
+	Bench_Training_Set.resize( 0, 0 );
+
+	return;
+}
+//==============================================================================
+
+
+
+static unsigned long bench_parse_csv( void )
+{
+	TCSV_Contents Bench_CSV( PATH_BENCHMARK_OUTPUT_FOLDER, BENCHMARK_INPUT_CSV_FILE_NAME );
+	Bench_CSV.parse_csv();
+
+	return Bench_CSV.get_csv_row<string>( BENCH_NUM_CSV_ROWS ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_extract_DNA_seq( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	return extract_DNA_seq( Bench_Chrom, Bench_Coords[ Bench_Input_It ], BENCH_EXTRACT_LENGTH_NT, ( Bench_Input_It % 2 == 1 ) ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_convert_to_AA_seq( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	return convert_to_AA_seq( Bench_ORF_Seqs[ Bench_Input_It ] ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_convert_DNA_string_to_num( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	return convert_DNA_string_to_num( Bench_ORF_Seqs[ Bench_Input_It ] ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_convert_DNA_num_to_string( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	return convert_DNA_num_to_string( Bench_ORF_Seqs_Numeric[ Bench_Input_It ] ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_get_opposite_strand( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	return get_opposite_strand( Bench_ORF_Seqs[ Bench_Input_It ] ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_codon_histogram_add_sequence( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	TCodon_Histogram Codon_Histogram;
+
+	Codon_Histogram.add_sequence( Bench_ORF_Seqs[ Bench_Input_It ], 0, vector <unsigned int>( 1, 0 ) );
+
+	return Codon_Histogram.get_count( 0, 0, 0 );
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_find_first_stop_codon( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_INPUTS;
+
+	return find_first_stop_codon( Bench_Chrom, Bench_Coords[ Bench_Input_It ], ( Bench_Input_It % 2 == 1 ) );
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_get_gene_coord_from_gff( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % BENCH_NUM_GFF_GENES;
+
+	unsigned int gene_start_coord, gene_end_coord, gene_intergen_start_coord;
+	vector <TFeature> untransl_reg;
+	TFeature fpUTR_intron;
+
+	get_gene_coord_from_gff( Bench_GFF_Gene_Names[ Bench_Input_It ], Bench_GFF_Annotation, Bench_GFF_Gene_Strands[ Bench_Input_It ],
+							 &gene_start_coord, &gene_end_coord, &gene_intergen_start_coord, &untransl_reg, &fpUTR_intron );
+
+	return gene_start_coord + gene_intergen_start_coord;
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_calc_AUGCAI( void )
+{
+	TCalculate_AUGCAI Calculate_AUGCAI;
+	double AUGCAI_sum = 0;
+
+	for( unsigned int i = 0; i < BENCH_NUM_INPUTS; i++ )
+	{
+		AUGCAI_sum += Calculate_AUGCAI.calc( Bench_Start_Contexts[i] );
+	}
+
+	return (unsigned long)( AUGCAI_sum * 1000 );
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_calculate_AMI_profile( void )
+{
+	// 'calculate_AMI_profile()' only uses the probabilities, so an empty genome and ORF list suffice
+	TFasta_Content Empty_Chrom( "", "" );
+	vector <TORF_Data> Empty_ORF_Data;
+
+	return calculate_AMI_profile( Empty_Chrom, Empty_ORF_Data, Bench_Joint_Prob_nt, Bench_Marginal_Prob_nt ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_calc_joint_prob_nt_sequence( void )
+{
+	vector <vector <double> > joint_prob_nt;
+	vector <double> marginal_prob_nt;
+
+	calc_joint_prob_nt_sequence( Bench_AMI_Seq, &joint_prob_nt, &marginal_prob_nt );
+
+	return (unsigned long)( marginal_prob_nt[ NT_A ] * 1000 );
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_lbg_clustering( void )
+{
+	float ** codebook = NULL;
+
+	lbg_clustering( Bench_Vector_Dimension, BENCH_CODEBOOK_SIZE, BENCH_NUM_TRAINING_VECTORS, Bench_Training_Set.get_rows(), &codebook );
+
+	unsigned long result = (unsigned long)( codebook[0][0] * 1000 );
+
+	for( unsigned int i = 0; i < BENCH_CODEBOOK_SIZE; i++ ) { free( codebook[i] ); }
+	free( codebook );
+
+	return result;
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_fvqe( void )
+{
+	unsigned long cluster_sum = 0;
+	float distortion;
+
+	for( unsigned int i = 0; i < BENCH_NUM_TRAINING_VECTORS; i++ )
+	{
+		cluster_sum += fvqe( Bench_Training_Set.get_row( i ), Bench_Codebook, BENCH_CODEBOOK_SIZE, Bench_Vector_Dimension, &distortion );
+	}
+
+	return cluster_sum;
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_get_all_parents_of( void )
+{
+	Bench_Input_It = ( Bench_Input_It + 1 ) % Bench_GO_Leaf_Terms.size();
+
+	return get_all_parents_of( Bench_GO_Leaf_Terms[ Bench_Input_It ], Bench_GO_Annotation ).size();
+}
+//------------------------------------------------------------------------------
+
+
+static unsigned long bench_format_csv_field_with_quotes( void )
+{
+	unsigned long formatted_len = 0;
+
+	for( unsigned int i = 0; i < BENCH_NUM_INPUTS; i++ )
+	{
+		string field = Bench_CSV_Fields[i];
+		formatted_len += format_csv_field_with_quotes( &field ).size();
+	}
+
+	return formatted_len;
+}
+//==============================================================================
+
+
+
+// Time each kernel and write the results to PATH_BENCHMARK_OUTPUT_FOLDER
+int run_kernel_benchmarks( void )
+{
+	output_text_line( "Generating benchmark inputs..." );
+
+
+	// Some kernels (and the input generation) report progress as they go; only warnings and errors are shown until
+	//   the kernels have been timed
+	unsigned int prev_min_log_level = Log_Backend.get_min_log_level();
+	Log_Backend.set_min_log_level( LOG_LEVEL_WARNING );
+
+	generate_benchmark_inputs();
+
+
+	double CSV_bytes = 0;
+	{
+		string csv_buf;
+		read_entire_file_contents( PATH_BENCHMARK_OUTPUT_FOLDER, BENCHMARK_INPUT_CSV_FILE_NAME, &csv_buf );
+		CSV_bytes = csv_buf.size();
+	}
+
+	double CSV_field_bytes = 0;
+	for( unsigned int i = 0; i < BENCH_NUM_INPUTS; i++ ) { CSV_field_bytes += Bench_CSV_Fields[i].size(); }
+
+
+	TBenchmark_Suite Kernel_Suite( "uORF kernels" );
+
+	Kernel_Suite.run( "parse_csv", 						  bench_parse_csv, 						BENCH_NUM_CSV_ROWS, 	   			CSV_bytes 				);
+	Kernel_Suite.run( "extract_DNA_seq", 				  bench_extract_DNA_seq, 				1, 								BENCH_EXTRACT_LENGTH_NT );
+	Kernel_Suite.run( "convert_to_AA_seq", 				  bench_convert_to_AA_seq, 				BENCH_ORF_LENGTH_NT / 3, 		BENCH_ORF_LENGTH_NT 	);
+	Kernel_Suite.run( "convert_DNA_string_to_num", 		  bench_convert_DNA_string_to_num, 		BENCH_ORF_LENGTH_NT, 			BENCH_ORF_LENGTH_NT 	);
+	Kernel_Suite.run( "convert_DNA_num_to_string", 		  bench_convert_DNA_num_to_string, 		BENCH_ORF_LENGTH_NT, 			BENCH_ORF_LENGTH_NT 	);
+	Kernel_Suite.run( "get_opposite_strand", 			  bench_get_opposite_strand, 			BENCH_ORF_LENGTH_NT, 			BENCH_ORF_LENGTH_NT 	);
+	Kernel_Suite.run( "TCodon_Histogram::add_sequence", 	  bench_codon_histogram_add_sequence, 	BENCH_ORF_LENGTH_NT, 			BENCH_ORF_LENGTH_NT 	);
+	Kernel_Suite.run( "find_first_stop_codon", 			  bench_find_first_stop_codon, 			1 														);
+	Kernel_Suite.run( "get_gene_coord_from_gff", 		  bench_get_gene_coord_from_gff, 		1 														);
+	Kernel_Suite.run( "TCalculate_AUGCAI::calc", 		  bench_calc_AUGCAI, 					BENCH_NUM_INPUTS, 		   		BENCH_NUM_INPUTS * START_CONTEXT_LENGTH_NT );
+	Kernel_Suite.run( "calculate_AMI_profile", 			  bench_calculate_AMI_profile, 			MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1 			);
+	Kernel_Suite.run( "calc_joint_prob_nt_sequence", 	  bench_calc_joint_prob_nt_sequence, 	BENCH_AMI_SEQ_LENGTH_NT, 		BENCH_AMI_SEQ_LENGTH_NT );
+	Kernel_Suite.run( "lbg_clustering", 				  bench_lbg_clustering, 				BENCH_NUM_TRAINING_VECTORS 								);
+	Kernel_Suite.run( "fvqe", 							  bench_fvqe, 							BENCH_NUM_TRAINING_VECTORS 								);
+	Kernel_Suite.run( "get_all_parents_of", 			  bench_get_all_parents_of, 			BENCH_GO_TREE_DEPTH - 1 								);
+	Kernel_Suite.run( "format_csv_field_with_quotes", 	  bench_format_csv_field_with_quotes, 	BENCH_NUM_INPUTS, 		   		CSV_field_bytes 		);
+
+	Log_Backend.set_min_log_level( prev_min_log_level );
+
+
+	Kernel_Suite.print_results();
+
+	free_benchmark_inputs();
+
+	return Kernel_Suite.write_results_to_json( PATH_BENCHMARK_OUTPUT_FOLDER, KERNEL_BENCHMARK_FILE_NAME_SUFFIX );
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : bench__main.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : 'main()' for the "Benchmarks" build configuration, which is
+//				 built from the same sources as the program except "main.cpp"
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//		C. Main
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+#include "version.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+
+// Header file for the benchmark support classes
+#include "bench__support.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+TProgram_Log Program_Log;
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Main
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+int main()
+{
+	int benchmark_result = SUCCESSFUL;
+
+
+	// ------------------------------
+	// Time the individual kernels on synthetic inputs
+	if( run_kernel_benchmarks() )
+	{
+		benchmark_result = NOT_SUCCESSFUL;
+	}
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Time each stage of the pipeline on synthetic datasets of increasing size
+	if( run_pipeline_benchmarks() )
+	{
+		benchmark_result = NOT_SUCCESSFUL;
+	}
+	// ------------------------------
+
+
+	return Program_Log.print_log_to_file( PATH_PROGRAM_LOG_FOLDER, uORF_APPL_VERSION_NUMBER, benchmark_result );
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
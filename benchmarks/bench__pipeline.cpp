@@ -0,0 +1,256 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : bench__pipeline.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to time each stage of the program's main flow on
+//				 synthetic datasets of increasing size
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//     *C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <unistd.h>		// For "chdir()" and "getcwd()"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__file_io.h"
+#include "support__general.h"
+#include "support__profiling.h"
+#include "uORF__compile.h"
+#include "uORF__process.h"
+
+// Header file for the benchmark support classes
+#include "bench__support.h"
+
+
+
+#define BENCH_MAX_PATH_LENGTH			4096
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Record a stage started at 'start_wall_us' / 'start_cpu_ms'.  Each stage is run once, so wall time, CPU time, and
+//   the memory high-water mark are all recorded
+static void record_stage( TBenchmark_Suite * const Pipeline_Suite,
+						  const string & stage_name,
+						  const unsigned int scale,
+						  const double start_wall_us,
+						  const double start_cpu_ms,
+						  const double items,
+						  const double bytes = 0 )
+{
+	TBenchmark_Result result( stage_name + " [" + get_str( scale ) + "x]" );
+
+	result.iterations 	 = 1;
+	result.ns_per_op 	 = ( get_wall_time_us() - start_wall_us ) * 1000.0;
+	result.min_ns_per_op = result.ns_per_op;
+	result.cpu_ns_per_op = ( get_process_cpu_time_ms() - start_cpu_ms ) * 1e6;
+	result.items_per_op  = items;
+	result.bytes_per_op  = bytes;
+	result.peak_rss_kb 	 = get_peak_rss_kb();
+
+	Pipeline_Suite->add_result( result );
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Generate a dataset 'scale' times the size of the S. cerevisiae genome and time each stage of 'main()' on it.  All of
+//   the program's paths are relative, so the dataset is written (and read) around a working directory of its own
+static int run_pipeline_at_scale( const unsigned int scale, TBenchmark_Suite * const Pipeline_Suite )
+{
+	double start_wall_us = 0;
+	double start_cpu_ms  = 0;
+
+
+	// ------------------------------
+	// Synthetic dataset
+	start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+
+	if( generate_synthetic_dataset( (unsigned long)SYNTHETIC_GENOME_SIZE_NT * scale, SYNTHETIC_NUM_GENES * scale, SYNTHETIC_uORF_GENE_PERCENT, SYNTHETIC_MAX_uORFs_PER_GENE ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'run_pipeline_at_scale()': ", __FILE__, __LINE__ );
+	}
+
+	record_stage( Pipeline_Suite, "generate_synthetic_dataset", scale, start_wall_us, start_cpu_ms, SYNTHETIC_NUM_GENES * scale );
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// The stages of 'main()', in order
+	start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+
+	TFasta_Content * S_Cerevisiae_Chrom = new TFasta_Content( PATH_S_CEREVISIA_FASTA_FOLDER, S_CEREVISIAE_GFF_FILE_NAME );
+
+	if( S_Cerevisiae_Chrom->get_contents_from_gff() )
+	{
+		delete S_Cerevisiae_Chrom;
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'run_pipeline_at_scale()': ", __FILE__, __LINE__ );
+	}
+
+	double genome_nt = 0;
+	for( unsigned int i = 0; i < S_Cerevisiae_Chrom->sequence.size(); i++ ) { genome_nt += S_Cerevisiae_Chrom->sequence[i].size(); }
+
+	record_stage( Pipeline_Suite, "get_contents_from_gff", scale, start_wall_us, start_cpu_ms, genome_nt, genome_nt );
+
+
+	vector <TORF_Data> * ORF_Data = new vector <TORF_Data>;
+
+	start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+	compile_uORF_list( *S_Cerevisiae_Chrom, ORF_Data );
+	record_stage( Pipeline_Suite, "compile_uORF_list", scale, start_wall_us, start_cpu_ms, ORF_Data->size() );
+
+	start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+	sort_and_consolidate( ORF_Data );
+	record_stage( Pipeline_Suite, "sort_and_consolidate", scale, start_wall_us, start_cpu_ms, ORF_Data->size() );
+
+	start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+	determine_ORF_and_uORF_characteristics( *S_Cerevisiae_Chrom, ORF_Data );
+	record_stage( Pipeline_Suite, "determine_ORF_and_uORF_characteristics", scale, start_wall_us, start_cpu_ms, ORF_Data->size() );
+
+	start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+	write_uORFs_to_csv( *ORF_Data, uORF_COLUMN_SELECTION_TYPE, uORFs_TO_PRINT, OUTPUT_FILE_NAMING_METHOD );
+	record_stage( Pipeline_Suite, "write_uORFs_to_csv", scale, start_wall_us, start_cpu_ms, ORF_Data->size() );
+
+	#ifdef WRITE_GENE_AND_uORFs_TO_FASTA
+		start_wall_us = get_wall_time_us();  start_cpu_ms = get_process_cpu_time_ms();
+		write_sequences_to_fasta( *ORF_Data );
+		record_stage( Pipeline_Suite, "write_sequences_to_fasta", scale, start_wall_us, start_cpu_ms, ORF_Data->size() );
+	#endif
+	// ------------------------------
+
+
+	delete ORF_Data;
+	delete S_Cerevisiae_Chrom;
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// Time each stage of the program at each of 'BENCHMARK_PIPELINE_SCALES' and write the results to
+//   PATH_BENCHMARK_OUTPUT_FOLDER.  Each scale's dataset (and output) is left in its own folder there for inspection
+int run_pipeline_benchmarks( void )
+{
+	const unsigned int scales[] = { BENCHMARK_PIPELINE_SCALES };
+	const unsigned int num_scales = sizeof( scales ) / sizeof( unsigned int );
+
+	char orig_working_dir[BENCH_MAX_PATH_LENGTH];
+	if( getcwd( orig_working_dir, BENCH_MAX_PATH_LENGTH ) == NULL )
+	{
+		return Errors.handle_error( NONFATAL, "Error in 'run_pipeline_benchmarks()': Could not get the working directory. ", __FILE__, __LINE__ );
+	}
+
+
+	// The stages report progress as they go; only warnings and errors are shown until the stages have been timed
+	unsigned int prev_min_log_level = Log_Backend.get_min_log_level();
+	Log_Backend.set_min_log_level( LOG_LEVEL_WARNING );
+
+	TBenchmark_Suite Pipeline_Suite( "uORF pipeline stages" );
+	int pipeline_result = SUCCESSFUL;
+
+	for( unsigned int scale_it = 0; scale_it < num_scales && pipeline_result == SUCCESSFUL; scale_it++ )
+	{
+		output_text_line( "Timing the pipeline on a synthetic dataset at " + get_str( scales[scale_it] ) + "x scale..." );
+
+		// The relative paths ("..\\data", etc.) all resolve within 'scale_folder'
+		const string scale_folder   = (string)PATH_BENCHMARK_OUTPUT_FOLDER + PATH_FOLDER_SEPARATOR + "pipeline_" + get_str( scales[scale_it] ) + "x";
+		const string working_folder = scale_folder + PATH_FOLDER_SEPARATOR + "run";
+
+		if( create_folder( working_folder ) || chdir( working_folder.c_str() ) != 0 )
+		{
+			pipeline_result = Errors.handle_error( NONFATAL, "Error in 'run_pipeline_benchmarks()': Could not enter '" + working_folder + "'. ", __FILE__, __LINE__ );
+			break;
+		}
+
+		pipeline_result = run_pipeline_at_scale( scales[scale_it], &Pipeline_Suite );
+
+		if( chdir( orig_working_dir ) != 0 )
+		{
+			Errors.handle_error( FATAL, "Error in 'run_pipeline_benchmarks()': Could not return to the original working directory. ", __FILE__, __LINE__ );
+		}
+	}
+
+	Log_Backend.set_min_log_level( prev_min_log_level );
+
+
+	Pipeline_Suite.print_results();
+
+	if( Pipeline_Suite.write_results_to_json( PATH_BENCHMARK_OUTPUT_FOLDER, PIPELINE_BENCHMARK_FILE_NAME_SUFFIX ) || pipeline_result != SUCCESSFUL )
+	{
+		return Errors.handle_error( NONFATAL, "Error in 'run_pipeline_benchmarks()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,280 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : bench__support.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to time kernels and pipeline stages on synthetic
+//				 inputs and write the results to a .json file
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//     *D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>   	// For sort()
+#include <iomanip>      // For "setprecision()" and "fixed"
+#include <time.h>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+#include "version.h"
+
+// Project-specific header files:  support functions and related
+#include "support__file_io.h"
+#include "support__general.h"
+#include "support__profiling.h"
+
+// Header file for this file
+#include "bench__support.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+unsigned long TBenchmark_Random::next( void )
+{
+	// Knuth's MMIX constants; the upper bits have the longest period, so those are returned
+	state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+	return (unsigned long)( state >> 33 );
+}
+//------------------------------------------------------------------------------
+
+
+unsigned long TBenchmark_Random::next_below( const unsigned long upper_bound )
+{
+	if( upper_bound == 0 ) { return 0; }
+
+	return next() % upper_bound;
+}
+//------------------------------------------------------------------------------
+
+
+char TBenchmark_Random::next_nt( void )
+{
+	const char nucleotides[] = { 'A', 'C', 'G', 'T' };
+
+	return nucleotides[ next() & 0x3 ];
+}
+//------------------------------------------------------------------------------
+
+
+// Random DNA sequence.  If stop codons aren't allowed, the sequence is built a codon at a time (in frame from its first
+//   nucleotide), redrawing any stop codon, so it can serve as the body of an ORF
+string TBenchmark_Random::next_DNA_seq( const unsigned int len, const bool allow_stop_codons )
+{
+	string DNA_seq( len, 'A' );
+
+	for( unsigned int i = 0; i < len; i++ )
+	{
+		DNA_seq[i] = next_nt();
+
+		if( allow_stop_codons == FALSE && i % 3 == 2 )
+		{
+			string codon = DNA_seq.substr( i - 2, 3 );
+
+			while( codon == "TAA" || codon == "TAG" || codon == "TGA" )
+			{
+				codon[2] = DNA_seq[i] = next_nt();
+				codon[1] = DNA_seq[i - 1] = next_nt();
+			}
+		}
+	}
+
+	return DNA_seq;
+}
+//==============================================================================
+
+
+
+void TBenchmark_Suite::run( const string & kernel_name, TBenchmark_Kernel kernel, const double items_per_op, const double bytes_per_op )
+{
+	TBenchmark_Result result( kernel_name );
+	result.items_per_op = items_per_op;
+	result.bytes_per_op = bytes_per_op;
+
+
+	// ------------------------------
+	// Warm up (first touch of the inputs, static tables), then find the number of iterations per batch
+	sink += kernel();
+
+	unsigned long iterations = 1;
+	double batch_time_us = 0;
+
+	while( TRUE )
+	{
+		double start_us = get_wall_time_us();
+		for( unsigned long i = 0; i < iterations; i++ ) { sink += kernel(); }
+		batch_time_us = get_wall_time_us() - start_us;
+
+		if( batch_time_us >= BENCHMARK_MIN_BATCH_TIME_MS * 1000.0 ) { break; }
+
+		iterations *= 2;
+	}
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Time the batches
+	vector <double> batch_ns_per_op( BENCHMARK_NUM_BATCHES, 0 );
+
+	for( unsigned int batch_it = 0; batch_it < batch_ns_per_op.size(); batch_it++ )
+	{
+		double start_us = get_wall_time_us();
+		for( unsigned long i = 0; i < iterations; i++ ) { sink += kernel(); }
+
+		batch_ns_per_op[batch_it] = ( get_wall_time_us() - start_us ) * 1000.0 / iterations;
+	}
+
+	sort( batch_ns_per_op.begin(), batch_ns_per_op.end() );
+
+	result.iterations 	 = iterations;
+	result.ns_per_op  	 = batch_ns_per_op[ batch_ns_per_op.size() / 2 ];
+	result.min_ns_per_op = batch_ns_per_op[0];
+	// ------------------------------
+
+
+	results.push_back( result );
+	batched = TRUE;
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TBenchmark_Suite::print_results( void ) const
+{
+	ostringstream results_oss;
+	results_oss << fixed << setprecision( 1 );
+
+	results_oss << "\n" << suite_name;
+
+	if( batched == TRUE ) { results_oss << " (" << BENCHMARK_NUM_BATCHES << " batches of at least " << BENCHMARK_MIN_BATCH_TIME_MS << " ms each)"; }
+
+	results_oss << "\n";
+
+	for( unsigned int i = 0; i < results.size(); i++ )
+	{
+		results_oss << "  " << left << setw( 40 ) << results[i].name << right
+					<< setw( 14 ) << results[i].ns_per_op << " ns/op"
+					<< setw( 16 ) << results[i].get_items_per_sec() << " items/s";
+
+		if( results[i].bytes_per_op > 0 ) { results_oss << setw( 10 ) << results[i].get_MB_per_sec() << " MB/s"; }
+		if( results[i].peak_rss_kb  > 0 ) { results_oss << setw( 12 ) << results[i].peak_rss_kb / 1024.0 << " MB peak RSS"; }
+
+		results_oss << "\n";
+	}
+
+	output_text_line( results_oss.str() );
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+int TBenchmark_Suite::write_results_to_json( const string & path_results, const string & file_name_suffix ) const
+{
+	ostringstream json_oss;
+	json_oss << fixed << setprecision( 3 );
+
+	json_oss << "{\n"
+			 << "\"suite\":\"" 				   << format_json_string( suite_name ) << "\",\n"
+			 << "\"version\":\"" 			   << uORF_APPL_VERSION_NUMBER 		  << "\",\n"
+			 << "\"date_time\":\"" 			   << format_system_date_time_filesystem_safe( time( NULL ) ) << "\",\n"
+			 << "\"min_batch_time_ms\":" 	   << BENCHMARK_MIN_BATCH_TIME_MS 	  << ",\n"
+			 << "\"num_batches\":" 			   << BENCHMARK_NUM_BATCHES 		  << ",\n"
+			 << "\"results\":[\n";
+
+	for( unsigned int i = 0; i < results.size(); i++ )
+	{
+		json_oss << "{\"name\":\"" 		   << format_json_string( results[i].name ) << "\","
+				 << "\"iterations\":" 	   << results[i].iterations 		 << ","
+				 << "\"ns_per_op\":" 	   << results[i].ns_per_op 			 << ","
+				 << "\"min_ns_per_op\":"   << results[i].min_ns_per_op 		 << ","
+				 << "\"items_per_op\":"    << results[i].items_per_op 		 << ","
+				 << "\"items_per_sec\":"   << results[i].get_items_per_sec() << ","
+				 << "\"bytes_per_op\":"    << results[i].bytes_per_op 		 << ","
+				 << "\"MB_per_sec\":" 	   << results[i].get_MB_per_sec() 	 << ","
+				 << "\"cpu_ns_per_op\":"   << results[i].cpu_ns_per_op 		 << ","
+				 << "\"peak_rss_kb\":" 	   << results[i].peak_rss_kb 		 << "}"
+				 << ( i != results.size() - 1 ? ",\n" : "\n" );
+	}
+
+	json_oss << "]}\n";
+
+
+	// Named by date and time so that successive runs can be compared
+	string file_name = format_system_date_time_filesystem_safe( time( NULL ) ) + file_name_suffix + JSON_FILE_EXTENSION;
+
+	if( write_file_contents( path_results, file_name, json_oss.str(), TRUE ) )
+	{
+		return Errors.handle_error( NONFATAL, (string)"Error in 'TBenchmark_Suite::write_results_to_json()': Results file could not be written. ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,221 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : bench__support.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the classes used to time kernels and
+//				 pipeline stages on synthetic inputs and write the results to a
+//				 .json file
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _BENCH__SUPPORT_H_
+#define _BENCH__SUPPORT_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// A kernel performs one operation on its (file-scope) synthetic inputs and returns a value derived from the result,
+//   which is accumulated so that the compiler can't discard the work
+typedef unsigned long ( *TBenchmark_Kernel )( void );
+//==============================================================================
+
+
+
+// Deterministic pseudo-random generator for synthetic inputs (a 64-bit LCG; the same seed always yields the same data)
+class TBenchmark_Random
+{
+	private:
+		unsigned long long state;
+
+	public:
+		unsigned long next( void );
+		unsigned long next_below( const unsigned long upper_bound );
+
+		char next_nt( void );
+		std::string next_DNA_seq( const unsigned int len, const bool allow_stop_codons = TRUE );
+
+		TBenchmark_Random( const unsigned long long seed = BENCHMARK_RANDOM_SEED ) : state( seed ) { }
+};
+//==============================================================================
+
+
+
+class TBenchmark_Result
+{
+	public:
+		std::string name;
+		unsigned long iterations;		// Iterations in each timed batch
+		double ns_per_op;				// Median over the timed batches
+		double min_ns_per_op;
+		double items_per_op;			// E.g. codons translated, rows parsed
+		double bytes_per_op;			// Input bytes processed (0 if not meaningful for the kernel)
+		double cpu_ns_per_op;			// Only recorded for single runs (see 'TBenchmark_Suite::add_result()')
+		unsigned long peak_rss_kb;		// Process high-water mark after the run (0 if not recorded)
+
+		double get_items_per_sec( void ) const { return ( ns_per_op > 0 ? items_per_op * 1e9 / ns_per_op : 0 ); }
+		double get_MB_per_sec   ( void ) const { return ( ns_per_op > 0 ? bytes_per_op * 1e3 / ns_per_op : 0 ); }
+
+		TBenchmark_Result( const std::string & kernel_name ) :
+			name( kernel_name ),
+			iterations( 0 ),
+			ns_per_op( 0 ),
+			min_ns_per_op( 0 ),
+			items_per_op( 0 ),
+			bytes_per_op( 0 ),
+			cpu_ns_per_op( 0 ),
+			peak_rss_kb( 0 )
+		{ }
+};
+//==============================================================================
+
+
+
+// Times each kernel in batches, doubling the iterations per batch until a batch takes at least
+//   'BENCHMARK_MIN_BATCH_TIME_MS', then reports the median of 'BENCHMARK_NUM_BATCHES' batches.  Operations too long to
+//   repeat (e.g. whole pipeline stages) are timed by the caller and recorded with 'add_result()'
+class TBenchmark_Suite
+{
+	private:
+		std::string suite_name;
+		std::vector <TBenchmark_Result> results;
+		unsigned long sink;
+		bool batched;
+
+	public:
+		void run( const std::string & kernel_name, TBenchmark_Kernel kernel, const double items_per_op, const double bytes_per_op = 0 );
+		void add_result( const TBenchmark_Result & result ) { results.push_back( result ); }
+
+		void print_results( void ) const;
+		int write_results_to_json( const std::string & path_results, const std::string & file_name_suffix ) const;
+
+		TBenchmark_Suite( const std::string & name ) :
+			suite_name( name ),
+			results( 0, TBenchmark_Result( "" ) ),
+			sink( 0 ),
+			batched( FALSE )
+		{ }
+};
+//==============================================================================
+
+
+
+// A uORF planted in a synthetic 5' UTR
+class TSynthetic_uORF
+{
+	public:
+		int rel_pos;					// Relative to the 'A' of the gene's start codon
+		unsigned int length;			// Nucleotides, including the stop codon
+		std::string sequence;
+		std::string start_context;
+		double AUGCAI;
+		unsigned int sources;			// 'SYNTHETIC_SOURCE_...' flags of the source tables the uORF is listed in
+
+		TSynthetic_uORF( ) : rel_pos( 0 ), length( 0 ), AUGCAI( 0 ), sources( 0 ) { }
+};
+//==============================================================================
+
+
+
+// A gene of the synthetic genome.  Each gene has a single CDS (no introns) and a single transcript, starting at
+//   'tss_coord', whose 5' UTR contains no 'ATG' other than the start codons of its uORFs
+class TSynthetic_Gene
+{
+	public:
+		std::string name;
+		unsigned int chrom_num;
+		bool opposite_strand;
+		unsigned int CDS_start_coord;	// Coordinate of the 'A' of the start codon
+		unsigned int CDS_length;
+		unsigned int tss_coord;
+		std::string five_prime_UTR;
+		std::vector <TSynthetic_uORF> uORFs;
+
+		unsigned int get_CDS_low_coord ( void ) const { return ( opposite_strand ? CDS_start_coord - CDS_length + 1 : CDS_start_coord ); }
+		unsigned int get_CDS_high_coord( void ) const { return ( opposite_strand ? CDS_start_coord : CDS_start_coord + CDS_length - 1 ); }
+
+		TSynthetic_Gene( ) : chrom_num( 0 ), opposite_strand( FALSE ), CDS_start_coord( 0 ), CDS_length( 0 ), tss_coord( 0 ) { }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int run_kernel_benchmarks( void );
+
+int generate_synthetic_dataset( const unsigned long genome_size_nt,
+								const unsigned int num_genes,
+								const unsigned int uORF_gene_percent,
+								const unsigned int max_uORFs_per_gene );
+
+int run_pipeline_benchmarks( void );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _BENCH__SUPPORT_H_
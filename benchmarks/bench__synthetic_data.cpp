@@ -0,0 +1,1091 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : bench__synthetic_data.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Generator for a synthetic, yeast-like dataset (genome .gff,
+//				 uORF source tables, TSS annotations, read densities, GO data,
+//				 and the remaining per-gene tables) in the formats the program
+//				 reads, so that the whole pipeline can be timed at any scale
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//     *C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>   	// For sort()
+#include <iomanip>      // For "setw()" and "setfill()"
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__file_io.h"
+#include "support__general.h"
+#include "support__bioinformatics.h"
+
+// Header file for the benchmark support classes
+#include "bench__support.h"
+
+
+
+// uORF source tables (each synthetic uORF is listed in at least one)
+#define SYNTHETIC_SOURCE_MIURA				( 1 << 0 )
+#define SYNTHETIC_SOURCE_INGOLIA			( 1 << 1 )
+#define SYNTHETIC_SOURCE_ZHANG_DIETRICH_NAR	( 1 << 2 )
+#define SYNTHETIC_SOURCE_ZHANG_DIETRICH_CG	( 1 << 3 )
+#define SYNTHETIC_SOURCE_NAGALAKSHMI		( 1 << 4 )
+#define SYNTHETIC_SOURCE_CVIJOVIC			( 1 << 5 )
+#define SYNTHETIC_SOURCE_GUAN				( 1 << 6 )
+#define SYNTHETIC_SOURCE_LAWLESS			( 1 << 7 )
+#define SYNTHETIC_SOURCE_SELPI				( 1 << 8 )
+#define NUM_SYNTHETIC_SOURCES				9
+
+// Gene layout (nucleotides unless noted)
+#define SYNTHETIC_MIN_CDS_CODONS			100
+#define SYNTHETIC_MAX_CDS_CODONS			600
+#define SYNTHETIC_MIN_uORF_CODONS			3			// Including the start and stop codons
+#define SYNTHETIC_MAX_uORF_CODONS			40
+#define SYNTHETIC_MIN_UTR_SPACER			12			// Before, between, and after uORFs, so each start context lies within the UTR
+#define SYNTHETIC_MAX_UTR_SPACER			60
+#define SYNTHETIC_MIN_NO_uORF_UTR			20
+#define SYNTHETIC_MAX_NO_uORF_UTR			200
+#define SYNTHETIC_MIN_INTERGENIC			100
+#define SYNTHETIC_CHROM_END_PADDING			1000
+#define SYNTHETIC_MAX_TSS_JITTER			5			// TSS coordinates of the different TSS sources scatter by up to this much
+#define SYNTHETIC_READS_PER_TRANSCRIPT		3
+#define SYNTHETIC_FASTA_LINE_LENGTH			80
+#define SYNTHETIC_GO_BRANCHING				4			// Children per GO term
+
+// Percentage of genes listed in the smaller tables
+#define SYNTHETIC_BRAR_GENE_PERCENT			10
+#define SYNTHETIC_DUTTAGUPTA_GENE_PERCENT	25
+#define SYNTHETIC_GUAN_NMD_GENE_PERCENT		5
+#define SYNTHETIC_TRANSL_EFFECT_PERCENT		5			// Of the genes with uORFs
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Append random nucleotides, redrawing any that would complete an 'ATG' (so the only start codons in a 5' UTR are
+//   those of the planted uORFs)
+static void append_ATG_free_seq( string * const seq, const unsigned int len, TBenchmark_Random * const Random )
+{
+	for( unsigned int i = 0; i < len; i++ )
+	{
+		char nt = Random->next_nt();
+
+		while( nt == 'G' && seq->size() >= 2 && (*seq)[ seq->size() - 2 ] == 'A' && (*seq)[ seq->size() - 1 ] == 'T' )
+		{
+			nt = Random->next_nt();
+		}
+
+		seq->push_back( nt );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Append a uORF of 'num_codons' codons (start and stop codons included) with no in-frame stop codon and no 'ATG' other
+//   than its start codon
+static void append_uORF( string * const seq, const unsigned int num_codons, TBenchmark_Random * const Random )
+{
+	seq->append( "ATG" );
+
+	for( unsigned int codon_it = 1; codon_it < num_codons - 1; codon_it++ )
+	{
+		string codon;
+
+		do
+		{
+			seq->resize( seq->size() - codon.size() );
+			append_ATG_free_seq( seq, 3, Random );
+			codon = seq->substr( seq->size() - 3 );
+
+		} while( codon == "TAA" || codon == "TAG" || codon == "TGA" );
+	}
+
+
+	// 'TGA' after an 'A' would add an 'ATG'
+	const char * stop_codons[] = { "TAA", "TAG", "TGA" };
+	unsigned int stop_it = Random->next_below( 3 );
+
+	if( stop_it == 2 && (*seq)[ seq->size() - 1 ] == 'A' ) { stop_it = Random->next_below( 2 ); }
+
+	seq->append( stop_codons[stop_it] );
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+static string get_reverse_complement( const string & seq )
+{
+	string rev_comp( seq.size(), 'N' );
+
+	for( unsigned int i = 0; i < seq.size(); i++ )
+	{
+		char nt = seq[ seq.size() - 1 - i ];
+
+		if	   ( nt == 'A' ) { rev_comp[i] = 'T'; }
+		else if( nt == 'T' ) { rev_comp[i] = 'A'; }
+		else if( nt == 'C' ) { rev_comp[i] = 'G'; }
+		else if( nt == 'G' ) { rev_comp[i] = 'C'; }
+	}
+
+	return rev_comp;
+}
+//------------------------------------------------------------------------------
+
+
+// SGD-style systematic name:  'Y', the chromosome letter ('A' = chrI), the chromosome arm, a 3-digit number counted
+//   outward from the centromere, and the strand.  Arms with more than 999 genes (only at large scales) reuse the
+//   numbers with a '-2', '-3', ... suffix, which leaves the strand letter at 'STRAND_INDICATOR_POS'
+static string get_synthetic_gene_name( const unsigned int chrom_num, const unsigned int gene_it, const unsigned int num_genes_in_chrom, const bool opposite_strand )
+{
+	const unsigned int num_genes_left_arm = num_genes_in_chrom / 2;
+
+	char arm = ( gene_it < num_genes_left_arm ? 'L' : 'R' );
+	unsigned int arm_it = ( gene_it < num_genes_left_arm ? num_genes_left_arm - 1 - gene_it : gene_it - num_genes_left_arm );
+
+	char gene_name[32];
+	sprintf( gene_name, "Y%c%c%03u%c", 'A' + chrom_num - 1, arm, arm_it % 999 + 1, ( opposite_strand ? 'C' : 'W' ) );
+
+	string name = gene_name;
+	if( arm_it >= 999 ) { name += "-" + get_str( arm_it / 999 + 1 ); }
+
+	return name;
+}
+//------------------------------------------------------------------------------
+
+
+// Build the gene's 5' UTR (and uORFs) and CDS, and return its transcript (5' to 3')
+static string generate_synthetic_transcript( TSynthetic_Gene * const Gene, const bool has_uORFs, const unsigned int max_uORFs_per_gene, TBenchmark_Random * const Random )
+{
+	string five_prime_UTR = "";
+	vector <unsigned int> uORF_start_it( 0 );
+	vector <unsigned int> uORF_codons( 0 );
+
+	if( has_uORFs == TRUE )
+	{
+		append_ATG_free_seq( &five_prime_UTR, SYNTHETIC_MIN_UTR_SPACER + Random->next_below( SYNTHETIC_MAX_UTR_SPACER - SYNTHETIC_MIN_UTR_SPACER ), Random );
+
+		const unsigned int num_uORFs = 1 + Random->next_below( max_uORFs_per_gene );
+
+		// uORFs within a gene have distinct lengths, since some sources identify a gene's uORFs by length alone
+		while( uORF_codons.size() < num_uORFs )
+		{
+			unsigned int num_codons = SYNTHETIC_MIN_uORF_CODONS + Random->next_below( SYNTHETIC_MAX_uORF_CODONS - SYNTHETIC_MIN_uORF_CODONS + 1 );
+
+			if( find( uORF_codons.begin(), uORF_codons.end(), num_codons ) == uORF_codons.end() ) { uORF_codons.push_back( num_codons ); }
+		}
+
+		for( unsigned int i = 0; i < num_uORFs; i++ )
+		{
+			uORF_start_it.push_back( five_prime_UTR.size() );
+			append_uORF( &five_prime_UTR, uORF_codons[i], Random );
+
+			append_ATG_free_seq( &five_prime_UTR, SYNTHETIC_MIN_UTR_SPACER + Random->next_below( SYNTHETIC_MAX_UTR_SPACER - SYNTHETIC_MIN_UTR_SPACER ), Random );
+		}
+	}
+	else/*( has_uORFs == FALSE )*/
+	{
+		append_ATG_free_seq( &five_prime_UTR, SYNTHETIC_MIN_NO_uORF_UTR + Random->next_below( SYNTHETIC_MAX_NO_uORF_UTR - SYNTHETIC_MIN_NO_uORF_UTR ), Random );
+	}
+
+
+	for( unsigned int i = 0; i < uORF_start_it.size(); i++ )
+	{
+		TSynthetic_uORF uORF;
+		uORF.rel_pos 	   = (int)uORF_start_it[i] - (int)five_prime_UTR.size();
+		uORF.length 	   = 3 * uORF_codons[i];
+		uORF.sequence 	   = five_prime_UTR.substr( uORF_start_it[i], uORF.length );
+		uORF.start_context = five_prime_UTR.substr( uORF_start_it[i] - START_CONTEXT_NT_BEFORE_AUG, START_CONTEXT_LENGTH_NT );
+		uORF.AUGCAI 	   = 0.1 + Random->next_below( 800 ) / 1000.0;
+
+		// List each uORF in about a third of the sources, and at least one
+		for( unsigned int source_it = 0; source_it < NUM_SYNTHETIC_SOURCES; source_it++ )
+		{
+			if( Random->next_below( 3 ) == 0 ) { uORF.sources |= ( 1 << source_it ); }
+		}
+
+		if( uORF.sources == 0 ) { uORF.sources = ( 1 << Random->next_below( NUM_SYNTHETIC_SOURCES ) ); }
+
+		Gene->uORFs.push_back( uORF );
+	}
+
+
+	const unsigned int CDS_codons = SYNTHETIC_MIN_CDS_CODONS + Random->next_below( SYNTHETIC_MAX_CDS_CODONS - SYNTHETIC_MIN_CDS_CODONS );
+	const string CDS = "ATG" + Random->next_DNA_seq( 3 * ( CDS_codons - 2 ), FALSE ) + "TAA";
+
+	Gene->five_prime_UTR = five_prime_UTR;
+	Gene->CDS_length 	 = CDS.size();
+
+	return five_prime_UTR + CDS;
+}
+//------------------------------------------------------------------------------
+
+
+// Lay out each chromosome as random intergenic sequence alternating with transcripts (placed on either strand)
+static void generate_synthetic_genome( const unsigned long genome_size_nt,
+									   const unsigned int num_genes,
+									   const unsigned int uORF_gene_percent,
+									   const unsigned int max_uORFs_per_gene,
+									   vector <string> * const chrom_seqs,
+									   vector <TSynthetic_Gene> * const Genes,
+									   TBenchmark_Random * const Random )
+{
+	chrom_seqs->assign( NUM_S_CEREVISIAE_CHROM, "" );
+	Genes->reserve( num_genes );
+
+	const unsigned long chrom_size_nt = genome_size_nt / NUM_S_CEREVISIAE_CHROM;
+
+	for( unsigned int chrom_it = 0; chrom_it < NUM_S_CEREVISIAE_CHROM; chrom_it++ )
+	{
+		const unsigned int num_genes_in_chrom = num_genes / NUM_S_CEREVISIAE_CHROM + ( chrom_it < num_genes % NUM_S_CEREVISIAE_CHROM ? 1 : 0 );
+		const unsigned long nt_per_gene = chrom_size_nt / ( num_genes_in_chrom + 1 );
+
+		string & chrom_seq = chrom_seqs->at( chrom_it );
+		chrom_seq.reserve( chrom_size_nt + SYNTHETIC_CHROM_END_PADDING );
+
+		for( unsigned int gene_it = 0; gene_it < num_genes_in_chrom; gene_it++ )
+		{
+			TSynthetic_Gene Gene;
+			Gene.chrom_num 		 = chrom_it + 1;
+			Gene.opposite_strand = ( Random->next_below( 2 ) == 1 );
+			Gene.name 			 = get_synthetic_gene_name( Gene.chrom_num, gene_it, num_genes_in_chrom, Gene.opposite_strand );
+
+			string transcript = generate_synthetic_transcript( &Gene, ( Random->next_below( 100 ) < uORF_gene_percent ), max_uORFs_per_gene, Random );
+
+
+			// Intergenic sequence takes up whatever the transcripts don't, on average
+			unsigned long intergenic_len = ( nt_per_gene > transcript.size() + SYNTHETIC_MIN_INTERGENIC ? nt_per_gene - transcript.size() : SYNTHETIC_MIN_INTERGENIC );
+			intergenic_len = intergenic_len / 2 + Random->next_below( intergenic_len );
+
+			chrom_seq.append( Random->next_DNA_seq( intergenic_len ) );
+
+
+			const unsigned int transcript_first_it = chrom_seq.size();
+			const unsigned int UTR_len = Gene.five_prime_UTR.size();
+
+			if( Gene.opposite_strand == FALSE )
+			{
+				chrom_seq.append( transcript );
+
+				Gene.tss_coord 		 = transcript_first_it + 1;
+				Gene.CDS_start_coord = transcript_first_it + UTR_len + 1;
+			}
+			else/*( Gene.opposite_strand == TRUE )*/
+			{
+				chrom_seq.append( get_reverse_complement( transcript ) );
+
+				Gene.tss_coord 		 = transcript_first_it + transcript.size();
+				Gene.CDS_start_coord = transcript_first_it + transcript.size() - UTR_len;
+			}
+
+			Genes->push_back( Gene );
+		}
+
+		chrom_seq.append( Random->next_DNA_seq( SYNTHETIC_CHROM_END_PADDING ) );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Random value in [min_val, max_val), formatted for a table cell
+static string get_random_value_str( const double min_val, const double max_val, TBenchmark_Random * const Random )
+{
+	return get_str( min_val + ( max_val - min_val ) * Random->next_below( 1000000 ) / 1000000.0 );
+}
+//------------------------------------------------------------------------------
+
+
+// Some tables have a title (and notes) above the header row
+static void add_title_rows( vector <vector <string> > * const table, const unsigned int header_row, const string & title )
+{
+	const unsigned int num_columns = table->at( 0 ).size();
+
+	for( unsigned int i = 1; i < header_row; i++ )
+	{
+		vector <string> title_row( num_columns, "" );
+		title_row[0] = ( i == 1 ? title : "" );
+
+		table->insert( table->begin() + ( i - 1 ), title_row );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+static int write_synthetic_table( const string & file_name, const vector <vector <string> > & table )
+{
+	if( write_2d_vector_to_csv( PATH_DATA_FOLDER, file_name, table, TRUE ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'write_synthetic_table()': Could not write '" + file_name + "'. ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// The annotations for each chromosome, followed by the sequences, in the layout of the SGD .gff
+static int write_synthetic_gff( const vector <string> & chrom_seqs, const vector <TSynthetic_Gene> & Genes )
+{
+	ostringstream gff_oss;
+	gff_oss << "##gff-version 3\n"
+			<< "#date " << format_system_date( time( NULL ) ) << "\n"
+			<< "#Synthetic S. cerevisiae-like genome (see 'generate_synthetic_dataset()')\n";
+
+	unsigned int gene_it = 0;
+
+	for( unsigned int chrom_it = 0; chrom_it < chrom_seqs.size(); chrom_it++ )
+	{
+		const string chrom_id = "chr" + convert_uint_to_roman_numeral( chrom_it + 1 );
+
+		gff_oss << chrom_id << "\tSGD\tchromosome\t1\t" << chrom_seqs[chrom_it].size() << "\t.\t.\t.\tID=" << chrom_id << ";Name=" << chrom_id << "\n";
+
+		for( ; gene_it < Genes.size() && Genes[gene_it].chrom_num == chrom_it + 1; gene_it++ )
+		{
+			const TSynthetic_Gene & Gene = Genes[gene_it];
+			const char strand = ( Gene.opposite_strand ? '-' : '+' );
+
+			const string coord = get_str( Gene.get_CDS_low_coord() ) + "\t" + get_str( Gene.get_CDS_high_coord() ) + "\t.\t" + strand;
+
+			gff_oss << chrom_id << "\tSGD\tgene\t" << coord << "\t.\tID=" << Gene.name << ";Name=" << Gene.name << ";orf_classification=Verified\n"
+					<< chrom_id << "\tSGD\tCDS\t"  << coord << "\t0\tParent=" << Gene.name << "_mRNA;Name=" << Gene.name << "_CDS;orf_classification=Verified\n"
+					<< chrom_id << "\tSGD\tmRNA\t" << coord << "\t.\tID=" << Gene.name << "_mRNA;Name=" << Gene.name << "_mRNA;Parent=" << Gene.name << "\n";
+		}
+	}
+
+
+	gff_oss << GFF_FILE_FASTA_ID;
+
+	for( unsigned int chrom_it = 0; chrom_it < chrom_seqs.size(); chrom_it++ )
+	{
+		gff_oss << FASTA_SEQ_START_ID << "chr" << convert_uint_to_roman_numeral( chrom_it + 1 ) << "\n";
+
+		for( size_t line_start = 0; line_start < chrom_seqs[chrom_it].size(); line_start += SYNTHETIC_FASTA_LINE_LENGTH )
+		{
+			gff_oss << chrom_seqs[chrom_it].substr( line_start, SYNTHETIC_FASTA_LINE_LENGTH ) << "\n";
+		}
+	}
+
+
+	// The file is written in one piece, since 'write_file_contents()' can't append
+	if( write_file_contents( PATH_S_CEREVISIA_FASTA_FOLDER, S_CEREVISIAE_GFF_FILE_NAME, gff_oss.str(), TRUE ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_synthetic_gff()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// One table per uORF source, each in the layout (and with the coordinate conventions) its extraction function expects
+static int write_synthetic_uORF_sources( const vector <TSynthetic_Gene> & Genes, TBenchmark_Random * const Random )
+{
+	vector <vector <string> > Miura_table  ( 1, vector <string>( 0 ) );
+	vector <vector <string> > Ingolia_table( 1, vector <string>( 0 ) );
+	vector <vector <string> > ZD_NAR_table ( 1, vector <string>( 0 ) );
+	vector <vector <string> > ZD_CG_table  ( 1, vector <string>( 0 ) );
+	vector <vector <string> > Naga_table   ( 1, vector <string>( 0 ) );
+	vector <vector <string> > Cvij_table   ( 1, vector <string>( 0 ) );
+	vector <vector <string> > Guan_table   ( 1, vector <string>( 0 ) );
+	vector <vector <string> > Lawless_table( 1, vector <string>( 0 ) );
+	vector <vector <string> > Selpi_table  ( 1, vector <string>( 0 ) );
+
+
+	// ------------------------------
+	// Header rows
+	const string Miura_header[] 	= { MIURA_CLONE_ID_HEADER, MIURA_UTR_COORD_HEADER, MIURA_SYST_NAME_HEADER, MIURA_UTR_LENGTH_HEADER, MIURA_uORFS_PRESENT_HEADER, MIURA_uORFS_INFO_HEADER, MIURA_COMMENTS_HEADER };
+	const string Ingolia_header[] 	= { INGOLIA_SYST_NAME_HEADER, INGOLIA_GENE_NAME_HEADER, INGOLIA_uORF_COORD_HEADER, GENERAL_uORF_LENGTH_HEADER, INGOLIA_uORF_TO_CDS_HEADER, INGOLIA_INIT_SITE_HEADER,
+										INGOLIA_NUM_RIB_HEADER, INGOLIA_NUM_mRNA_HEADER, INGOLIA_CDS_RIB_HEADER, INGOLIA_CDS_mRNA_HEADER };
+	const string ZD_NAR_header[] 	= { GENERAL_SYST_NAME_HEADER, GENERAL_CHROMOSOME_HEADER, ZHANG_DIET_NAR_GENE_HEADER, GENERAL_uORF_LENGTH_HEADER, ZHANG_DIET_NAR_TSS_POS_HEADER, ZHANG_DIET_NAR_uORF_HEADER };
+	const string ZD_CG_header[] 	= { GENERAL_SYST_NAME_HEADER, GENERAL_CHROMOSOME_HEADER, GENERAL_uORF_LENGTH_HEADER, ZHANG_DIET_CG_REL_POS_HEADER, ZHANG_DIET_CG_uORF_HEADER, ZHANG_DIET_CG_CONTEXT_HEADER };
+	const string Naga_header[] 		= { NAGALAKSHMI_SYST_NAME_HEADER, NAGALAKSHMI_CHROM_NUM_HEADER, NAGALAKSHMI_5PRIME_UTR_START_HEADER, NAGALAKSHMI_uORF_LEN_HEADER, NAGALAKSHMI_5PRIME_UTR_HEADER };
+	const string Cvij_header[] 		= { GENERAL_SYST_NAME_HEADER, GENERAL_uORF_LENGTH_HEADER, CVIJOVIC_RELATIVE_POS_HEADER, CVIJOVIC_INTERGENIC_SIZE_HEADER };
+	const string Guan_header[] 		= { GENERAL_SYST_NAME_HEADER, GUAN_SYST_NAME_HEADER, GUAN_uORF_START_HEADER, GUAN_uORF_END_HEADER, GUAN_uORF_LENGTH_HEADER, GUAN_TSS_REL_POS_HEADER,
+										GUAN_START_CONTEXT_HEADER, GUAN_POS_NEG3_NT_HEADER, GUAN_AUGCAI_HEADER };
+	const string Lawless_header[] 	= { GENERAL_SYST_NAME_HEADER, LAWLESS_UTR_LENGTH_HEADER, LAWLESS_uORF_START_HEADER, LAWLESS_uORF_LENGTH_HEADER, LAWLESS_uORF_SEQUENCE_HEADER };
+	const string Selpi_header[] 	= { GENERAL_SYST_NAME_HEADER, SELPI_uORF_ID_HEADER, SELPI_DISTANCE_TO_CDS_HEADER, SELPI_uORF_LENGTH_HEADER };
+
+	Miura_table[0].assign  ( Miura_header,   Miura_header   + sizeof( Miura_header   ) / sizeof( string ) );
+	Ingolia_table[0].assign( Ingolia_header, Ingolia_header + sizeof( Ingolia_header ) / sizeof( string ) );
+	ZD_NAR_table[0].assign ( ZD_NAR_header,  ZD_NAR_header  + sizeof( ZD_NAR_header  ) / sizeof( string ) );
+	ZD_CG_table[0].assign  ( ZD_CG_header,   ZD_CG_header   + sizeof( ZD_CG_header   ) / sizeof( string ) );
+	Naga_table[0].assign   ( Naga_header,    Naga_header    + sizeof( Naga_header    ) / sizeof( string ) );
+	Cvij_table[0].assign   ( Cvij_header,    Cvij_header    + sizeof( Cvij_header    ) / sizeof( string ) );
+	Guan_table[0].assign   ( Guan_header,    Guan_header    + sizeof( Guan_header    ) / sizeof( string ) );
+	Lawless_table[0].assign( Lawless_header, Lawless_header + sizeof( Lawless_header ) / sizeof( string ) );
+	Selpi_table[0].assign  ( Selpi_header,   Selpi_header   + sizeof( Selpi_header   ) / sizeof( string ) );
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// One row per uORF (per gene for Miura)
+	for( unsigned int gene_it = 0; gene_it < Genes.size(); gene_it++ )
+	{
+		const TSynthetic_Gene & Gene = Genes[gene_it];
+		if( Gene.uORFs.empty() == TRUE ) { continue; }
+
+		const unsigned int UTR_len = Gene.five_prime_UTR.size();
+		const int strand_sign = ( Gene.opposite_strand ? -1 : 1 );
+		const string roman_chrom_num = convert_uint_to_roman_numeral( Gene.chrom_num );
+
+		string Miura_uORF_info = "";
+		unsigned int num_Miura_uORFs = 0;
+		bool first_Cvijovic_uORF = TRUE;
+
+		for( unsigned int uORF_it = 0; uORF_it < Gene.uORFs.size(); uORF_it++ )
+		{
+			const TSynthetic_uORF & uORF = Gene.uORFs[uORF_it];
+
+			// Genome coordinates of the uORF's first and last nucleotides
+			const unsigned int uORF_start_coord = Gene.CDS_start_coord + strand_sign * uORF.rel_pos;
+			const unsigned int uORF_end_coord   = uORF_start_coord + strand_sign * ( (int)uORF.length - 1 );
+
+
+			if( uORF.sources & SYNTHETIC_SOURCE_MIURA )
+			{
+				Miura_uORF_info += "-" + get_str( -uORF.rel_pos ) + "/" + get_str( uORF.length / 3 ) + "/" + get_str( uORF.AUGCAI ) + ",";
+				num_Miura_uORFs++;
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_INGOLIA )
+			{
+				const string row[] = { Gene.name, Gene.name, "chr" + roman_chrom_num + "@" + get_str( uORF_start_coord ) + INGOLIA_uORF_COORD_SEP + get_str( uORF_end_coord ),
+									   get_str( uORF.length ), get_str( -uORF.rel_pos - (int)uORF.length + 1 ), uORF.start_context,
+									   get_str( (unsigned int)Random->next_below( 200 ) ), get_str( (unsigned int)Random->next_below( 200 ) ),
+									   get_random_value_str( 1, 500, Random ), get_random_value_str( 1, 500, Random ) };
+				Ingolia_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_ZHANG_DIETRICH_NAR )
+			{
+				const string row[] = { Gene.name, get_str( Gene.chrom_num ), Gene.name, get_str( uORF.length ), get_str( -(int)UTR_len ), convert_to_AA_seq( uORF.sequence ) };
+				ZD_NAR_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_ZHANG_DIETRICH_CG )
+			{
+				const string row[] = { Gene.name, get_str( Gene.chrom_num ), get_str( uORF.length ), get_str( uORF.rel_pos ), convert_to_AA_seq( uORF.sequence ), uORF.start_context };
+				ZD_CG_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_NAGALAKSHMI )
+			{
+				const string row[] = { Gene.name, "chr" + roman_chrom_num, get_str( Gene.CDS_start_coord - strand_sign * ( (int)UTR_len - 1 ) ),
+									   get_str( uORF.length / 3 - 1 ), Gene.five_prime_UTR + "ATG" };
+				Naga_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_CVIJOVIC )
+			{
+				// Only the first row of each gene is named
+				const string row[] = { ( first_Cvijovic_uORF ? Gene.name : "" ), get_str( uORF.length / 3 - 1 ), get_str( uORF.rel_pos - 1 ), get_str( UTR_len + SYNTHETIC_MIN_INTERGENIC ) };
+				Cvij_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+				first_Cvijovic_uORF = FALSE;
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_GUAN )
+			{
+				const string row[] = { Gene.name, Gene.name, get_str( uORF.rel_pos ), get_str( uORF.rel_pos + (int)uORF.length - 1 ), get_str( uORF.length ), get_str( -(int)UTR_len ),
+									   uORF.start_context, uORF.start_context.substr( START_CONTEXT_NT_BEFORE_AUG - 3, 1 ), get_str( uORF.AUGCAI ) };
+				Guan_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_LAWLESS )
+			{
+				const string row[] = { Gene.name, get_str( UTR_len ), get_str( uORF.rel_pos ), get_str( uORF.length ), uORF.sequence };
+				Lawless_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+
+			if( uORF.sources & SYNTHETIC_SOURCE_SELPI )
+			{
+				const string row[] = { Gene.name, Gene.name + "_" + get_str( uORF_it + 1 ), get_str( -uORF.rel_pos ), get_str( uORF.length / 3 ) };
+				Selpi_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+			}
+		}
+
+
+		if( num_Miura_uORFs != 0 )
+		{
+			// The UTR ends immediately before the start codon, so the coordinates match the .gff exactly
+			const string UTR_coord = "chr" + get_str( Gene.chrom_num ) + "(" + get_str( Gene.tss_coord ) + "-" + get_str( Gene.CDS_start_coord - strand_sign ) + ")";
+
+			const string row[] = { "SYN" + get_str( gene_it ), UTR_coord, Gene.name, get_str( UTR_len ), get_str( num_Miura_uORFs ), Miura_uORF_info, "" };
+			Miura_table.push_back( vector <string>( row, row + sizeof( row ) / sizeof( string ) ) );
+		}
+	}
+
+	add_title_rows( &Naga_table, NAGALAKSHMI_HEADER_ROW, "Synthetic uORFs" );
+	// ------------------------------
+
+
+
+	if( write_synthetic_table( uORF_FILE_NAME_MIURA, 			  Miura_table   ) ||
+		write_synthetic_table( uORF_ALL_FILE_NAME_INGOLIA, 		  Ingolia_table ) ||
+		write_synthetic_table( uORF_FILE_NAME_ZHANG_DIETRICH_NAR, ZD_NAR_table  ) ||
+		write_synthetic_table( uORF_FILE_NAME_ZHANG_DIETRICH_CG,  ZD_CG_table   ) ||
+		write_synthetic_table( uORF_FILE_NAME_NAGALAKSHMI, 		  Naga_table    ) ||
+		write_synthetic_table( uORF_FILE_NAME_CVIJOVIC, 		  Cvij_table    ) ||
+		write_synthetic_table( uORF_FILE_NAME_GUAN, 			  Guan_table    ) ||
+		write_synthetic_table( uORF_FILE_NAME_LAWLESS, 			  Lawless_table ) ||
+		write_synthetic_table( uORF_FILE_NAME_SELPI, 			  Selpi_table   )    )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_synthetic_uORF_sources()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// TSS annotations from each TSS source (the Miura table and the five SGD GBrowse tracks)
+static int write_synthetic_TSS_data( const vector <TSynthetic_Gene> & Genes, TBenchmark_Random * const Random )
+{
+	const string Miura_header[] = { MIURA_TSS_CLONE_ID_HEADER, MIURA_TSS_SYST_NAME_HEADER, MIURA_TSS_HIT_START_HEADER, MIURA_TSS_HIT_END_HEADER };
+	vector <vector <string> > Miura_TSS_table( 1, vector <string>( Miura_header, Miura_header + sizeof( Miura_header ) / sizeof( string ) ) );
+
+	const string gff3_header = "##gff-version 3\n#Synthetic TSS annotations (see 'generate_synthetic_dataset()')\n";
+
+	ostringstream Zhang_Dietrich_oss;
+	ostringstream Xu_oss;
+	ostringstream Yassour_oss;
+	ostringstream Nagalakshmi_oss;
+	ostringstream David_oss;
+
+	Zhang_Dietrich_oss << gff3_header;
+	Xu_oss 			   << gff3_header;
+	Yassour_oss 	   << gff3_header;
+	Nagalakshmi_oss    << gff3_header;
+	David_oss 		   << gff3_header;
+
+
+	for( unsigned int gene_it = 0; gene_it < Genes.size(); gene_it++ )
+	{
+		const TSynthetic_Gene & Gene = Genes[gene_it];
+		const int strand_sign = ( Gene.opposite_strand ? -1 : 1 );
+		const char strand = ( Gene.opposite_strand ? '-' : '+' );
+		const string chrom_id = "chr" + convert_uint_to_roman_numeral( Gene.chrom_num );
+
+		// Each source places the TSS slightly differently, but always upstream of the start codon.  'tss[]' is in the
+		//   order Miura, Zhang & Dietrich (twice), Xu, Yassour, Nagalakshmi, David
+		unsigned int tss[7];
+		for( unsigned int i = 0; i < 7; i++ )
+		{
+			tss[i] = Gene.tss_coord + strand_sign * Random->next_below( SYNTHETIC_MAX_TSS_JITTER + 1 );
+		}
+
+		// The other end of each transcript feature (within the CDS)
+		const unsigned int transcr_end = Gene.CDS_start_coord + strand_sign * ( Gene.CDS_length / 2 );
+
+		const unsigned int first[] = { ( Gene.opposite_strand ? transcr_end : tss[3] ), ( Gene.opposite_strand ? transcr_end : tss[4] ),
+									   ( Gene.opposite_strand ? transcr_end : tss[5] ), ( Gene.opposite_strand ? transcr_end : tss[6] ) };
+		const unsigned int last[]  = { ( Gene.opposite_strand ? tss[3] : transcr_end ), ( Gene.opposite_strand ? tss[4] : transcr_end ),
+									   ( Gene.opposite_strand ? tss[5] : transcr_end ), ( Gene.opposite_strand ? tss[6] : transcr_end ) };
+
+
+		const string Miura_row[] = { "SYN" + get_str( gene_it ), Gene.name,
+									 get_str( Gene.opposite_strand ? tss[0] - 35 : tss[0] ), get_str( Gene.opposite_strand ? tss[0] : tss[0] + 35 ) };
+		Miura_TSS_table.push_back( vector <string>( Miura_row, Miura_row + sizeof( Miura_row ) / sizeof( string ) ) );
+
+		for( unsigned int i = 1; i <= 2; i++ )
+		{
+			Zhang_Dietrich_oss << chrom_id << "\tZhang_Dietrich\tTSS\t" << tss[i] << "\t" << tss[i] << "\t.\t" << strand << "\t.\t"
+							   << "ID=TSS_" << gene_it << "_" << i << ";frequency=" << 1 + Random->next_below( 20 ) << ";associated_ORF=" << Gene.name << "\n";
+		}
+
+		Xu_oss 		    << chrom_id << "\tXu_2009_ORFs\ttranscript\t" 	  << first[0] << "\t" << last[0] << "\t.\t" << strand << "\t.\t"
+						<< "ID=Xu_" << gene_it << ";Name=" << Gene.name << ";end_confidence=high\n";
+		Yassour_oss     << chrom_id << "\tYassour_2009\tfive_prime_UTR\t" << first[1] << "\t" << last[1] << "\t.\t" << strand << "\t.\t"
+						<< "ID=Yassour_" << gene_it << ";Name=" << Gene.name << "_5UTR;Alias=" << Gene.name << "\n";
+		Nagalakshmi_oss << chrom_id << "\tNagalakshmi_2008\tfive_prime_UTR\t" << first[2] << "\t" << last[2] << "\t.\t" << strand << "\t.\t"
+						<< "ID=Nagalakshmi_" << gene_it << ";Name=" << Gene.name << "_5UTR;log2_transcription_level=" << get_random_value_str( 1, 15, Random ) << "\n";
+		David_oss 	    << chrom_id << "\tDavid_2006_total\ttranscript\t" << first[3] << "\t" << last[3] << "\t" << get_random_value_str( 1, 10, Random ) << "\t" << strand << "\t.\t"
+						<< "ID=David_" << gene_it << ";utr5=" << Gene.five_prime_UTR.size() << ";utr3=" << 50 + Random->next_below( 200 )
+						<< ";overlapFeatAll=" << Gene.name << ";oppositeExpr=0\n";
+	}
+
+
+	if( write_synthetic_table( MIURA_TSS_DATA_FILE_NAME, Miura_TSS_table ) ||
+		write_file_contents( PATH_DATA_FOLDER, ZHANG_DIETRICH_TSS_DATA_FILE_NAME, Zhang_Dietrich_oss.str(), TRUE ) ||
+		write_file_contents( PATH_DATA_FOLDER, XU_TSS_DATA_FILE_NAME, 			  Xu_oss.str(), 		   TRUE ) ||
+		write_file_contents( PATH_DATA_FOLDER, YASSOUR_TSS_DATA_FILE_NAME, 		  Yassour_oss.str(), 	   TRUE ) ||
+		write_file_contents( PATH_DATA_FOLDER, NAGALAKSHMI_TSS_DATA_FILE_NAME, 	  Nagalakshmi_oss.str(),   TRUE ) ||
+		write_file_contents( PATH_DATA_FOLDER, DAVID_TSS_DATA_FILE_NAME, 		  David_oss.str(), 		   TRUE )    )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_synthetic_TSS_data()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// TATL-seq read densities:  a position and a density column per chromosome, each ending with 'DEFAULT_NAN' (Crick reads
+//   have negative densities).  Every chromosome ends with a zero-density read at its last nucleotide, so the upstream
+//   window of its last gene is bounded
+static int write_synthetic_read_densities( const vector <unsigned long> & chrom_lengths, const vector <TSynthetic_Gene> & Genes, TBenchmark_Random * const Random )
+{
+	vector <vector <string> > columns( 2 * NUM_S_CEREVISIAE_CHROM, vector <string>( 0 ) );
+
+	for( unsigned int chrom_it = 0; chrom_it < NUM_S_CEREVISIAE_CHROM; chrom_it++ )
+	{
+		columns[2 * chrom_it	].push_back( "Chr" + convert_uint_to_roman_numeral( chrom_it + 1 ) + " Positions" 	   );
+		columns[2 * chrom_it + 1].push_back( "Chr" + convert_uint_to_roman_numeral( chrom_it + 1 ) + " Read Densities" );
+	}
+
+
+	for( unsigned int gene_it = 0; gene_it < Genes.size(); gene_it++ )
+	{
+		const TSynthetic_Gene & Gene = Genes[gene_it];
+		const unsigned int UTR_len = Gene.five_prime_UTR.size();
+
+		vector <unsigned int> read_pos( 0 );
+		for( unsigned int i = 0; i < SYNTHETIC_READS_PER_TRANSCRIPT; i++ )
+		{
+			unsigned int offset = i * UTR_len / SYNTHETIC_READS_PER_TRANSCRIPT;
+			read_pos.push_back( Gene.opposite_strand ? Gene.tss_coord - offset : Gene.tss_coord + offset );
+		}
+
+		sort( read_pos.begin(), read_pos.end() );
+
+		for( unsigned int i = 0; i < read_pos.size(); i++ )
+		{
+			columns[2 * ( Gene.chrom_num - 1 )	  ].push_back( get_str( read_pos[i] ) );
+			columns[2 * ( Gene.chrom_num - 1 ) + 1].push_back( get_random_value_str( ( Gene.opposite_strand ? -60 : 5 ), ( Gene.opposite_strand ? -5 : 60 ), Random ) );
+		}
+	}
+
+
+	unsigned int num_rows = 0;
+
+	for( unsigned int chrom_it = 0; chrom_it < NUM_S_CEREVISIAE_CHROM; chrom_it++ )
+	{
+		columns[2 * chrom_it	].push_back( get_str( (unsigned int)chrom_lengths[chrom_it] ) );
+		columns[2 * chrom_it + 1].push_back( "0" );
+
+		columns[2 * chrom_it	].push_back( get_str( DEFAULT_NAN ) );
+		columns[2 * chrom_it + 1].push_back( get_str( DEFAULT_NAN ) );
+
+		num_rows = max( num_rows, (unsigned int)columns[2 * chrom_it].size() );
+	}
+
+
+	vector <vector <string> > table( num_rows, vector <string>( columns.size(), "" ) );
+
+	for( unsigned int col_it = 0; col_it < columns.size(); col_it++ )
+	{
+		for( unsigned int row_it = 0; row_it < columns[col_it].size(); row_it++ )
+		{
+			table[row_it][col_it] = columns[col_it][row_it];
+		}
+	}
+
+	return write_synthetic_table( ARRIBERE_TATL_SEQ_FILE_NAME, table );
+}
+//==============================================================================
+
+
+
+// The GO database (.obo), the simplified hierarchy derived from it (normally generated by 'generate_simple_GO_hierarchy()'),
+//   and the genes' annotations.  Each namespace is a tree with 'SYNTHETIC_GO_BRANCHING' children per term
+static int write_synthetic_GO_data( const vector <TSynthetic_Gene> & Genes, TBenchmark_Random * const Random )
+{
+	const string GO_namespaces[]  = { GO_BIO_PROC_ID, GO_CELL_COMP_ID, GO_MOL_FUNC_ID };
+	const string hierarchy_file_names[] = { GO_HIERARCHY_BP_FILE_NAME, GO_HIERARCHY_CC_FILE_NAME, GO_HIERARCHY_MF_FILE_NAME };
+	const string evidence_codes[] = { "IDA", "IMP", "IPI", "ISS", "IEA" };
+
+	ostringstream obo_oss;
+	obo_oss << "format-version: 1.2\n"
+			<< "data-version: synthetic\n"
+			<< "ontology: go\n\n";
+
+	unsigned int GO_id = 1;
+	vector <vector <string> > term_names( NUM_GO_NAMESPACES, vector <string>( 0 ) );
+
+
+	for( unsigned int namespace_it = 0; namespace_it < NUM_GO_NAMESPACES; namespace_it++ )
+	{
+		const string & name_space = GO_namespaces[namespace_it];
+
+		const string hierarchy_header[] = { GO_HIERARCHY_NAME_HEADER, GO_HIERARCHY_LEVEL_HEADER, GO_HIERARCHY_PARENT_HEADER };
+		vector <vector <string> > hierarchy( 1, vector <string>( hierarchy_header, hierarchy_header + 3 ) );
+
+		// The namespace itself is the root term
+		const unsigned int root_id = GO_id++;
+		obo_oss << "[Term]\nid: GO:" << setw( 7 ) << setfill( '0' ) << root_id << "\nname: " << name_space << "\nnamespace: " << name_space << "\n\n";
+
+
+		// Terms are numbered in breadth-first order (the order of the hierarchy files), so the parent of term 'i' is
+		//   term 'i / SYNTHETIC_GO_BRANCHING - 1' (or the root, for the first level)
+		vector <unsigned int> term_ids( 0 );
+		vector <unsigned int> term_levels( 0 );
+
+		for( unsigned int term_it = 0; term_it < SYNTHETIC_GO_TERMS_PER_NAMESPACE; term_it++ )
+		{
+			const bool first_level = ( term_it < SYNTHETIC_GO_BRANCHING );
+			const unsigned int parent_it = ( first_level ? 0 : term_it / SYNTHETIC_GO_BRANCHING - 1 );
+
+			const string term_name   = "synthetic " + name_space + " " + get_str( term_it + 1 );
+			const string parent_name = ( first_level ? name_space : term_names[namespace_it][parent_it] );
+			const unsigned int level = ( first_level ? 1 : term_levels[parent_it] + 1 );
+
+			term_names[namespace_it].push_back( term_name );
+			term_ids.push_back( GO_id++ );
+			term_levels.push_back( level );
+
+			obo_oss << "[Term]\nid: GO:" << setw( 7 ) << setfill( '0' ) << term_ids.back() << "\nname: " << term_name << "\nnamespace: " << name_space << "\n"
+					<< "is_a: GO:" << setw( 7 ) << setfill( '0' ) << ( first_level ? root_id : term_ids[parent_it] ) << " ! " << parent_name << "\n\n";
+
+			const string row[] = { term_name, get_str( level ), parent_name };
+			hierarchy.push_back( vector <string>( row, row + 3 ) );
+		}
+
+		if( write_synthetic_table( hierarchy_file_names[namespace_it], hierarchy ) )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_synthetic_GO_data()': ", __FILE__, __LINE__ );
+		}
+	}
+
+
+	// Annotations, grouped by gene in the order of the genome
+	const string gene_info_header[] = { GENE_INFO_SYST_NAME_HEADER, GENE_INFO_GO_NAMESPACE_HEADER, GENE_INFO_GO_NAME_HEADER, GENE_INFO_GO_EVIDENCE_HEADER };
+	vector <vector <string> > gene_info( 1, vector <string>( gene_info_header, gene_info_header + 4 ) );
+
+	for( unsigned int gene_it = 0; gene_it < Genes.size(); gene_it++ )
+	{
+		const unsigned int num_annotations = 1 + Random->next_below( 4 );
+
+		for( unsigned int i = 0; i < num_annotations; i++ )
+		{
+			const unsigned int namespace_it = Random->next_below( NUM_GO_NAMESPACES );
+
+			const string row[] = { Genes[gene_it].name, GO_namespaces[namespace_it],
+								   term_names[namespace_it][ Random->next_below( SYNTHETIC_GO_TERMS_PER_NAMESPACE ) ],
+								   evidence_codes[ Random->next_below( 5 ) ] };
+			gene_info.push_back( vector <string>( row, row + 4 ) );
+		}
+	}
+
+
+	if( write_file_contents( PATH_GO_DATABASE_FOLDER, GO_DATABASE_OBO_FILE_NAME, obo_oss.str(), TRUE ) ||
+		write_synthetic_table( GENE_INFO_FILE_NAME, gene_info ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_synthetic_GO_data()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// The remaining per-gene tables read by 'determine_ORF_and_uORF_characteristics()'.  Genome-wide studies list every
+//   gene; the smaller ones list a random subset
+static int write_synthetic_gene_tables( const vector <TSynthetic_Gene> & Genes, TBenchmark_Random * const Random )
+{
+	// ------------------------------
+	// Headers
+	const string transl_effects_header[] = { uORF_TRANSL_SYST_NAME_HEADER, uORF_TRANSL_EFFECT_HEADER, uORF_TRANSL_SOURCE_HEADER, uORF_TRANSL_HYPOTHESIZED_HEADER, uORF_TRANSL_uORF_REL_POS_HEADER };
+	const string Brar_header[] 	  	= { BRAR_TRANSL_SYST_NAME_HEADER, BRAR_TRANSL_CORRELATION_HEADER, BRAR_TRANSL_uORFs_PRESET_HEADER };
+	const string McManus_header[] 	= { McMANUS_TRANSL_SYST_NAME_HEADER, McMANUS_TRANSL_IN_uORF_LIST_HEADER, McMANUS_TRANSL_RPF_REP_A_HEADER, McMANUS_TRANSL_RPF_REP_B_HEADER,
+										McMANUS_TRANSL_mRNA_REP_A_HEADER, McMANUS_TRANSL_mRNA_REP_B_HEADER };
+	const string TL_header[] 	  	= { ARRIBERE_TL_SYST_NAME_HEADER, ARRIBERE_TL_LENGTH_HEADER };
+	const string SI_header[] 	  	= { ARRIBERE_SI_SYST_NAME_HEADER, ARRIBERE_SI_SCORE_HEADER };
+	const string He_header[] 	  	= { HE_mRNA_SYST_NAME_HEADER, HE_mRNA_RATIO_UPF1_HEADER, HE_mRNA_RATIO_UPF2_HEADER, HE_mRNA_RATIO_UPF3_HEADER,
+										HE_mRNA_Q_VAL_UPF1_HEADER, HE_mRNA_Q_VAL_UPF2_HEADER, HE_mRNA_Q_VAL_UPF3_HEADER };
+	const string Lelivelt_header[]  = { LELIVELT_mRNA_SYST_NAME_HEADER, LELIVELT_mRNA_RATIO_UPF1_HEADER, LELIVELT_mRNA_RATIO_UPF2_HEADER, LELIVELT_mRNA_RATIO_UPF3_HEADER,
+										LELIVELT_mRNA_RATIO_UPF123_HEADER, LELIVELT_mRNA_Q_VAL_UPF1_HEADER, LELIVELT_mRNA_Q_VAL_UPF2_HEADER, LELIVELT_mRNA_Q_VAL_UPF3_HEADER,
+										LELIVELT_mRNA_Q_VAL_UPF123_HEADER };
+	const string binding_header[] 	= { DUTTAGUPTA_SYST_NAME_HEADER, DUTTAGUPTA_MED_ZSCORE_HEADER };
+	const string effects_header[] 	= { DUTTAGUPTA_STABILIZED_HEADER, DUTTAGUPTA_DESTABILIZED_HEADER, DUTTAGUPTA_NO_CHANGE_HEADER };
+	const string Guan_NMD_header[]  = { GUAN_NMD_SYST_NAME_HEADER, GUAN_NMD_ABUNDANCE_CHANGE_HEADER, GUAN_NMD_DIRECT_TARGET_HEADER, GUAN_NMD_MUT_HL_HEADER, GUAN_NMD_WT_HL_HEADER,
+										GUAN_NMD_FCR_HEADER, GUAN_NMD_PVAL_HEADER };
+	const string Hogan_header[] 	= { HOGAN_SYST_NAME_HEADER, HOGAN_QVAL_HEADER, HOGAN_FOLD_CHANGE_HEADER };
+	const string binding_J_header[] = { JOHANSSON_SYST_NAME_HEADER, JOHANSSON_FOLD_INCREASE_HEADER };
+	const string decay_J_header[] 	= { JOHANSSON_SYST_NAME_HEADER, JOHANSSON_60MIN_NMD2_POS_HEADER, JOHANSSON_60MIN_NMD2_NEG_HEADER };
+
+	vector <vector <string> > transl_effects ( 1, vector <string>( transl_effects_header, transl_effects_header + 5 ) );
+	vector <vector <string> > Brar 		     ( 1, vector <string>( Brar_header, 	   Brar_header 		+ 3 ) );
+	vector <vector <string> > McManus 	     ( 1, vector <string>( McManus_header,   McManus_header 	+ 6 ) );
+	vector <vector <string> > TL_lengths     ( 1, vector <string>( TL_header, 		   TL_header 		+ 2 ) );
+	vector <vector <string> > SI_scores      ( 1, vector <string>( SI_header, 		   SI_header 		+ 2 ) );
+	vector <vector <string> > He 		     ( 1, vector <string>( He_header, 		   He_header 		+ 7 ) );
+	vector <vector <string> > Lelivelt       ( 1, vector <string>( Lelivelt_header,  Lelivelt_header  + 9 ) );
+	vector <vector <string> > PUB1_binding   ( 1, vector <string>( binding_header,   binding_header   + 2 ) );
+	vector <vector <string> > Guan_NMD 	     ( 1, vector <string>( Guan_NMD_header,  Guan_NMD_header  + 7 ) );
+	vector <vector <string> > Hogan_PUB1     ( 1, vector <string>( Hogan_header, 	   Hogan_header 	+ 3 ) );
+	vector <vector <string> > Hogan_UPF1     ( 1, vector <string>( Hogan_header, 	   Hogan_header 	+ 3 ) );
+	vector <vector <string> > Johansson_bind ( 1, vector <string>( binding_J_header, binding_J_header + 2 ) );
+	vector <vector <string> > Johansson_decay( 1, vector <string>( decay_J_header,   decay_J_header   + 3 ) );
+
+	vector <string> half_lives_header( 1, DUTTAGUPTA_SYST_NAME_HEADER );
+	for( unsigned int j = 1; j <= DUTTAGUPTA_NUM_HL_EXPERIMENTS; j++ )
+	{
+		half_lives_header.push_back( DUTTAGUPTA_WT_PREFIX_HEADER 	 + get_str( j ) + DUTTAGUPTA_HL_SUFFIX_HEADER   );
+		half_lives_header.push_back( DUTTAGUPTA_WT_PREFIX_HEADER 	 + get_str( j ) + DUTTAGUPTA_PVAL_SUFFIX_HEADER );
+		half_lives_header.push_back( DUTTAGUPTA_MUTANT_PREFIX_HEADER + get_str( j ) + DUTTAGUPTA_HL_SUFFIX_HEADER   );
+		half_lives_header.push_back( DUTTAGUPTA_MUTANT_PREFIX_HEADER + get_str( j ) + DUTTAGUPTA_PVAL_SUFFIX_HEADER );
+	}
+	vector <vector <string> > PUB1_half_lives( 1, half_lives_header );
+
+	vector <vector <string> > PUB1_effect_genes( 3, vector <string>( 0 ) );
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Rows
+	for( unsigned int gene_it = 0; gene_it < Genes.size(); gene_it++ )
+	{
+		const TSynthetic_Gene & Gene = Genes[gene_it];
+		const string & name = Gene.name;
+		const bool has_uORFs = ( Gene.uORFs.empty() == FALSE );
+
+		if( has_uORFs == TRUE && Random->next_below( 100 ) < SYNTHETIC_TRANSL_EFFECT_PERCENT )
+		{
+			// A blank position means the responsible uORF isn't known
+			const string rel_pos = ( Random->next_below( 2 ) == 0 ? get_str( Gene.uORFs[0].rel_pos ) : "" );
+			const string row[] = { name, ( Random->next_below( 2 ) == 0 ? "Decrease" : "Increase" ), "Synthetic", ( Random->next_below( 2 ) == 0 ? "Y" : "N" ), rel_pos };
+			transl_effects.push_back( vector <string>( row, row + 5 ) );
+		}
+
+		if( Random->next_below( 100 ) < SYNTHETIC_BRAR_GENE_PERCENT )
+		{
+			const string row[] = { name, get_random_value_str( -1, 1, Random ), ( has_uORFs ? "Y" : "N" ) };
+			Brar.push_back( vector <string>( row, row + 3 ) );
+		}
+
+		{
+			const string row[] = { name, ( has_uORFs ? "yes" : "no" ), get_str( (unsigned int)Random->next_below( 5000 ) ), get_str( (unsigned int)Random->next_below( 5000 ) ),
+								   get_str( (unsigned int)( 1 + Random->next_below( 5000 ) ) ), get_str( (unsigned int)( 1 + Random->next_below( 5000 ) ) ) };
+			McManus.push_back( vector <string>( row, row + 6 ) );
+		}
+
+		{
+			const string TL_row[] = { name, get_str( (unsigned int)Gene.five_prime_UTR.size() ) };
+			const string SI_row[] = { name, get_random_value_str( 0, 1, Random ) };
+			TL_lengths.push_back( vector <string>( TL_row, TL_row + 2 ) );
+			SI_scores.push_back ( vector <string>( SI_row, SI_row + 2 ) );
+		}
+
+		{
+			vector <string> He_row( 1, name );
+			for( unsigned int i = 0; i < 3; i++ ) { He_row.push_back( get_random_value_str( 0.2, 5, Random ) ); }
+			for( unsigned int i = 0; i < 3; i++ ) { He_row.push_back( get_random_value_str( 0, 0.2, Random ) ); }
+			He.push_back( He_row );
+
+			vector <string> Lelivelt_row( 1, name );
+			for( unsigned int i = 0; i < LELIVELT_mRNA_DATA_NUM_STRAINS; i++ ) { Lelivelt_row.push_back( get_random_value_str( 0.2, 5, Random ) ); }
+			for( unsigned int i = 0; i < LELIVELT_mRNA_DATA_NUM_STRAINS; i++ ) { Lelivelt_row.push_back( get_random_value_str( 0, 0.2, Random ) ); }
+			Lelivelt.push_back( Lelivelt_row );
+		}
+
+		{
+			const string row[] = { name, get_random_value_str( -3, 3, Random ) };
+			PUB1_binding.push_back( vector <string>( row, row + 2 ) );
+
+			vector <string> half_lives_row( 1, name );
+			for( unsigned int i = 0; i < 2 * DUTTAGUPTA_NUM_HL_EXPERIMENTS; i++ )
+			{
+				half_lives_row.push_back( get_random_value_str( 2, 60, Random ) );
+				half_lives_row.push_back( get_random_value_str( 0, 0.1, Random ) );
+			}
+			PUB1_half_lives.push_back( half_lives_row );
+		}
+
+		if( Random->next_below( 100 ) < SYNTHETIC_DUTTAGUPTA_GENE_PERCENT )
+		{
+			PUB1_effect_genes[ Random->next_below( 3 ) ].push_back( name );
+		}
+
+		if( Random->next_below( 100 ) < SYNTHETIC_GUAN_NMD_GENE_PERCENT )
+		{
+			const string row[] = { name, ( Random->next_below( 2 ) == 0 ? GUAN_NMD_GENE_HIGHER_ABUNDANCE : GUAN_NMD_GENE_LOWER_ABUNDANCE ),
+								   ( Random->next_below( 2 ) == 0 ? GUAN_NMD_GENE_DIRECT_TARGET : GUAN_NMD_GENE_INDIRECT_TARGET ),
+								   get_random_value_str( 2, 60, Random ), get_random_value_str( 2, 60, Random ), get_random_value_str( 0.2, 5, Random ), get_random_value_str( 0, 0.1, Random ) };
+			Guan_NMD.push_back( vector <string>( row, row + 7 ) );
+		}
+
+		{
+			const string PUB1_row[] = { name, get_random_value_str( 0, 20, Random ), get_random_value_str( 0.2, 5, Random ) };
+			const string UPF1_row[] = { name, get_random_value_str( 0, 20, Random ), get_random_value_str( 0.2, 5, Random ) };
+			Hogan_PUB1.push_back( vector <string>( PUB1_row, PUB1_row + 3 ) );
+			Hogan_UPF1.push_back( vector <string>( UPF1_row, UPF1_row + 3 ) );
+
+			const string bind_row[]  = { name, get_random_value_str( 0.2, 5, Random ) };
+			const string decay_row[] = { name, get_random_value_str( 0.2, 5, Random ), get_random_value_str( 0.2, 5, Random ) };
+			Johansson_bind.push_back ( vector <string>( bind_row,  bind_row  + 2 ) );
+			Johansson_decay.push_back( vector <string>( decay_row, decay_row + 3 ) );
+		}
+	}
+
+
+	// The lists of Pub1p effects are side by side, so the shorter columns are padded
+	unsigned int num_effect_rows = max( PUB1_effect_genes[0].size(), max( PUB1_effect_genes[1].size(), PUB1_effect_genes[2].size() ) );
+	vector <vector <string> > PUB1_effects( 1 + num_effect_rows, vector <string>( 3, "" ) );
+
+	for( unsigned int col_it = 0; col_it < 3; col_it++ )
+	{
+		PUB1_effects[0][col_it] = effects_header[col_it];
+		for( unsigned int i = 0; i < PUB1_effect_genes[col_it].size(); i++ ) { PUB1_effects[i + 1][col_it] = PUB1_effect_genes[col_it][i]; }
+	}
+
+	add_title_rows( &McManus, 		  McMANUS_TRANSL_HEADER_ROW, 		  "Synthetic translation data" );
+	add_title_rows( &PUB1_binding, 	  DUTTAGUPTA_PUB1_BINDING_HEADER_ROW, "Synthetic Pub1p binding"    );
+	add_title_rows( &PUB1_effects, 	  DUTTAGUPTA_PUB1_EFFECTS_HEADER_ROW, "Synthetic Pub1p effects"    );
+	add_title_rows( &PUB1_half_lives, DUTTAGUPTA_PUB1_HL_HEADER_ROW, 	  "Synthetic mRNA half lives"  );
+	add_title_rows( &Guan_NMD, 		  GUAN_NMD_GENES_HEADER_ROW, 		  "Synthetic NMD targets" 	   );
+	// ------------------------------
+
+
+
+	if( write_synthetic_table( uORFs_TRANSL_EFFIC_FILE_NAME, 	  transl_effects  ) ||
+		write_synthetic_table( BRAR_TRANSL_DATA_FILE_NAME, 		  Brar 			  ) ||
+		write_synthetic_table( McMANUS_TRANSL_DATA_FILE_NAME, 	  McManus 		  ) ||
+		write_synthetic_table( ARRIBERE_TL_LENGTHS_FILE_NAME, 	  TL_lengths 	  ) ||
+		write_synthetic_table( ARRIBERE_SI_SCORES_FILE_NAME, 	  SI_scores 	  ) ||
+		write_synthetic_table( HE_mRNA_ABUNDANCE_FILE_NAME, 	  He 			  ) ||
+		write_synthetic_table( LELIVELT_mRNA_ABUNDANCE_FILE_NAME, Lelivelt 		  ) ||
+		write_synthetic_table( DUTTAGUPTA_PUB1_BINDING_FILE_NAME, PUB1_binding 	  ) ||
+		write_synthetic_table( DUTTAGUPTA_PUB1_EFFECTS_FILE_NAME, PUB1_effects 	  ) ||
+		write_synthetic_table( DUTTAGUPTA_PUB1_mRNA_HL_FILE_NAME, PUB1_half_lives ) ||
+		write_synthetic_table( GUAN_NMD_TRANSCRIPTS_FILE_NAME, 	  Guan_NMD 		  ) ||
+		write_synthetic_table( HOGAN_PUB1_DATA_FILE_NAME, 		  Hogan_PUB1 	  ) ||
+		write_synthetic_table( HOGAN_UPF1_DATA_FILE_NAME, 		  Hogan_UPF1 	  ) ||
+		write_synthetic_table( JOHANSSON_mRNA_UPF1_BIND_FILE_NAME, Johansson_bind ) ||
+		write_synthetic_table( JOHANSSON_mRNA_DECAY_FILE_NAME, 	  Johansson_decay )    )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_synthetic_gene_tables()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// Write a complete synthetic input dataset, at the paths the program reads from (relative to the working directory),
+//   with 'num_genes' genes spread over a 'genome_size_nt' genome.  'uORF_gene_percent' of the genes have between 1 and
+//   'max_uORFs_per_gene' uORFs.  The same parameters always produce the same dataset
+int generate_synthetic_dataset( const unsigned long genome_size_nt,
+								const unsigned int num_genes,
+								const unsigned int uORF_gene_percent,
+								const unsigned int max_uORFs_per_gene )
+{
+	if( num_genes < NUM_S_CEREVISIAE_CHROM || max_uORFs_per_gene == 0 || max_uORFs_per_gene > SYNTHETIC_MAX_uORF_CODONS - SYNTHETIC_MIN_uORF_CODONS + 1 )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'generate_synthetic_dataset()': Invalid dataset parameters. ", __FILE__, __LINE__ );
+	}
+
+
+	TBenchmark_Random Random;
+
+	vector <string> chrom_seqs;
+	vector <TSynthetic_Gene> Genes;
+
+	generate_synthetic_genome( genome_size_nt, num_genes, uORF_gene_percent, max_uORFs_per_gene, &chrom_seqs, &Genes, &Random );
+
+	vector <unsigned long> chrom_lengths( 0 );
+	for( unsigned int i = 0; i < chrom_seqs.size(); i++ ) { chrom_lengths.push_back( chrom_seqs[i].size() ); }
+
+
+	// The genome is written (and freed) first, since it's by far the largest part of the dataset
+	if( write_synthetic_gff( chrom_seqs, Genes ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'generate_synthetic_dataset()': ", __FILE__, __LINE__ );
+	}
+
+	vector <string>().swap( chrom_seqs );
+
+
+	if( write_synthetic_uORF_sources   ( Genes, &Random ) ||
+		write_synthetic_TSS_data 	   ( Genes, &Random ) ||
+		write_synthetic_read_densities ( chrom_lengths, Genes, &Random ) ||
+		write_synthetic_GO_data 	   ( Genes, &Random ) ||
+		write_synthetic_gene_tables    ( Genes, &Random )    )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'generate_synthetic_dataset()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +61,68 @@
 // #define WRITE_GENE_LIST_TO_FILE
    #define WRITE_GENE_AND_uORFs_TO_FASTA
 // #define ADD_COL_TO_MCMANUS_TRANSL_DATA
+// #define CALC_CODING_AND_NONCODING_AMI										// AMI profiles of the coding and noncoding regions (see 'NT_PAIR_STATS_REGIONS')
+// #define RUN_QUERY_DAEMON												// Load the database once, then answer queries until "QUIT" (see 'uORF__query.h')
+
+
+
+// Logging
+#define MIN_LOG_LEVEL						LOG_LEVEL_DEBUG				// LOG_LEVEL_DEBUG / LOG_LEVEL_INFO / LOG_LEVEL_WARNING / LOG_LEVEL_ERROR
+
+
+
+// Profiling
+// #define ENABLE_STAGE_TRACING										// Writes stage timings to PATH_OUTPUT_FOLDER (no overhead when disabled)
+
+
+
+// Parallelism
+#define NUM_WORKER_THREADS					0							// Threads used by 'parallel_for()' (0 = one per hardware thread)
+#define CONTEXT_PROFILE_GRAIN_SIZE			64							// uORFs claimed at a time by each thread in 'calc_mod_AMI_uORF_context()'
+#define AMI_PROFILE_GRAIN_SIZE				8							// Genes claimed at a time by each thread in 'calc_AMI_uORFs()'
+#define PARALLEL_SORT_MIN_RUN_SIZE			4096						// Fewest items sorted by each thread in 'parallel_stable_sort()'
+#define COMPRESSED_READ_CHUNK_SIZE			4194304						// Bytes of an input file read (and decompressed) at a time by 'TChunk_Reader' (see 'support__compressed_io.h')
+
+
+
+// Context Profiles
+#define CONTEXT_PROFILE_ALIGNMENT			64							// Bytes to which the matrix of uORF context profiles is aligned (one cache line)
+#define CONTEXT_PROFILE_FILE_VALUE_TYPE		PROFILE_VALUE_UINT16		// PROFILE_VALUE_UINT16 / PROFILE_VALUE_FLOAT:  width of the values written to uORF_CONTEXT_PROFILES_FILE_NAME
+
+
+
+// Error Handling
+#define DATASET_PARSE_ERROR_POLICY			TASK_ERROR_ABORT			// TASK_ERROR_ABORT / TASK_ERROR_SKIP:  datasets that fail to parse are left out
+#define GO_ANNOTATION_ERROR_POLICY			TASK_ERROR_ABORT			// TASK_ERROR_ABORT / TASK_ERROR_SKIP:  rows of the GO annotation table naming unknown terms
+
+
+
+// Query Daemon
+#define QUERY_DAEMON_SOCKET_PATH			"uORF_query.sock"			// POSIX only:  queries are also answered from clients of this local socket ("" = stdin only)
+
+
+
+// File I/O
+// #define ENABLE_DIRECT_IO											// POSIX only:  read large inputs with 'O_DIRECT' (bypasses the page cache, so only
+																	//   worthwhile for inputs read once that are too large to stay cached)
+#define DIRECT_IO_MIN_FILE_SIZE				268435456					// Smallest input (in bytes) read with 'O_DIRECT' when enabled
+
+#define WRITE_COLUMNAR_uORF_LIST									// Also write the uORF list as a columnar binary file (see 'support__columnar_io.h')
+#define COLUMNAR_ROW_GROUP_SIZE				65536						// Rows of a columnar file written (and read back) together
+
+
+
+// Benchmarks (see the "Benchmarks" build configuration)
+#define BENCHMARK_MIN_BATCH_TIME_MS			50							// Iterations per batch are doubled until a batch takes at least this long
+#define BENCHMARK_NUM_BATCHES				5							// Timed batches per kernel (the median batch is reported)
+#define BENCHMARK_RANDOM_SEED				20141110					// Seed for the synthetic inputs, so every run times the same data
+
+#define BENCHMARK_PIPELINE_SCALES			1, 10, 100					// Multiples of a yeast-sized synthetic dataset that the pipeline stages are timed on
+#define SYNTHETIC_GENOME_SIZE_NT			12000000					// Per unit of scale (always split evenly across 'NUM_S_CEREVISIAE_CHROM' chromosomes)
+#define SYNTHETIC_NUM_GENES					6000						// Per unit of scale
+#define SYNTHETIC_uORF_GENE_PERCENT			25							// Percentage of genes with uORFs in their 5' UTR
+#define SYNTHETIC_MAX_uORFs_PER_GENE		3
+#define SYNTHETIC_GO_TERMS_PER_NAMESPACE	1000						// Not scaled, since the size of the GO hierarchy doesn't depend on the genome
 
 
 
@@ -69,6 +131,12 @@
 
 
 
+// Nucleotide Pair Statistics
+#define NT_PAIR_STATS_REGIONS				NT_PAIR_REGIONS_ORIGINAL	// NT_PAIR_REGIONS_ORIGINAL / NT_PAIR_REGIONS_GENOME_PARTITION:  regions counted by 'calc_joint_prob_nt_genes()/_TL()'
+																	//   and 'CALC_CODING_AND_NONCODING_AMI'
+
+
+
 // Sorting
 #define GO_NAMESPACE_TO_SORT_BY				GO_BIO_PROC_ID				// GO_BIO_PROC_ID /	GO_CELL_COMP_ID / GO_MOL_FUNC_ID
 
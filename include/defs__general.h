@@ -17,16 +17,22 @@
 //   Example complete filepath:
 //   "C:\Users\Garin\College\microORF\yeast"
 
-#define PATH_FOLDER_SEPARATOR          		"\\"
+#ifdef _WIN32
+	#define PATH_FOLDER_SEPARATOR      		"\\"
+#else
+	#define PATH_FOLDER_SEPARATOR      		"/"
+#endif
 
 // Note: For these file paths to work, the application must be located in a file within "C:\\Users\\Garin\\College\\Research_Sayood"
-#define PATH_DATA_FOLDER					"..\\data"					   	// "C:\\Users\\Garin\\College\\Research_Sayood\\data"
-#define PATH_DATA_SOURCE_FOLDER				"..\\data_source"				// "C:\\Users\\Garin\\College\\Research_Sayood\\data_source"
-#define PATH_OUTPUT_FOLDER					"..\\output"				   	// "C:\\Users\\Garin\\College\\Research_Sayood\\output"
-#define PATH_CLUSTER_OUTPUT_FOLDER			"..\\output\\clusters"			// "C:\\Users\\Garin\\College\\Research_Sayood\\output\\clusters"
-#define PATH_PROGRAM_LOG_FOLDER				"..\\program_logs"				// "C:\\Users\\Garin\\College\\Research_Sayood\\output"
-#define PATH_GO_DATABASE_FOLDER				"..\\GO_database"				// "C:\\Users\\Garin\\College\\Research_Sayood\\output"
-#define PATH_S_CEREVISIA_FASTA_FOLDER		"..\\data\\S_cerevisiae_genome"	// "C:\\Users\\Garin\\College\\Research_Sayood\\data\\S_cerevisiae_genome"
+//   (the paths are relative, and use the separator of the platform built for)
+#define PATH_DATA_FOLDER					".." PATH_FOLDER_SEPARATOR "data"										// "C:\\Users\\Garin\\College\\Research_Sayood\\data"
+#define PATH_DATA_SOURCE_FOLDER				".." PATH_FOLDER_SEPARATOR "data_source"								// "C:\\Users\\Garin\\College\\Research_Sayood\\data_source"
+#define PATH_OUTPUT_FOLDER					".." PATH_FOLDER_SEPARATOR "output"										// "C:\\Users\\Garin\\College\\Research_Sayood\\output"
+#define PATH_CLUSTER_OUTPUT_FOLDER			PATH_OUTPUT_FOLDER PATH_FOLDER_SEPARATOR "clusters"						// "C:\\Users\\Garin\\College\\Research_Sayood\\output\\clusters"
+#define PATH_BENCHMARK_OUTPUT_FOLDER		PATH_OUTPUT_FOLDER PATH_FOLDER_SEPARATOR "benchmarks"					// "C:\\Users\\Garin\\College\\Research_Sayood\\output\\benchmarks"
+#define PATH_PROGRAM_LOG_FOLDER				".." PATH_FOLDER_SEPARATOR "program_logs"								// "C:\\Users\\Garin\\College\\Research_Sayood\\output"
+#define PATH_GO_DATABASE_FOLDER				".." PATH_FOLDER_SEPARATOR "GO_database"								// "C:\\Users\\Garin\\College\\Research_Sayood\\output"
+#define PATH_S_CEREVISIA_FASTA_FOLDER		PATH_DATA_FOLDER PATH_FOLDER_SEPARATOR "S_cerevisiae_genome"			// "C:\\Users\\Garin\\College\\Research_Sayood\\data\\S_cerevisiae_genome"
 
 
 #define PRAC_CSV_FILE_NAME 					"prac_csv.csv"
@@ -56,8 +62,14 @@
 
 #define uORF_LIST_FILE_NAME_PREFIX 			"uORF_list"
 #define GENE_LIST_FILE_NAME 				"gene_list.txt"
+#define uORF_AMI_PROFILES_FILE_NAME			"uORF_AMI_profiles.bin"
+#define uORF_CONTEXT_PROFILES_FILE_NAME		"uORF_context_profiles.bin"
 
 #define PROGRAM_LOG_FILE_NAME_SUFFIX		"__uORF_program_log"
+#define STAGE_TRACE_FILE_NAME_SUFFIX		"__uORF_stage_trace"
+#define KERNEL_BENCHMARK_FILE_NAME_SUFFIX	"__uORF_kernel_benchmarks"
+#define PIPELINE_BENCHMARK_FILE_NAME_SUFFIX	"__uORF_pipeline_benchmarks"
+#define BENCHMARK_INPUT_CSV_FILE_NAME		"benchmark_input.csv"
 
 #define GO_DATABASE_OBO_FILE_NAME			"go-basic.obo"
 
@@ -125,6 +137,10 @@
 #define GFF_FILE_EXTENSION 					".gff"
 #define CSV_FILE_EXTENSION 					".csv"
 #define TXT_FILE_EXTENSION 					".txt"
+#define JSON_FILE_EXTENSION 				".json"
+#define COLUMNAR_FILE_EXTENSION 			".ucol"
+#define GZIP_FILE_EXTENSION 				".gz"						// Compressed inputs may also be stored under their own name + this extension
+#define PARTIAL_FILE_EXTENSION 				".partial"					// Outputs are written under their own name + this extension, then renamed once complete
 	
 #define GFF_FILE_FASTA_ID					"##FASTA\n"
 
@@ -505,6 +521,9 @@
 #define NUM_NT_TO_COMPLETE_CODON			2
 #define NUM_NT_MATCH_uORF_SEQUENCE			9
 
+#define NUM_CODONS							64					// NUM_DIFF_NT ^ 3
+#define NUM_READING_FRAMES					3
+
 
 #define MIN_NUM_BASES_APART					5
 #define MAX_NUM_BASES_APART					500
@@ -611,6 +630,14 @@
 #define NO							0
 #define YES							1
 
+#ifndef FALSE								// Otherwise provided by <windows.h>
+	#define FALSE					0
+#endif
+
+#ifndef TRUE
+	#define TRUE					1
+#endif
+
 #define SUCCESSFUL					0		// Represents that an operation succeeded
 #define NOT_SUCCESSFUL				1		// Represents that an operation failed
 
@@ -684,6 +711,9 @@
 #define SORT_ORFS_BY_GO_TERMS		1
 #define DONT_SORT_ORFS				2
 
+#define NT_PAIR_REGIONS_ORIGINAL			0		// Whole CDS spans, fixed windows near the CDS, and concatenated coding/noncoding DNA
+#define NT_PAIR_REGIONS_GENOME_PARTITION	1		// Segments of a 'TGenome_Partition' (introns left out, TL's from the TSS, no pairs across segments)
+
 #define ALL_COLUMNS					0
 #define ALL_PERTINENT_COLUMNS		1
 #define CANONICAL_uORF_COLUMNS		2
@@ -697,6 +727,20 @@
 #define UPPER_CASE					2
 #define SYMBOL						3
 
+#define LOG_LEVEL_DEBUG				0		// Log levels, in increasing order of severity (see 'MIN_LOG_LEVEL')
+#define LOG_LEVEL_INFO				1
+#define LOG_LEVEL_WARNING			2
+#define LOG_LEVEL_ERROR				3
+
+#define LOG_TO_CONSOLE_AND_FILE		0
+#define LOG_TO_CONSOLE_ONLY			1
+#define LOG_TO_FILE_ONLY			2
+
+#define LOG_THREAD_BUFFER_SIZE		4096				// Bytes buffered by a thread before handing them to the log flusher
+#define LOG_MAX_LATENCY_MS			100					// Maximum time logged text waits in a thread's buffer before being written
+#define LOG_MAX_QUEUED_BYTES		( 4 * 1024 * 1024 )	// Bytes queued for the flusher before logging threads wait for it
+#define LOG_FILE_CHUNK_SIZE			( 64 * 1024 )		// Size of the chunks in which the program log file is written
+
 #define MILLISECONDS				0
 #define SECONDS						1
 #define MINUTES						2
@@ -719,6 +763,9 @@
 #define NONFATAL					1				// Represents that an error shouldn't end the program
 #define PASS_UP_ONE_LEVEL			2				// Represents that an error should be passed up to the calling function
 
+#define TASK_ERROR_ABORT			0				// A task (gene, row, ...) run by a 'TError_Collector' that fails stops the loop, which then ends the program
+#define TASK_ERROR_SKIP				1				// A task that fails is skipped, and the loop continues (failures are reported once it ends)
+
 #endif // DEFS_H
 
 
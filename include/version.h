@@ -273,6 +273,87 @@
 //		- Added 'cluster_uORF_context_profiles()' to cluster uORFs based on their context profile vectors
 //		  (uses externals function 'lbg_clustering()' to perform LBG clustering
 //
+//	v0.1.6 - 2026/10/19 - Garin Newcomb
+//		- Added 'support__profiling...' files with 'TStage_Timer', a scoped timer that records wall time, CPU time, peak RSS,
+//		  and item counts for a stage, and 'TStage_Trace_Log', which writes the records to Chrome trace (.json) and .csv files
+//			- Timed each stage of 'main()' and each loader in 'compile_uORF_list_from_data()' and 
+//			  'determine_ORF_and_uORF_characteristics()'
+//			- Enabled with 'ENABLE_STAGE_TRACING' in 'defs__appl_parameters.h'; the trace macros expand to nothing otherwise
+//		- Added 'support__logging...' files with 'TLog_Backend', which buffers console and program log output per thread and
+//		  writes it from a background thread, spooling the program log to a temporary file rather than holding it in memory
+//			- 'output_text...()' functions and 'TProgram_Log' now write through 'Log_Backend'; console output is flushed
+//			  once per batch (and before waiting on user input) rather than after every line
+//			- Added optional log level to 'output_text_line()' and 'output_text()', filtered by 'MIN_LOG_LEVEL' in
+//			  'defs__appl_parameters.h'
+//			- Now building with '-std=gnu++11 -pthread' (required for 'std::thread')
+//		- Added "Benchmarks" build configuration (the program's sources, less "main.cpp", plus the 'benchmarks' folder)
+//			- Times the most frequently called functions on fixed synthetic inputs, reporting ns/op and throughput and
+//			  writing the results to a .json file in PATH_BENCHMARK_OUTPUT_FOLDER
+//			- Added runtime log level ('TLog_Backend::set_min_log_level()') so that the functions' progress output can
+//			  be silenced while they're timed
+//			- Added synthetic dataset generator ('generate_synthetic_dataset()'), which writes a yeast-like genome .gff and
+//			  every uORF source, TSS, read density, GO, and per-gene table in the formats the program reads
+//			- Times each stage of 'main()' on generated datasets at each of 'BENCHMARK_PIPELINE_SCALES' (wall time, CPU
+//			  time, and peak RSS per stage)
+//		- Added 'support__parallel...' files with 'parallel_for()', which spreads per-item work across 'NUM_WORKER_THREADS'
+//		  threads (each owning a contiguous range of items, stealing half of another's range once its own is finished)
+//		- 'calc_mod_AMI_uORF_context()' now profiles the uORFs in parallel, ranking each context nucleotide once (rather
+//		  than comparing both nucleotides of each pair against all 16 pairs), then records the profiles in uORF order
+//		- Removed unused per-k nucleotide counts from 'calc_mod_AMI_uORF_context()'
+//		- Added 'support__packed_genome...' files with 'TPacked_Chrom', which stores a chromosome at 2 bits per nucleotide,
+//		  and 'TStrand_View', which reads either strand of one without copying it
+//		- 'TFasta_Content::sequence' is now packed and shared by every stage; the chromosome-based functions
+//		  ('extract_DNA_seq()', 'find_first_stop_codon()', 'uORF_analysis()', etc.) take a 'TPacked_Chrom'
+//		- Crick-strand sequences are decoded as reverse complements directly, rather than by inverting and
+//		  complementing a copy; the joint probability functions no longer build a complemented copy of the genome
+//		- The 'extract_uORFs_...()' functions no longer copy the chromosome for each gene
+//		- The dataset files read in 'determine_ORF_and_uORF_characteristics()' are parsed concurrently; each
+//		  dataset is still added to the ORFs in the original order (see 'parallel_pipeline()')
+//		- 'TORF_Data::get_CDI()' sums over sparse TL read/TSS events ('TTSS_Profile') instead of filling a
+//		  dense TSS distribution per uORF; the fixed 'max_upstream'/'min_downstream' extents are gone
+//		- Input files may be gzip- or BGZF-compressed (stored under their own name, or with '.gz' added), and are
+//		  recognized by their first bytes.  They're read and decompressed a chunk at a time ('TChunk_Reader'), on a
+//		  prefetch thread while the previous chunk is parsed (BGZF blocks in parallel), or on demand from within a
+//		  parallel task.  Links zlib
+//		- File system calls moved to 'support__filesystem' (Windows and POSIX); paths use the platform's separator,
+//		  inputs are read in one sequential pass, and outputs are written to a '.partial' file and renamed when complete
+//		- Gene names, GO terms/evidence codes, and data sources are interned ('support__intern'):  each record holds a
+//		  32-bit symbol ID, so 'find_ORF()', 'find_GO_term()', and related comparisons are integer compares
+//		- Spliced sequences are read through a transcript's 'TExon_Map' (built once per ORF) directly into the caller's
+//		  buffer; 'find_first_stop_codon()' no longer builds a string and intron list for each codon
+//		- Errors raised within a task run by a 'TError_Collector' (dataset parsing, GO annotation rows) are collected
+//		  rather than ending the program from a worker thread; per-loop policies ('defs__appl_parameters.h') allow
+//		  failed items to be skipped, with all collected errors reported once the loop ends
+//		- Added a query daemon ('RUN_QUERY_DAEMON', 'uORF__query'):  loads the database once, then answers GENE / UORFS /
+//		  GO queries from stdin and a local socket; 'RELOAD' swaps in a new snapshot without interrupting queries
+//		- Query snapshots index the uORFs by position (implicit interval tree per chromosome/strand, 'REGION' queries)
+//		  and by AUGCAI, CDI, prob_of_translation, distortion, and cluster; 'UORFS' starts from the narrowest indexed range
+//		- 'extract_field_views()' extracts several kinds of fields from a GFF file in one pass, as views into the file
+//		  text (specs sharing a start delimiter share its search, and repeats are found with a hash set)
+//		- 'calc_AMI_uORFs()' profiles genes in parallel from 2-bit nucleotide ranks with a shared log table, and writes
+//		  every uORF's AMI profile to a binary matrix ('uORF_AMI_profiles.bin')
+//		- 'TGenome_Partition' classifies both strands of the genome once into coding, 5' TL, intronic, and intergenic
+//		  segments; the nucleotide pair statistics count over strand views rather than copied sequence, and count
+//		  over the partition's segments when 'NT_PAIR_STATS_REGIONS' selects them (by default, the original regions)
+//		- The coding/noncoding AMI flow in 'main()' is now enabled by 'CALC_CODING_AND_NONCODING_AMI' rather than
+//		  commented out
+//		- 'count_uORF_codons()' counts packed 6-bit codons in all three frames (optionally by cluster or data source)
+//		  into per-thread 'TCodon_Histogram's, merged once done; 'get_uORFs()' returns a const reference
+//		- 'realign_uORF()' finds the window's start codons in one pass and checks each candidate's stop codon by reading
+//		  only that codon from the packed chromosome
+//		- Context profiles are rows of one aligned 'TContext_Profile_Matrix', clustered in place (no copied training set)
+//		  and written as a single block of 16-bit counts ('uORF_context_profiles.bin')
+//		- 'get_Arribere_Cap_Distance_index()' streams the TATL-seq reads a row at a time ('TLine_Reader') into per-chromosome
+//		  position/density arrays, calculating each chromosome's CDIs and releasing its reads once its columns end
+//		- Nucleotide codes, pair ranks, and complements come from compile-time tables in 'support__bioinformatics.h'
+//		  (with branch-free bulk 'encode/rank/decode/complement_nt_seq()') in place of per-nucleotide switches and the
+//		  16-way pair comparisons of 'calc_joint_prob_nt_genome()/sequence()'; each caller has a kernel benchmark
+//		- 'sort_and_consolidate()' and 'sort_ORFs_by_GO_terms()' sort compact (key, index) 'TORF_Sort_Key's with
+//		  'parallel_stable_sort()' and move the ORFs into the sorted order once ('permute_ORFs()')
+//		- Also write the uORF list as a columnar binary file ('support__columnar_io.h'):  typed integer and double columns,
+//		  dictionary-encoded string columns, and row groups that 'TColumnar_Reader' reads one at a time (and only the
+//		  columns asked for)
+//
 //==============================================================================
 
 
@@ -305,7 +386,7 @@
 
 #define uORF_APPLICATION_NAME         	"uORF_project.exe"
 
-#define uORF_APPL_VERSION_NUMBER		"0.1.5"
+#define uORF_APPL_VERSION_NUMBER		"0.1.6"
 
 ////////////////////////////////////////////////////////////////////////////////
 
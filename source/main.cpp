@@ -40,7 +40,6 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
-#include <windows.h>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -59,6 +58,8 @@ using namespace std;
 #include "uORF__process.h"
 #include "support__general.h"
 #include "support__bioinformatics.h"
+#include "support__profiling.h"
+#include "uORF__query.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -134,6 +135,16 @@ int main()
 
 
 
+	// ------------------------------
+	// Load the uORF database once, then answer queries about it (from stdin and a local socket) until told to quit
+	#ifdef RUN_QUERY_DAEMON
+		run_query_daemon();
+		return Program_Log.print_log_to_file( PATH_PROGRAM_LOG_FOLDER, uORF_APPL_VERSION_NUMBER, SUCCESSFUL );
+	#endif
+	// ------------------------------
+
+
+
 	// ------------------------------
 	// Convert a DNA sequence to its translated Amino Acid sequence
 	#ifdef CONVERT_DNA_SEQ_TO_AA
@@ -151,12 +162,14 @@ int main()
 	
 	// ------------------------------
 	// Read in and parse the S. cerevisiae GFF
+	TRACE_STAGE_BEGIN( trace_read_genome, "get_contents_from_gff", "main" );
 	TFasta_Content * S_Cerevisiae_Chrom = new TFasta_Content( PATH_S_CEREVISIA_FASTA_FOLDER, S_CEREVISIAE_GFF_FILE_NAME );
 	
 	if( S_Cerevisiae_Chrom->get_contents_from_gff() )
 	{
 		Errors.handle_error( FATAL, "", __FILE__, __LINE__ );
 	}
+	TRACE_STAGE_END( trace_read_genome, S_Cerevisiae_Chrom->sequence.size() );
 	// ------------------------------
 
 
@@ -173,7 +186,7 @@ int main()
 
 		for( unsigned int i = 0; i < S_Cerevisiae_Chrom->sequence.size(); i++ )
 		{
-			unsigned int first_inst = find_AA_seq( S_Cerevisiae_Chrom->sequence[i], AA_seq, 1);
+			unsigned int first_inst = find_AA_seq( S_Cerevisiae_Chrom->sequence[i].substr( 0 ), AA_seq, 1);
 
 			AA_find_oss << "AA_seq_pos in chrom " << i << ": " << ( i < 10 ? " " : "" )
 						<< ( first_inst == S_Cerevisiae_Chrom->sequence[i].size() ? 0 : first_inst ) << "\n";
@@ -201,54 +214,93 @@ int main()
 	// Compile the list of uORFs and write to CSV
 	vector <TORF_Data> * ORF_Data = new vector <TORF_Data>;
 
+	TRACE_STAGE_BEGIN( trace_compile, "compile_uORF_list", "main" );
 	compile_uORF_list( *S_Cerevisiae_Chrom, ORF_Data );
+	TRACE_STAGE_END( trace_compile, ORF_Data->size() );
+	
+	TRACE_STAGE_BEGIN( trace_consolidate, "sort_and_consolidate", "main" );
 	sort_and_consolidate( ORF_Data );
+	TRACE_STAGE_END( trace_consolidate, ORF_Data->size() );
+	
+	TRACE_STAGE_BEGIN( trace_characteristics, "determine_ORF_and_uORF_characteristics", "main" );
 	determine_ORF_and_uORF_characteristics( *S_Cerevisiae_Chrom, ORF_Data );
+	TRACE_STAGE_END( trace_characteristics, ORF_Data->size() );
+	
+	TRACE_STAGE_BEGIN( trace_write_csv, "write_uORFs_to_csv", "main" );
 	write_uORFs_to_csv( *ORF_Data, uORF_COLUMN_SELECTION_TYPE, uORFs_TO_PRINT, OUTPUT_FILE_NAMING_METHOD );
+	TRACE_STAGE_END( trace_write_csv, ORF_Data->size() );
 	// ------------------------------
 	
 
 	
 	////////////////////////////////////////////////////////////////////////////////
 	// Alternative Program Flows - After uORF list compilation/processing
-	/*
-	vector <vector <double> > joint_prob_nt_coding;
-	vector <vector <double> > joint_prob_nt_noncoding;
-	vector <double> marginal_prob_nt_coding;
-	vector <double> marginal_prob_nt_noncoding;
-	
-	vector <string> coding_DNA   ( 0 );
-	vector <string> noncoding_DNA( 0 );
-	
-	get_coding_and_noncoding_DNA( *S_Cerevisiae_Chrom, &coding_DNA, &noncoding_DNA );
-	
 
-	for( unsigned int i = 1; i < coding_DNA.size(); i++ )
-	{
-		coding_DNA[0].append   ( coding_DNA[i]    );
-		noncoding_DNA[0].append( noncoding_DNA[i] );
+	// ------------------------------
+	// If desired, calculate the AMI profiles of the coding and noncoding regions
+	#ifdef CALC_CODING_AND_NONCODING_AMI
+		vector <vector <double> > joint_prob_nt_coding;
+		vector <vector <double> > joint_prob_nt_noncoding;
+		vector <double> marginal_prob_nt_coding;
+		vector <double> marginal_prob_nt_noncoding;
+	
+		#if( NT_PAIR_STATS_REGIONS == NT_PAIR_REGIONS_GENOME_PARTITION )
+			TGenome_Partition genome_partition;
+			build_genome_partition( *S_Cerevisiae_Chrom, *ORF_Data, &genome_partition );
 		
-		coding_DNA.erase   ( coding_DNA.begin()    + 1 );
-		noncoding_DNA.erase( noncoding_DNA.begin() + 1 );
+			vector <Tenum_genome_segment_types> noncoding_segment_types;
+			noncoding_segment_types.push_back( SEGMENT_INTERGENIC );
+			noncoding_segment_types.push_back( SEGMENT_5_PRIME_TL );
+			noncoding_segment_types.push_back( SEGMENT_INTRONIC   );
 		
-		i--;
-	}
-	
-	cout << "size of coding region: " << coding_DNA[0].size() << endl;
-	cout << "size of noncoding region: " << noncoding_DNA[0].size() << endl;
-	
-	unsigned int genome_size = 0;
-	
-	for( unsigned int i = 0; i < NUM_S_CEREVISIAE_CHROM; i++ ) { genome_size += 1 * S_Cerevisiae_Chrom->sequence[i].size(); }
-	cout << "genome size: " << genome_size << endl;
+			output_text_line( "size of coding region: "    + get_str( (unsigned int)genome_partition.get_num_nt( SEGMENT_CODING ) ), LOG_LEVEL_DEBUG );
+			output_text_line( "size of noncoding region: " + get_str( (unsigned int)( genome_partition.get_num_nt( SEGMENT_INTERGENIC ) + genome_partition.get_num_nt( SEGMENT_5_PRIME_TL ) + 
+																					   genome_partition.get_num_nt( SEGMENT_INTRONIC ) ) ), LOG_LEVEL_DEBUG );
+		
+			// The partition covers both strands
+			unsigned int genome_size = 0;
+		
+			for( unsigned int i = 0; i < NUM_S_CEREVISIAE_CHROM; i++ ) { genome_size += 2 * S_Cerevisiae_Chrom->sequence[i].size(); }
+			output_text_line( "genome size (both strands): " + get_str( genome_size ), LOG_LEVEL_DEBUG );
+		
+			calc_joint_prob_nt_segments( genome_partition, vector <Tenum_genome_segment_types>( 1, SEGMENT_CODING ), &joint_prob_nt_coding, &marginal_prob_nt_coding );
+			calc_joint_prob_nt_segments( genome_partition, noncoding_segment_types, 	  		  					  &joint_prob_nt_noncoding, &marginal_prob_nt_noncoding );
+			//calc_joint_prob_nt_TL( genome_partition, *ORF_Data, &joint_prob_nt, &marginal_prob_nt );
+		#else
+			vector <string> coding_DNA   ( 0 );
+			vector <string> noncoding_DNA( 0 );
+		
+			get_coding_and_noncoding_DNA( *S_Cerevisiae_Chrom, &coding_DNA, &noncoding_DNA );
+		
+
+			for( unsigned int i = 1; i < coding_DNA.size(); i++ )
+			{
+				coding_DNA[0].append   ( coding_DNA[i]    );
+				noncoding_DNA[0].append( noncoding_DNA[i] );
+			
+				coding_DNA.erase   ( coding_DNA.begin()    + 1 );
+				noncoding_DNA.erase( noncoding_DNA.begin() + 1 );
+			
+				i--;
+			}
+		
+			output_text_line( "size of coding region: "    + get_str( (unsigned int)coding_DNA[0].size()    ), LOG_LEVEL_DEBUG );
+			output_text_line( "size of noncoding region: " + get_str( (unsigned int)noncoding_DNA[0].size() ), LOG_LEVEL_DEBUG );
+		
+			unsigned int genome_size = 0;
+		
+			for( unsigned int i = 0; i < NUM_S_CEREVISIAE_CHROM; i++ ) { genome_size += 1 * S_Cerevisiae_Chrom->sequence[i].size(); }
+			output_text_line( "genome size: " + get_str( genome_size ), LOG_LEVEL_DEBUG );
+		
+			calc_joint_prob_nt_sequence( coding_DNA[0], &joint_prob_nt_coding,    	 &marginal_prob_nt_coding    );
+			calc_joint_prob_nt_sequence( noncoding_DNA[0], &joint_prob_nt_noncoding, &marginal_prob_nt_noncoding );
+		#endif
 	
-	calc_joint_prob_nt_sequence( coding_DNA[0], &joint_prob_nt_coding,    	 &marginal_prob_nt_coding    );
-	calc_joint_prob_nt_sequence( noncoding_DNA[0], &joint_prob_nt_noncoding, &marginal_prob_nt_noncoding );
-	//calc_joint_prob_nt_TL( S_Cerevisiae_Chrom, ORF_Data, &joint_prob_nt, &marginal_prob_nt );
+		calculate_AMI_profile( *S_Cerevisiae_Chrom, *ORF_Data, joint_prob_nt_coding,    marginal_prob_nt_coding    );
+		calculate_AMI_profile( *S_Cerevisiae_Chrom, *ORF_Data, joint_prob_nt_noncoding, marginal_prob_nt_noncoding );
+	#endif
+	// ------------------------------
 	
-	calculate_AMI_profile( *S_Cerevisiae_Chrom, *ORF_Data, joint_prob_nt_coding,    marginal_prob_nt_coding    );
-	calculate_AMI_profile( *S_Cerevisiae_Chrom, *ORF_Data, joint_prob_nt_noncoding, marginal_prob_nt_noncoding );
-	*/
 	//calc_AMI_uORFs( *S_Cerevisiae_Chrom, *ORF_Data );
 	//count_uORF_codons( *ORF_Data );
 
@@ -267,7 +319,9 @@ int main()
 	
 	// ------------------------------
 	#ifdef WRITE_GENE_AND_uORFs_TO_FASTA
+		TRACE_STAGE_BEGIN( trace_write_fasta, "write_sequences_to_fasta", "main" );
 		write_sequences_to_fasta( *ORF_Data );
+		TRACE_STAGE_END( trace_write_fasta, ORF_Data->size() );
 	#endif
 	// ------------------------------
 	
@@ -290,6 +344,9 @@ int main()
 	// ------------------------------
 
 
+	WRITE_STAGE_TRACE( PATH_OUTPUT_FOLDER );
+
+
 	return Program_Log.print_log_to_file( PATH_PROGRAM_LOG_FOLDER, uORF_APPL_VERSION_NUMBER, SUCCESSFUL );
 }
 //==============================================================================
@@ -43,11 +43,11 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <windows.h>
 #include <string>
 #include <vector>
 #include <algorithm>      // For 'reverse()'
 #include <cmath>      	  // For 'pow()'
+#include <cstring>     	  // For 'strcmp()'
 
 using namespace std;
 
@@ -87,15 +87,104 @@ extern TErrors Errors;						// Stores information about errors and responds to t
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+//==============================================================================
+
+TExon_Map::TExon_Map( const vector <TFeature> & untransl_reg, const bool transcr_opposite_strand ) :
+	introns( untransl_reg ),
+	opposite_strand( transcr_opposite_strand )
+{
+	// Introns are listed in transcript order by the annotation, but sort them in case they weren't
+	if( opposite_strand == FALSE )
+	{
+		stable_sort( introns.begin(), introns.end(), []( const TFeature & a, const TFeature & b ) { return a.start_coord < b.start_coord; } );
+	}
+	else/*( opposite_strand == TRUE )*/
+	{
+		stable_sort( introns.begin(), introns.end(), []( const TFeature & a, const TFeature & b ) { return a.start_coord > b.start_coord; } );
+	}
+}
+//------------------------------------------------------------------------------
+
+
+// Writes the 'len' nucleotides of the spliced transcript starting at 'start_coord' (1-indexed, on the transcript's
+//   strand) to 'dest', which must hold 'len' characters.  An intron is skipped if it starts after the first codon (or after
+//   the first nucleotide, if 'remove_untransl_reg_in_first_codon' is TRUE) and before the sequence ends.  Returns the
+//   number of nucleotides written, which is less than 'len' only if the sequence runs past the end of the chromosome
+size_t TExon_Map::extract( const TPacked_Chrom & chrom_seq,
+						   const unsigned int start_coord,
+						   const unsigned int len,
+						   char * const dest,
+						   const bool remove_untransl_reg_in_first_codon ) const
+{
+	if( len == 0 ) { return 0; }
+	
+	unsigned int first_coord_it;
+	if	  ( opposite_strand == FALSE )  { first_coord_it = start_coord - 1; 			  }
+	else/*( opposite_strand == TRUE )*/ { first_coord_it = start_coord - 1 - ( len - 1 ); }
+	
+	unsigned long last_coord_it = first_coord_it + len - 1;
+	if( last_coord_it >= chrom_seq.size() )
+	{
+		Errors.handle_error( FATAL, "Error in 'TExon_Map::extract()': Sequence specified was out of range. ", __FILE__, __LINE__ );
+	}
+	
+	
+	// Skip past the introns which start before the sequence (or within its first codon)
+	const int search_start_adj = ( remove_untransl_reg_in_first_codon == TRUE ) ? 0 : NUM_NT_TO_COMPLETE_CODON;
+	
+	unsigned int intron_it = 0;
+	
+	while( intron_it < introns.size() &&
+		   ( ( opposite_strand == FALSE && (int)introns[intron_it].start_coord <= (int)start_coord + search_start_adj ) ||
+			 ( opposite_strand == TRUE  && (int)introns[intron_it].start_coord >= (int)start_coord - search_start_adj ) ) )
+	{
+		intron_it++;
+	}
+	
+	
+	// Then copy the exonic sections between the introns (in transcript order), until 'len' nucleotides have been copied.  On the
+	//   Crick strand, each section's reverse complement is copied, so together they form the reverse complement of the whole
+	int curr_coord = start_coord;  // Next coordinate to copy (1-indexed)
+	unsigned int num_nt_remaining = len;
+	size_t num_nt_written = 0;
+	
+	for( ; intron_it < introns.size(); intron_it++ )
+	{
+		int section_length = ( opposite_strand == FALSE ) ? (int)introns[intron_it].start_coord - curr_coord : curr_coord - (int)introns[intron_it].start_coord;
+		
+		if( section_length >= (int)num_nt_remaining ) { break; }
+		if( section_length < 0 ) { section_length = 0; }  // Only if introns overlap
+		
+		if	  ( opposite_strand == FALSE )  { num_nt_written += chrom_seq.copy_seq( curr_coord - 1, 			 section_length, FALSE, dest + num_nt_written ); }
+		else/*( opposite_strand == TRUE )*/ { num_nt_written += chrom_seq.copy_seq( curr_coord - section_length, section_length, TRUE,  dest + num_nt_written ); }
+		
+		num_nt_remaining -= section_length;
+		
+		curr_coord = introns[intron_it].start_coord + ( (int)introns[intron_it].length * ( opposite_strand == FALSE ? 1 : -1 ) );
+	}
+	
+	if	  ( opposite_strand == FALSE )  { num_nt_written += chrom_seq.copy_seq( curr_coord - 1, 				 num_nt_remaining, FALSE, dest + num_nt_written ); }
+	else/*( opposite_strand == TRUE )*/ { num_nt_written += chrom_seq.copy_seq( curr_coord - num_nt_remaining, num_nt_remaining, TRUE,  dest + num_nt_written ); }
+	
+	
+	return num_nt_written;
+}
+//------------------------------------------------------------------------------
+
+//==============================================================================
+
+
+
 
 
 void TGO_Annotation::add_term( const string & GO_term_name, const string & GO_term_evidence, const unsigned int GO_term_level, const std::string GO_term_parent )
 {
+	const TInterned_String GO_term_symbol( GO_term_name );
 	unsigned int curr_it = 0;
 	
 	while( curr_it < GO_Terms.size() )
 	{
-		if( GO_term_name == GO_Terms[ curr_it ].name )
+		if( GO_term_symbol == GO_Terms[ curr_it ].name )
 		{
 			return;
 		}
@@ -104,7 +193,7 @@ void TGO_Annotation::add_term( const string & GO_term_name, const string & GO_te
 	}
 	
 	
-	GO_Terms.push_back( TGO_Term( GO_term_name, GO_term_evidence, GO_term_level, GO_term_parent ) );
+	GO_Terms.push_back( TGO_Term( GO_term_symbol, GO_term_evidence, GO_term_level, GO_term_parent ) );
 	
 	return;
 }
@@ -122,7 +211,7 @@ string TGO_Annotation::format_terms_list( void ) const
 	// Only add the terms that were explicitly obtained from SGD (i.e. the terms that have evidence codes)
 	for( unsigned int i = 0; i < GO_Terms.size(); i++ )
 	{
-		if( GO_Terms[i].evidence != "" )
+		if( GO_Terms[i].evidence.empty() == FALSE )
 		{
 			terms_list_vect.push_back(  GO_Terms[i].name );
 		}
@@ -194,16 +283,11 @@ double TCalculate_AUGCAI::calc( const string & start_context ) const
 	double AUGCAI_product = 1;
 	for( unsigned int nt_pos_it = 0; nt_pos_it < NUM_AUGCAI_POSITIONS; nt_pos_it++ )
 	{
-		unsigned int nt_it = 0;
+		const unsigned int nt_it = Nt_Code_Table[ (unsigned char)start_context_wo_start_codon[nt_pos_it] ];
 		
-		switch( start_context_wo_start_codon[nt_pos_it] )
+		if( nt_it == NUM_DIFF_NT )
 		{
-			case 'A' : nt_it = NT_A;  break;
-			case 'C' : nt_it = NT_C;  break;
-			case 'G' : nt_it = NT_G;  break;
-			case 'T' : nt_it = NT_T;  break;
-			
-			default: Errors.handle_error( FATAL, "Error in 'TCalculate_AUGCAI::calc()': Passed start context contains unrecognized characters. ", __FILE__, __LINE__ );
+			Errors.handle_error( FATAL, "Error in 'TCalculate_AUGCAI::calc()': Passed start context contains unrecognized characters. ", __FILE__, __LINE__ );
 		}
 		
 		AUGCAI_product *= AUGCAI_weight_matrix[nt_pos_it][nt_it];
@@ -251,6 +335,65 @@ TCalculate_AUGCAI::TCalculate_AUGCAI( void )
 	}
 }
 //==============================================================================
+
+
+
+// Count the codons of 'sequence' starting at 'first_pos' (frame 0), 'first_pos + 1' (frame 1), and 'first_pos + 2'
+//   (frame 2) in each of 'groups'.  Returns FALSE, having counted nothing, if the sequence contains any character
+//   other than 'A', 'C', 'G', or 'T'
+bool TCodon_Histogram::add_sequence( const string & sequence, const size_t first_pos, const vector <unsigned int> & groups )
+{
+	unsigned int seq_num_codons[ NUM_READING_FRAMES * NUM_CODONS ] = { 0 };
+	
+	unsigned int codon_it  = 0;
+	unsigned int frame 	   = 0;
+	unsigned int all_codes = 0;
+	
+	// Any character that isn't a nucleotide is only detected once the whole sequence has been read (its code,
+	//   NUM_DIFF_NT, still leaves the codon index in range), so that the loop has no branch on the sequence
+	for( size_t pos = first_pos; pos < sequence.size(); pos++ )
+	{
+		const unsigned int nt = Nt_Code_Table[ (unsigned char)sequence[pos] ];
+		all_codes |= nt;
+		
+		codon_it = ( ( codon_it << 2 ) | nt ) & ( NUM_CODONS - 1 );
+		
+		// The codon ending here started 2 nucleotides back
+		if( pos >= first_pos + 2 )
+		{
+			seq_num_codons[ frame * NUM_CODONS + codon_it ]++;
+			
+			frame = ( frame + 1 < NUM_READING_FRAMES ) ? frame + 1 : 0;
+		}
+	}
+	
+	if( ( all_codes & NUM_DIFF_NT ) != 0 ) { return FALSE; }
+	
+	
+	for( unsigned int i = 0; i < groups.size(); i++ )
+	{
+		unsigned int * const group_num_codons = &num_codons[ groups[i] * NUM_READING_FRAMES * NUM_CODONS ];
+		
+		for( unsigned int j = 0; j < NUM_READING_FRAMES * NUM_CODONS; j++ ) { group_num_codons[j] += seq_num_codons[j]; }
+	}
+	
+	return TRUE;
+}
+//------------------------------------------------------------------------------
+
+
+void TCodon_Histogram::merge( const TCodon_Histogram & histogram )
+{
+	if( histogram.num_groups != num_groups )
+	{
+		Errors.handle_error( FATAL, "Error in 'TCodon_Histogram::merge()': Histograms have different numbers of groups. ", __FILE__, __LINE__ );
+	}
+	
+	for( unsigned int i = 0; i < num_codons.size(); i++ ) { num_codons[i] += histogram.num_codons[i]; }
+	
+	return;
+}
+//==============================================================================
 	
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -264,7 +407,7 @@ TCalculate_AUGCAI::TCalculate_AUGCAI( void )
 //
 ////////////////////////////////////////////////////////////////////////////////
 
-void request_sel_sequence( const vector <string> & yeast_chromosomes )
+void request_sel_sequence( const vector <TPacked_Chrom> & yeast_chromosomes )
 {
 	bool request_another_seq = FALSE;
 	output_text_line( "" );
@@ -310,10 +453,7 @@ void request_sel_sequence( const vector <string> & yeast_chromosomes )
 		}
 		else/*( end_nucleotide < start_nucleotide )*/
 		{
-			sequence = yeast_chromosomes[sel_chrom - 1].substr( end_nucleotide - 1, ( start_nucleotide - end_nucleotide + 1 ) );
-			
-			sequence = get_inverted_sequence( sequence );
-			sequence = get_opposite_strand  ( sequence );
+			sequence = yeast_chromosomes[sel_chrom - 1].get_seq( end_nucleotide - 1, ( start_nucleotide - end_nucleotide + 1 ), TRUE );
 		}
 		
 		
@@ -342,147 +482,22 @@ void request_sel_sequence( const vector <string> & yeast_chromosomes )
 
 
 
-// Note that this interface is 1-indexed to reflect coordinates in the chromosome, rather than iterators in the string
-string extract_DNA_seq( const string & chrom_seq,
+// Note that this interface is 1-indexed to reflect coordinates in the chromosome, rather than iterators in the string.
+//   Callers extracting many sequences from one transcript should build its 'TExon_Map' once and call 'extract()' directly
+string extract_DNA_seq( const TPacked_Chrom & chrom_seq,
 						unsigned int start_coord, 
 						const unsigned int len, 
 						const bool opposite_strand, 
-						const vector <TFeature> untransl_reg, 
+						const vector <TFeature> & untransl_reg, 
 						const bool remove_untransl_reg_in_first_codon )
 {
-	if( len == 0 ) { return ""; }
-	
-	unsigned int first_coord_it;
-	if	  ( opposite_strand == FALSE )  { first_coord_it = start_coord - 1; 			  }
-	else/*( opposite_strand == TRUE )*/ { first_coord_it = start_coord - 1 - ( len - 1 ); }
+	string sequence( len, 'A' );
 	
-	unsigned long last_coord_it = first_coord_it + len - 1;
-	if( last_coord_it >= chrom_seq.size() )
+	if( len != 0 )
 	{
-		Errors.handle_error( FATAL, "Error in 'extract_DNA_seq()': Sequence specified was out of range. ", __FILE__, __LINE__ );
+		sequence.resize( TExon_Map( untransl_reg, opposite_strand ).extract( chrom_seq, start_coord, len, &sequence[0], remove_untransl_reg_in_first_codon ) );
 	}
 	
-	
-	string sequence = "";
-	
-	// If there aren't any untranslated regions, the sequence can be extracted as is
-	if( untransl_reg.empty() == TRUE )
-	{
-		sequence = chrom_seq.substr( first_coord_it, len );
-	}
-	
-	// If there are any untranslated regions, check if they interfere with the sequence, then remove them
-	else
-	{
-		vector <TFeature> interfering_reg;
-	
-		unsigned int len_w_untrans = len;
-		
-		// An untranslated region interferes with the sequence if it starts between the sequence start and the place the sequence would end
-		//  in the absence of any untranslated regions
-		for( unsigned int i = 0; i < untransl_reg.size(); i++ )
-		{
-			
-			bool untransl_reg_start_after_seq_start  = FALSE;
-			bool untransl_reg_start_before_seq_end   = FALSE;
-			
-			int search_start_adj = ( remove_untransl_reg_in_first_codon == TRUE ) ? 0 : NUM_NT_TO_COMPLETE_CODON;
-			
-			if( ( opposite_strand == FALSE && ( (int)start_coord + search_start_adj - (int)untransl_reg[i].start_coord ) < 0 ) ||
-				( opposite_strand == TRUE  && ( (int)start_coord - search_start_adj - (int)untransl_reg[i].start_coord ) > 0 ) ) 
-			{
-				untransl_reg_start_after_seq_start = TRUE;
-			}
-			
-			if( ( opposite_strand == FALSE && ( (int)start_coord + (int)( len_w_untrans - 1 ) - (int)untransl_reg[i].start_coord ) >= 0 ) ||
-				( opposite_strand == TRUE  && ( (int)start_coord - (int)( len_w_untrans - 1 ) - (int)untransl_reg[i].start_coord ) <= 0 ) )
-			{
-				untransl_reg_start_before_seq_end = TRUE;
-			}
-			
-
-			if( untransl_reg_start_after_seq_start == TRUE && untransl_reg_start_before_seq_end == TRUE )
-			{
-				interfering_reg.push_back( untransl_reg[i] );
-				len_w_untrans += untransl_reg[i].length;
-			}
-		}
-
-
-		// Calculate the iterators for the first and last coordinates of the sequence once the untranslated regions are removed
-		if	  ( opposite_strand == FALSE )  { last_coord_it  = first_coord_it + ( len_w_untrans - 1 ); }
-		else/*( opposite_strand == TRUE  )*/{ first_coord_it = last_coord_it  - ( len_w_untrans - 1 ); }
-	
-
-		// Add the portions of the sequence iteratively by extracting the regions between/before/after the untranslated regions
-		unsigned int section_first_coord_it = first_coord_it;
-		
-		unsigned int section_length = len;
-		if( interfering_reg.empty() == FALSE )
-		{
-			if( opposite_strand == FALSE )
-			{
-				section_length = abs( ( (int)section_first_coord_it + 1 ) - (int)interfering_reg[0].start_coord );
-			}
-			else/*( opposite_strand == TRUE )*/
-			{
-				section_first_coord_it = (int)interfering_reg[0].start_coord;
-				section_length 		   = last_coord_it - section_first_coord_it + 1;
-			}
-		}
-			
-
-		for( unsigned int i = 0; i < interfering_reg.size() + 1; i++ )
-		{
-			// First add the sequence between the start coordinate and the farthest upstream untranslated region (section length and start coordinate calculated above
-			
-			// Then add the sequences between the untranslated regions
-			if( i > 0 )
-			{
-				if( i < interfering_reg.size() )
-				{
-					if( opposite_strand == FALSE )
-					{
-						section_first_coord_it = interfering_reg[i - 1].start_coord + interfering_reg[i - 1].length - 1;
-					}
-					else/*( opposite_strand == TRUE )*/
-					{
-						section_first_coord_it = interfering_reg[i].start_coord;
-					}
-						
-					section_length = abs( (int)interfering_reg[i].start_coord - (int)interfering_reg[i - 1].start_coord ) - interfering_reg[i - 1].length;
-				}
-				
-				// Finally add the sequence between the farthest downstream unstranslated region and the sequence end coordinate
-				else/*( i == interfering_reg.size() )*/
-				{
-					if( opposite_strand == FALSE )
-					{
-						section_first_coord_it = interfering_reg[i - 1].start_coord + interfering_reg[i - 1].length - 1;
-						section_length = ( last_coord_it + 1 ) - interfering_reg[i - 1].start_coord - interfering_reg[i - 1].length + 1;
-					}
-					else/*( opposite_strand == TRUE )*/
-					{
-						section_first_coord_it = first_coord_it;
-						section_length = interfering_reg[i - 1].start_coord - interfering_reg[i - 1].length - ( first_coord_it + 1 ) + 1;
-					}
-				}
-			}
-
-			
-			// Add the iterative sequence
-			if	  ( opposite_strand == FALSE )  { sequence = sequence + chrom_seq.substr( section_first_coord_it, section_length ); }
-			else/*( opposite_strand == FALSE )*/{ sequence = chrom_seq.substr( section_first_coord_it, section_length ) + sequence; }
-		}
-	}
-	
-	if( opposite_strand == TRUE )
-	{
-		sequence = get_inverted_sequence( sequence );
-		sequence = get_opposite_strand  ( sequence );
-	}
-	
-	
 	return sequence;
 }
 //==============================================================================
@@ -507,25 +522,7 @@ string get_opposite_strand( const string strand )
 {
 	string opposite_strand = strand;
 	
-	for( unsigned int i = 0; i < strand.size(); i++ )
-	{
-		switch( strand[i] )
-		{
-			case 'A' : 	opposite_strand[i] = 'T';
-						break;
-						
-			case 'T' : 	opposite_strand[i] = 'A';
-						break;
-						
-			case 'C' : 	opposite_strand[i] = 'G';
-						break;
-						
-			case 'G' : 	opposite_strand[i] = 'C';
-						break;
-						
-			default  : 	break;
-		}
-	}
+	complement_nt_seq( strand.data(), strand.size(), &opposite_strand[0] );
 	
 	return opposite_strand;
 }
@@ -704,7 +701,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 {
 	// ------------------------------
 	// Find the start coordinate of the gene's first CDS
-	unsigned int first_gene_cds_pos = gff_annotation.find ( (string)"Name=" + gene_name + "_CDS;" );
+	size_t first_gene_cds_pos = gff_annotation.find ( (string)"Name=" + gene_name + "_CDS;" );
 	
 
 	if( first_gene_cds_pos == string::npos ) 
@@ -715,7 +712,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 	}
 	
 
-	unsigned int first_CDS_id_pos = gff_annotation.rfind( "SGD	CDS", first_gene_cds_pos );
+	size_t first_CDS_id_pos = gff_annotation.rfind( "SGD	CDS", first_gene_cds_pos );
 	
 	
 	if( first_CDS_id_pos == string::npos || first_CDS_id_pos < gff_annotation.rfind( "\n", first_gene_cds_pos ) ) 
@@ -732,7 +729,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 	string first_cds_info = gff_annotation.substr( first_CDS_id_pos, ( first_gene_cds_pos - first_CDS_id_pos + 1 ) );
 	
 	
-	unsigned int gene_first_coord_start_pos = find_first_digit_or_char( DIGIT, first_cds_info );
+	size_t gene_first_coord_start_pos = find_first_digit_or_char( DIGIT, first_cds_info );
 	
 	if( gene_first_coord_start_pos == string::npos ) 
 	{
@@ -741,7 +738,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 	}
 	
-	unsigned int gene_first_coord_end_pos = find_last_digit_or_char( DIGIT, first_cds_info, gene_first_coord_start_pos );
+	size_t gene_first_coord_end_pos = find_last_digit_or_char( DIGIT, first_cds_info, gene_first_coord_start_pos );
 	unsigned int gene_first_coord_len = gene_first_coord_end_pos - gene_first_coord_start_pos + 1;
 	// ------------------------------
 	
@@ -749,7 +746,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 	
 	// ------------------------------
 	// Find the end coordinate of the gene's last CDS
-	unsigned int last_gene_cds_pos  = gff_annotation.rfind( (string)"Name=" + gene_name + "_CDS;" );
+	size_t last_gene_cds_pos  = gff_annotation.rfind( (string)"Name=" + gene_name + "_CDS;" );
 	if( last_gene_cds_pos == string::npos ) 
 	{
 		ostringstream error_oss;
@@ -757,7 +754,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 	}
 	
-	unsigned int last_CDS_id_pos  = gff_annotation.rfind( "SGD	CDS", last_gene_cds_pos );
+	size_t last_CDS_id_pos  = gff_annotation.rfind( "SGD	CDS", last_gene_cds_pos );
 	
 	if( last_CDS_id_pos == string::npos || last_CDS_id_pos < gff_annotation.rfind( "\n", last_gene_cds_pos ) )
 	{
@@ -771,11 +768,11 @@ int get_gene_coord_from_gff( const string & gene_name,
 	
 	string last_cds_info  = gff_annotation.substr( last_CDS_id_pos,  ( last_gene_cds_pos  - last_CDS_id_pos  + 1 ) );
 	
-	unsigned int last_cds_first_coord_start_pos = find_first_digit_or_char( DIGIT, last_cds_info );
-	unsigned int last_cds_first_coord_end_pos   = find_last_digit_or_char( DIGIT, last_cds_info, last_cds_first_coord_start_pos );
+	size_t last_cds_first_coord_start_pos = find_first_digit_or_char( DIGIT, last_cds_info );
+	size_t last_cds_first_coord_end_pos   = find_last_digit_or_char( DIGIT, last_cds_info, last_cds_first_coord_start_pos );
 	
 	
-	unsigned int gene_second_coord_start_pos = find_first_digit_or_char( DIGIT, last_cds_info, ( last_cds_first_coord_end_pos + 1 ) );
+	size_t gene_second_coord_start_pos = find_first_digit_or_char( DIGIT, last_cds_info, ( last_cds_first_coord_end_pos + 1 ) );
 	
 	if( gene_second_coord_start_pos == string::npos ) 
 	{
@@ -785,7 +782,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 	}
 	
 	
-	unsigned int gene_second_coord_end_pos = find_last_digit_or_char ( DIGIT, last_cds_info, gene_second_coord_start_pos );
+	size_t gene_second_coord_end_pos = find_last_digit_or_char ( DIGIT, last_cds_info, gene_second_coord_start_pos );
 	unsigned int gene_second_coord_len 	   = gene_second_coord_end_pos - gene_second_coord_start_pos + 1;
 	// ------------------------------
 	
@@ -817,7 +814,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 	//  Once the previous CDS is found, determine the start of the intergenic region by bisecting the intergenic region between the previous
 	//  CDS and the CDS of interest.
 	*gene_intergen_start_coord = *gene_start_coord;
-	unsigned int prev_cds_id_pos = first_CDS_id_pos;
+	size_t prev_cds_id_pos = first_CDS_id_pos;
 	
 	while( *gene_intergen_start_coord == *gene_start_coord )
 	{
@@ -846,10 +843,10 @@ int get_gene_coord_from_gff( const string & gene_name,
 		
 		if( prev_cds_info.size() != 0 )
 		{
-			unsigned int prev_cds_first_coord_start_pos  = find_first_digit_or_char( DIGIT, prev_cds_info 			    	 				);
-			unsigned int prev_cds_first_coord_end_pos    = find_last_digit_or_char ( DIGIT, prev_cds_info, prev_cds_first_coord_start_pos   );
-			unsigned int prev_cds_second_coord_start_pos = find_first_digit_or_char( DIGIT, prev_cds_info, prev_cds_first_coord_end_pos + 1 );
-			unsigned int prev_cds_second_coord_end_pos   = find_last_digit_or_char ( DIGIT, prev_cds_info, prev_cds_second_coord_start_pos  );
+			size_t prev_cds_first_coord_start_pos  = find_first_digit_or_char( DIGIT, prev_cds_info 			    	 				);
+			size_t prev_cds_first_coord_end_pos    = find_last_digit_or_char ( DIGIT, prev_cds_info, prev_cds_first_coord_start_pos   );
+			size_t prev_cds_second_coord_start_pos = find_first_digit_or_char( DIGIT, prev_cds_info, prev_cds_first_coord_end_pos + 1 );
+			size_t prev_cds_second_coord_end_pos   = find_last_digit_or_char ( DIGIT, prev_cds_info, prev_cds_second_coord_start_pos  );
 			
 			unsigned int prev_cds_second_coord = atoi( prev_cds_info.substr ( prev_cds_second_coord_start_pos, prev_cds_second_coord_end_pos - prev_cds_second_coord_start_pos + 1 ).c_str() );
 			unsigned int prev_cds_first_coord  = atoi( prev_cds_info.substr ( prev_cds_first_coord_start_pos,  prev_cds_first_coord_end_pos  - prev_cds_first_coord_start_pos  + 1 ).c_str() );
@@ -880,15 +877,15 @@ int get_gene_coord_from_gff( const string & gene_name,
 	{
 		string untransl_reg_info;
 		bool all_untransl_reg_extracted = FALSE;
-		unsigned int prev_untransl_pos = 0;
+		size_t prev_untransl_pos = 0;
 		
 		do
 		{
 			// Find the appropriate identifiers for the intron in the .gff and extract a substring containing the intron coordinates
-			unsigned int gene_intron_pos      = gff_annotation.find(  (string)"Name=" + gene_name + "_intron;", 						 prev_untransl_pos + 1 );
-			unsigned int gene_frameshift_pos  = gff_annotation.find(  (string)"Name=" + gene_name + "_plus_1_translational_frameshift;", prev_untransl_pos + 1 );
+			size_t gene_intron_pos      = gff_annotation.find(  (string)"Name=" + gene_name + "_intron;", 						 prev_untransl_pos + 1 );
+			size_t gene_frameshift_pos  = gff_annotation.find(  (string)"Name=" + gene_name + "_plus_1_translational_frameshift;", prev_untransl_pos + 1 );
 			
-			unsigned int gene_untransl_pos;
+			size_t gene_untransl_pos;
 			
 			if	   ( gene_intron_pos     == string::npos ) { gene_untransl_pos = gene_frameshift_pos; }
 			else if( gene_frameshift_pos == string::npos ) { gene_untransl_pos = gene_intron_pos;     }
@@ -915,7 +912,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 			}
 			else
 			{
-				unsigned int nontran_id_pos = 0;
+				size_t nontran_id_pos = 0;
 				
 				if( gene_intron_pos < gene_frameshift_pos )
 				{
@@ -939,7 +936,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 				
 				
 				// Extract the start and end coordinates of the non-translated region
-				unsigned int untransl_first_coord_start_pos = find_first_digit_or_char( DIGIT, untransl_reg_info );
+				size_t untransl_first_coord_start_pos = find_first_digit_or_char( DIGIT, untransl_reg_info );
 				
 				if( untransl_first_coord_start_pos == string::npos ) 
 				{
@@ -948,14 +945,14 @@ int get_gene_coord_from_gff( const string & gene_name,
 					return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 				}
 				
-				unsigned int untransl_first_coord_end_pos = find_last_digit_or_char( DIGIT, untransl_reg_info, untransl_first_coord_start_pos );
+				size_t untransl_first_coord_end_pos = find_last_digit_or_char( DIGIT, untransl_reg_info, untransl_first_coord_start_pos );
 				
 				unsigned int untransl_first_coord_len = untransl_first_coord_end_pos - untransl_first_coord_start_pos + 1;
 				unsigned int untransl_first_coord     = atoi( untransl_reg_info.substr( untransl_first_coord_start_pos, untransl_first_coord_len ).c_str() );
 				
 				
 				// Extract the second coordinate
-				unsigned int untransl_second_coord_start_pos = find_first_digit_or_char( DIGIT, untransl_reg_info, untransl_first_coord_end_pos + 1 );
+				size_t untransl_second_coord_start_pos = find_first_digit_or_char( DIGIT, untransl_reg_info, untransl_first_coord_end_pos + 1 );
 				
 				if( untransl_second_coord_start_pos == string::npos ) 
 				{
@@ -964,7 +961,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 					return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 				}
 				
-				unsigned int untransl_second_coord_end_pos = find_last_digit_or_char( DIGIT, untransl_reg_info, untransl_second_coord_start_pos );
+				size_t untransl_second_coord_end_pos = find_last_digit_or_char( DIGIT, untransl_reg_info, untransl_second_coord_start_pos );
 				
 				unsigned int untransl_second_coord_len = untransl_second_coord_end_pos - untransl_second_coord_start_pos + 1;
 				unsigned int untransl_second_coord     = atoi( untransl_reg_info.substr( untransl_second_coord_start_pos, untransl_second_coord_len ).c_str() );
@@ -998,11 +995,11 @@ int get_gene_coord_from_gff( const string & gene_name,
 	
 	// ------------------------------
 	// Now extract the 5' UTR intron information, if it exists (assume there's only one)
-	*fpUTR_intron = TFeature( string::npos, string::npos );
+	*fpUTR_intron = TFeature( (unsigned int)string::npos, (unsigned int)string::npos );
 	
 
 	// Look for the appropriate identifier for the 5' UTR intron in the .gff
-	unsigned int gene_fpUTR_intron_pos = gff_annotation.find( (string)"Name=" + gene_name + "_five_prime_UTR_intron;" );
+	size_t gene_fpUTR_intron_pos = gff_annotation.find( (string)"Name=" + gene_name + "_five_prime_UTR_intron;" );
 		
 	if( gene_fpUTR_intron_pos != string::npos ) 
 	{
@@ -1015,7 +1012,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 		}
 		
 		
-		unsigned int fpUTR_intron_id_pos = gff_annotation.rfind( "SGD	five_prime_UTR_intron", gene_fpUTR_intron_pos );
+		size_t fpUTR_intron_id_pos = gff_annotation.rfind( "SGD	five_prime_UTR_intron", gene_fpUTR_intron_pos );
 		
 		if( fpUTR_intron_id_pos == string::npos || fpUTR_intron_id_pos < gff_annotation.rfind( "\n", gene_fpUTR_intron_pos ) ) 
 		{
@@ -1030,7 +1027,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 		
 		
 		// Extract the start and end coordinates of the non-translated region
-		unsigned int fpUTR_intron_first_coord_start_pos = find_first_digit_or_char( DIGIT, fpUTR_intron_info );
+		size_t fpUTR_intron_first_coord_start_pos = find_first_digit_or_char( DIGIT, fpUTR_intron_info );
 		
 		if( fpUTR_intron_first_coord_start_pos == string::npos ) 
 		{
@@ -1039,14 +1036,14 @@ int get_gene_coord_from_gff( const string & gene_name,
 			return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 		}
 		
-		unsigned int fpUTR_intron_first_coord_end_pos = find_last_digit_or_char( DIGIT, fpUTR_intron_info, fpUTR_intron_first_coord_start_pos );
+		size_t fpUTR_intron_first_coord_end_pos = find_last_digit_or_char( DIGIT, fpUTR_intron_info, fpUTR_intron_first_coord_start_pos );
 		
 		unsigned int fpUTR_intron_first_coord_len = fpUTR_intron_first_coord_end_pos - fpUTR_intron_first_coord_start_pos + 1;
 		unsigned int fpUTR_intron_first_coord     = atoi( fpUTR_intron_info.substr( fpUTR_intron_first_coord_start_pos, fpUTR_intron_first_coord_len ).c_str() );
 		
 		
 		// Extract the second coordinate
-		unsigned int fpUTR_intron_second_coord_start_pos = find_first_digit_or_char( DIGIT, fpUTR_intron_info, fpUTR_intron_first_coord_end_pos + 1 );
+		size_t fpUTR_intron_second_coord_start_pos = find_first_digit_or_char( DIGIT, fpUTR_intron_info, fpUTR_intron_first_coord_end_pos + 1 );
 		
 		if( fpUTR_intron_second_coord_start_pos == string::npos ) 
 		{
@@ -1055,7 +1052,7 @@ int get_gene_coord_from_gff( const string & gene_name,
 			return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 		}
 		
-		unsigned int fpUTR_intron_second_coord_end_pos = find_last_digit_or_char( DIGIT, fpUTR_intron_info, fpUTR_intron_second_coord_start_pos );
+		size_t fpUTR_intron_second_coord_end_pos = find_last_digit_or_char( DIGIT, fpUTR_intron_info, fpUTR_intron_second_coord_start_pos );
 		
 		unsigned int fpUTR_intron_second_coord_len = fpUTR_intron_second_coord_end_pos - fpUTR_intron_second_coord_start_pos + 1;
 		unsigned int fpUTR_intron_second_coord     = atoi( fpUTR_intron_info.substr( fpUTR_intron_second_coord_start_pos, fpUTR_intron_second_coord_len ).c_str() );
@@ -1081,11 +1078,11 @@ int get_gene_coord_from_gff( const string & gene_name,
 
 
 // Note that this interface is 1-indexed to reflect coordinates in the chromosome, rather than iterators in the string
-unsigned int find_first_stop_codon( const string & chomosome, 
+unsigned int find_first_stop_codon( const TPacked_Chrom & chomosome, 
 									unsigned int start_pos, 
 									bool opposite_strand, 
 									unsigned int * const len, 
-									const vector <TFeature> removed_reg
+									const vector <TFeature> & removed_reg
 									/*bool search_in_frame = TRUE*/ )
 {
 	if( start_pos > chomosome.size() )
@@ -1093,9 +1090,9 @@ unsigned int find_first_stop_codon( const string & chomosome,
 		Errors.handle_error( FATAL, (string)"Error in 'find_first_stop_codon()': Specified start position exceeded the length of the passed chromosome", __FILE__, __LINE__ );
 	}
 
-	unsigned int end_pos 			= string::npos;
-	unsigned int pos_to_search 		= start_pos;
-	unsigned int prev_pos_to_search = start_pos;
+	size_t end_pos 			= string::npos;
+	size_t pos_to_search 		= start_pos;
+	size_t prev_pos_to_search = start_pos;
 	unsigned int removed_reg_it		= removed_reg.size();
 	int seq_length = 0;
 	
@@ -1165,9 +1162,11 @@ unsigned int find_first_stop_codon( const string & chomosome,
 		seq_length = abs( (int)end_pos - (int)start_pos ) + 1;
 	}
 	
-	// If untranslated regions may interfere, use 'extract_DNA_seq()' to simplify their removal
+	// If untranslated regions may interfere, use 'TExon_Map::extract()' to simplify their removal
 	else
 	{
+		const TExon_Map unspliced( vector <TFeature> ( 0 ), opposite_strand );
+		
 		prev_pos_to_search = pos_to_search + ( NUM_NT_TO_INCREMENT * ( opposite_strand == FALSE ? 1 : -1 ) );
 		
 		
@@ -1192,7 +1191,7 @@ unsigned int find_first_stop_codon( const string & chomosome,
 				removed_reg_it = removed_reg.size();
 				unsigned int curr_it = 0;
 				
-				// If the searched codon is split by an intron, record the intron to pass to 'extract_DNA_seq()'
+				// If the searched codon is split by an intron, record the intron (its length isn't counted if the codon is a stop codon)
 				do
 				{				
 					if( ( pos_to_search + NUM_NT_TO_COMPLETE_CODON ) >= removed_reg[curr_it].start_coord && pos_to_search < removed_reg[curr_it].start_coord )
@@ -1239,17 +1238,16 @@ unsigned int find_first_stop_codon( const string & chomosome,
 				} while( curr_it < removed_reg.size() && removed_reg_it == removed_reg.size() );
 			}	
 			
-			// To save time, pass only the interfering inton to 'extract_DNA_seq()'
-			vector <TFeature> interfering_reg( ( removed_reg_it == removed_reg.size() ? 0 : 1 ), 
-											   ( removed_reg_it == removed_reg.size() ? TFeature() : removed_reg[ removed_reg_it ] ) );
-											   
-			string searched_codon = extract_DNA_seq( chomosome, pos_to_search, 3, opposite_strand, interfering_reg );
+			// An intron that starts within the searched codon is not removed when extracting it (see 'TExon_Map::extract()'), so
+			//   the codon is read as is, into a buffer rather than a new string for each codon
+			char searched_codon[4];
+			searched_codon[ unspliced.extract( chomosome, pos_to_search, 3, searched_codon ) ] = '\0';
 
 			
 			// Check if the searched codon is a stopped codon
-			if( ( searched_codon == "TAA" ) ||
-				( searched_codon == "TAG" ) ||
-				( searched_codon == "TGA" ) )
+			if( ( strcmp( searched_codon, "TAA" ) == 0 ) ||
+				( strcmp( searched_codon, "TAG" ) == 0 ) ||
+				( strcmp( searched_codon, "TGA" ) == 0 ) )
 			{
 				end_pos = pos_to_search + ( NUM_NT_TO_COMPLETE_CODON * ( opposite_strand == FALSE ? 1 : -1 ) );
 				
@@ -1317,11 +1315,11 @@ void generate_simple_GO_hierarchy( void )
 			do
 			{
 				j++;
-				unsigned int prev_parent_id_pos = 0;
+				size_t prev_parent_id_pos = 0;
 				
 				do
 				{
-					unsigned int parent_id_pos = find_GO_parent_term( GO_database_contents, current_parent_term, prev_parent_id_pos );
+					size_t parent_id_pos = find_GO_parent_term( GO_database_contents, current_parent_term, prev_parent_id_pos );
 					
 					if( parent_id_pos != string::npos )
 					{
@@ -1465,7 +1463,6 @@ void generate_list_of_children( void )
 	const string TERM_ID 	  = "\nname: ";
 	const string NAMESPACE_ID = "\nnamespace: ";
 
-	unsigned int term_start_pos = GO_database_contents.find( TERM_ID ) + TERM_ID.size();
 	unsigned int term_num = 0;
 	
 	
@@ -1497,12 +1494,14 @@ void generate_list_of_children( void )
 	}
 	
 	/*
+	size_t term_start_pos = GO_database_contents.find( TERM_ID ) + TERM_ID.size();
+	
 	while( ( term_start_pos - TERM_ID.size() ) != string::npos )
 	{
-		unsigned int term_end_pos = GO_database_contents.find( '\n', term_start_pos ) - 1;
+		size_t term_end_pos = GO_database_contents.find( '\n', term_start_pos ) - 1;
 		
-		unsigned int namespace_start_pos = GO_database_contents.find( NAMESPACE_ID, term_end_pos ) + NAMESPACE_ID.size();
-		unsigned int namespace_end_pos   = GO_database_contents.find( '\n', namespace_start_pos ) -1;
+		size_t namespace_start_pos = GO_database_contents.find( NAMESPACE_ID, term_end_pos ) + NAMESPACE_ID.size();
+		size_t namespace_end_pos   = GO_database_contents.find( '\n', namespace_start_pos ) -1;
 
 		if( term_end_pos + 1 == string::npos )
 		{
@@ -1568,10 +1567,10 @@ void generate_list_of_children( void )
 
 
 
-unsigned int find_GO_parent_term( const string & GO_database_contents, const string & parent_term, const unsigned int prev_parent_id_pos )
+size_t find_GO_parent_term( const string & GO_database_contents, const string & parent_term, const size_t prev_parent_id_pos )
 {
-	unsigned int parent_id_pos;
-	unsigned int search_start_pos = prev_parent_id_pos + 1;
+	size_t parent_id_pos;
+	size_t search_start_pos = prev_parent_id_pos + 1;
 	
 	do
 	{
@@ -1586,7 +1585,7 @@ unsigned int find_GO_parent_term( const string & GO_database_contents, const str
 
 
 
-unsigned int find_GO_parent_term( const string & GO_database_contents, const int parent_term_num, const unsigned int prev_parent_id_pos )
+size_t find_GO_parent_term( const string & GO_database_contents, const int parent_term_num, const size_t prev_parent_id_pos )
 {
 	string search_str = get_str( parent_term_num );
 	
@@ -1625,7 +1624,7 @@ vector <string> get_all_children_terms( const string & GO_database_contents,
 		}*/
 
 
-		unsigned int prev_parent_id_pos = 0;
+		size_t prev_parent_id_pos = 0;
 		vector <string> children_this_term( 0 );
 		
 		unsigned int curr_term_it = (unsigned int)( find( terms_already_found.begin(), terms_already_found.end(), current_term ) - terms_already_found.begin() ) + 1;
@@ -1634,7 +1633,7 @@ vector <string> get_all_children_terms( const string & GO_database_contents,
 		{
 			do
 			{
-				unsigned int parent_id_pos = find_GO_parent_term( GO_database_contents, current_term, prev_parent_id_pos );
+				size_t parent_id_pos = find_GO_parent_term( GO_database_contents, current_term, prev_parent_id_pos );
 				
 				if( parent_id_pos != string::npos )
 				{
@@ -1697,11 +1696,11 @@ vector <string> get_all_children_terms( const string & GO_database_contents,
 vector <string> get_all_children_terms( const string & GO_database_contents, const unsigned int parent_term_num )
 {
 	vector <string> children( 0 );
-	unsigned int prev_parent_id_pos = 0;
+	size_t prev_parent_id_pos = 0;
 	
 	do
 	{
-		unsigned int parent_id_pos = find_GO_parent_term( GO_database_contents, parent_term_num, prev_parent_id_pos );
+		size_t parent_id_pos = find_GO_parent_term( GO_database_contents, parent_term_num, prev_parent_id_pos );
 		
 		if( parent_id_pos != string::npos )
 		{
@@ -1723,11 +1722,11 @@ string get_child_term( const string & GO_database_contents, const unsigned int p
 {
 	const string GO_NAME_ID = "name: ";
 	
-	unsigned int term_id_pos = GO_database_contents.rfind( GO_NAME_ID, parent_id_pos );
+	size_t term_id_pos = GO_database_contents.rfind( GO_NAME_ID, parent_id_pos );
 	
 	if( term_id_pos == string::npos) { Errors.handle_error( FATAL, "Error in 'get_child_term()': Child name identifier not found. ", __FILE__, __LINE__ ); }
 	
-	unsigned int term_start_pos = term_id_pos + GO_NAME_ID.size();
+	size_t term_start_pos = term_id_pos + GO_NAME_ID.size();
 	
 	return GO_database_contents.substr( term_start_pos, ( GO_database_contents.find( "\n", term_start_pos ) - term_start_pos ) );
 }
@@ -1735,7 +1734,7 @@ string get_child_term( const string & GO_database_contents, const unsigned int p
 
 
 
-bool is_child_descendent_of( const string & child_term, const string & parent_term, const TGO_Annotation & GO_Annotations )
+bool is_child_descendent_of( const TInterned_String & child_term, const TInterned_String & parent_term, const TGO_Annotation & GO_Annotations )
 {
 	vector <TGO_Term> all_parent_terms = get_all_parents_of( child_term, GO_Annotations );
 	
@@ -1753,7 +1752,7 @@ bool is_child_descendent_of( const string & child_term, const string & parent_te
 
 
 
-vector <TGO_Term> get_all_parents_of( const string & child_term, const TGO_Annotation & GO_Annotations )
+vector <TGO_Term> get_all_parents_of( const TInterned_String & child_term, const TGO_Annotation & GO_Annotations )
 {
 	unsigned int child_term_it = 0;
 		
@@ -1777,7 +1776,7 @@ vector <TGO_Term> get_all_parents_of( const string & child_term, const TGO_Annot
 	
 	while( curr_level >= 1 )
 	{
-		string parent_term_name = GO_Annotations.GO_Terms[parent_term_it].parent;
+		TInterned_String parent_term_name = GO_Annotations.GO_Terms[parent_term_it].parent;
 		
 		while( parent_term_it < GO_Annotations.GO_Terms.size() && GO_Annotations.GO_Terms[parent_term_it].name != parent_term_name )
 		{
@@ -1826,17 +1825,9 @@ std::vector <unsigned int> convert_DNA_string_to_num( const std::string & DNA_st
 {
 	vector <unsigned int> DNA_numeric( DNA_string.size(), NT_A );
 			
-	for(unsigned int i = 0; i < DNA_string.size(); i++ )
+	if( encode_nt_seq( DNA_string.data(), DNA_string.size(), DNA_numeric.data() ) == FALSE )
 	{
-		switch( DNA_string[i] )
-		{
-			case 'A' :						 	break;
-			case 'C' : DNA_numeric[i] = NT_C; 	break;
-			case 'G' : DNA_numeric[i] = NT_G; 	break;
-			case 'T' : DNA_numeric[i] = NT_T; 	break;
-			
-			default: Errors.handle_error( FATAL, "Error in 'convert_DNA_string_to_num()': Passed DNA string contains unrecognized characters. ", __FILE__, __LINE__ );		
-		}
+		Errors.handle_error( FATAL, "Error in 'convert_DNA_string_to_num()': Passed DNA string contains unrecognized characters. ", __FILE__, __LINE__ );		
 	}
 		
 
@@ -1850,17 +1841,9 @@ std::string convert_DNA_num_to_string( const std::vector <unsigned int> & DNA_nu
 {
 	string DNA_string( DNA_numeric.size(), 'A' );
 			
-	for(unsigned int i = 0; i < DNA_numeric.size(); i++ )
+	if( decode_nt_seq( DNA_numeric.data(), DNA_numeric.size(), &DNA_string[0] ) == FALSE )
 	{
-		switch( DNA_numeric[i] )
-		{
-			case NT_A :						 	break; 
-			case NT_C : DNA_string[i] = 'C'; 	break; 
-			case NT_G : DNA_string[i] = 'G'; 	break; 
-			case NT_T : DNA_string[i] = 'T'; 	break; 
-			
-			default: Errors.handle_error( FATAL, "Error in 'convert_DNA_num_to_string()': Passed DNA string contains unrecognized characters. ", __FILE__, __LINE__ );		
-		}
+		Errors.handle_error( FATAL, "Error in 'convert_DNA_num_to_string()': Passed DNA string contains unrecognized characters. ", __FILE__, __LINE__ );		
 	}
 		
 
@@ -1872,7 +1855,7 @@ std::string convert_DNA_num_to_string( const std::vector <unsigned int> & DNA_nu
 
 void get_coding_and_noncoding_DNA( const TFasta_Content & S_Cerevisiae_Chrom,  vector <string> * const coding_DNA, vector <string> * const noncoding_DNA )
 {
-	vector <string> gff_annotations = S_Cerevisiae_Chrom.get_gff_annotations();
+	const vector <string> & gff_annotations = S_Cerevisiae_Chrom.get_gff_annotations();
 	
 	*coding_DNA    = vector <string>( gff_annotations.size(), "" );
 	*noncoding_DNA = vector <string>( gff_annotations.size(), "" );
@@ -1883,9 +1866,17 @@ void get_coding_and_noncoding_DNA( const TFasta_Content & S_Cerevisiae_Chrom,  v
 	{
 		// ------------------------------
 		// Extract the needed information (CDS start and end, and strand)
-		vector <string> CDS_first_coord_str = extract_fields( gff_annotations[i], "SGD\tCDS\t", "\t" 		);
-		vector <string> CDS_last_coord_str  = extract_fields( gff_annotations[i], "SGD\tCDS\t", "\t." 		);
-		vector <string> strand_str     		= extract_fields( gff_annotations[i], "SGD\tCDS\t", "\tParent=" );
+		vector <TField_Spec> field_specs;
+		field_specs.push_back( TField_Spec( "SGD\tCDS\t", "\t" 		) );
+		field_specs.push_back( TField_Spec( "SGD\tCDS\t", "\t." 		) );
+		field_specs.push_back( TField_Spec( "SGD\tCDS\t", "\tParent=" ) );
+		
+		vector <vector <TField_View> > fields;
+		extract_field_views( gff_annotations[i], field_specs, &fields );
+		
+		const vector <TField_View> & CDS_first_coord_str = fields[0];
+		const vector <TField_View> & CDS_last_coord_str  = fields[1];
+		const vector <TField_View> & strand_str     	 = fields[2];
 		
 		
 		if( CDS_first_coord_str.size() != strand_str.size() || CDS_last_coord_str.size() != strand_str.size() )
@@ -1906,14 +1897,14 @@ void get_coding_and_noncoding_DNA( const TFasta_Content & S_Cerevisiae_Chrom,  v
 		// Extract all Coding DNA Segment annotations from the GFF file (don't add CDS's fully enveloped by another)
 		for( unsigned int j = 0; j < CDS_first_coord_str.size(); j++ )
 		{
-			unsigned int strand_id_pos = strand_str[j].find( ".\t" ) + ((string)".\t").size() ;
+			size_t strand_id_pos = gff_annotations[i].find( ".\t", strand_str[j].start_pos ) + ((string)".\t").size() ;
 
-			unsigned int CDS_first_coord = atoi( CDS_first_coord_str[j].c_str() );
+			unsigned int CDS_first_coord = CDS_first_coord_str[j].to_int( gff_annotations[i] );
 			
-			unsigned int last_coord_start_pos = CDS_last_coord_str[j].find( '\t' ) + 1; 
-			unsigned int CDS_last_coord = atoi( CDS_last_coord_str[j].substr( last_coord_start_pos ).c_str() );
+			size_t last_coord_start_pos = CDS_last_coord_str[j].find( gff_annotations[i], '\t' ) + 1; 
+			unsigned int CDS_last_coord = CDS_last_coord_str[j].to_int( gff_annotations[i], last_coord_start_pos );
 			
-			if( strand_str[j][strand_id_pos] == '+' )
+			if( gff_annotations[i][strand_id_pos] == '+' )
 			{	
 				// Only add the CDS if not enveloped by the next CDS
 				if( CDS_start_coord_sense.size() == 0 || ( CDS_start_coord_sense.back() + CDS_length_sense.back() - 1 ) < CDS_last_coord )
@@ -1932,7 +1923,7 @@ void get_coding_and_noncoding_DNA( const TFasta_Content & S_Cerevisiae_Chrom,  v
 					
 				}
 			}
-			else/*( strand_str[strand_id_pos] == '-' )*/ 
+			else/*( gff_annotations[i][strand_id_pos] == '-' )*/ 
 			{ 	
 				// Only add the CDS if not enveloped by the next CDS
 				if( CDS_start_coord_antisense.size() == 0 || CDS_start_coord_antisense.back() < CDS_last_coord )
@@ -2022,6 +2013,21 @@ void get_coding_and_noncoding_DNA( const TFasta_Content & S_Cerevisiae_Chrom,  v
 }
 //==============================================================================
 
+
+
+// The codon with index 'codon_it' in a 'TCodon_Histogram'
+string get_codon_str( const unsigned int codon_it )
+{
+	vector <unsigned int> codon_numeric( 3, NT_A );
+	
+	codon_numeric[0] = ( codon_it >> 4 ) & 0x3;
+	codon_numeric[1] = ( codon_it >> 2 ) & 0x3;
+	codon_numeric[2] =   codon_it 		 & 0x3;
+	
+	return convert_DNA_num_to_string( codon_numeric );
+}
+//==============================================================================
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
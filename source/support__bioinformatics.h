@@ -30,7 +30,7 @@
 //      C. Type (and Member Function) Declarations and Definitions
 //      D. Non-Member Function Declarations
 //     *E. Templated (Non-Member) Function Declarations
-//     *F. Inline (Non-Member) Function Declarations and Definitions
+//      F. Inline (Non-Member) Function Declarations and Definitions
 //     *G. UNUSED Non-Member Function Declarations
 //
 ////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +56,23 @@
 // Project-specific header files:  definitions and related information
 #include "defs__general.h"
 
+// Project-specific header files:  support functions and related
+#include "support__packed_genome.h"
+#include "support__intern.h"
+
+
+
+// Expand 'entry( c )' for every character 'c', in order, as the initializer of a table indexed by (unsigned) character
+#define NUM_NT_TABLE_ENTRIES		256
+#define NT_TABLE_ROW( entry, row )	entry( row +  0 ), entry( row +  1 ), entry( row +  2 ), entry( row +  3 ), \
+									entry( row +  4 ), entry( row +  5 ), entry( row +  6 ), entry( row +  7 ), \
+									entry( row +  8 ), entry( row +  9 ), entry( row + 10 ), entry( row + 11 ), \
+									entry( row + 12 ), entry( row + 13 ), entry( row + 14 ), entry( row + 15 )
+#define NT_TABLE( entry )			{ NT_TABLE_ROW( entry,   0 ), NT_TABLE_ROW( entry,  16 ), NT_TABLE_ROW( entry,  32 ), NT_TABLE_ROW( entry,  48 ), \
+									  NT_TABLE_ROW( entry,  64 ), NT_TABLE_ROW( entry,  80 ), NT_TABLE_ROW( entry,  96 ), NT_TABLE_ROW( entry, 112 ), \
+									  NT_TABLE_ROW( entry, 128 ), NT_TABLE_ROW( entry, 144 ), NT_TABLE_ROW( entry, 160 ), NT_TABLE_ROW( entry, 176 ), \
+									  NT_TABLE_ROW( entry, 192 ), NT_TABLE_ROW( entry, 208 ), NT_TABLE_ROW( entry, 224 ), NT_TABLE_ROW( entry, 240 ) }
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -131,23 +148,49 @@ class TFeature
 			{ }
 			
 		TFeature( void ) :
-			start_coord( std::string::npos ),
-			length	   ( std::string::npos )
+			start_coord( (unsigned int)std::string::npos ),
+			length	   ( (unsigned int)std::string::npos )
 			{ }
 };
 //==============================================================================
 
 
 
+// The untranslated regions (introns) of a transcript, sorted in transcript order, so that a spliced sequence can be
+//   read straight from the chromosome into a caller's buffer.  An intron's 'start_coord' is its first coordinate in
+//   transcript order (its highest coordinate on the Crick strand)
+class TExon_Map
+{
+	private:
+		std::vector <TFeature> introns;
+		bool opposite_strand;
+		
+	public:
+		const std::vector <TFeature> & get_introns( void ) const { return introns; }
+		bool get_opposite_strand( void ) const { return opposite_strand; }
+		
+		size_t extract( const TPacked_Chrom & chrom_seq,
+						const unsigned int start_coord,
+						const unsigned int len,
+						char * const dest,
+						const bool remove_untransl_reg_in_first_codon = FALSE ) const;
+		
+		TExon_Map( const std::vector <TFeature> & untransl_reg, const bool transcr_opposite_strand );
+		TExon_Map( void ) : opposite_strand( FALSE ) { }
+};
+//==============================================================================
+
+
+
 class TGO_Term
 {
 	public:
-		string name;
-		string evidence;
+		TInterned_String name;
+		TInterned_String evidence;
 		unsigned int level;
-		string parent;
+		TInterned_String parent;
 		
-		TGO_Term( const std::string & GO_term_name, const std::string & GO_term_evidence, const unsigned int GO_term_level = 0, const std::string GO_term_parent = "" ) :
+		TGO_Term( const TInterned_String & GO_term_name, const TInterned_String & GO_term_evidence, const unsigned int GO_term_level = 0, const TInterned_String & GO_term_parent = "" ) :
 			name	( GO_term_name     ),
 			evidence( GO_term_evidence ),
 			level	( GO_term_level	   ),
@@ -188,6 +231,35 @@ class TCalculate_AUGCAI
 };
 //==============================================================================
 
+
+
+// Counts of each codon in each reading frame, for any number of groups of sequences.  A codon is indexed by its
+//   nucleotides' 'Tenum_nucleotides' values packed 2 bits apiece (first nucleotide highest), so reading a sequence is a
+//   shift and a mask per nucleotide, and one pass counts all three frames.  Histograms filled separately (e.g. one per
+//   thread) are combined with 'merge()'
+class TCodon_Histogram
+{
+	private:
+		unsigned int num_groups;
+		std::vector <unsigned int> num_codons;		// By group, then frame, then codon
+		
+	public:
+		bool add_sequence( const std::string & sequence, const size_t first_pos, const std::vector <unsigned int> & groups );
+		void merge( const TCodon_Histogram & histogram );
+		
+		unsigned int get_num_groups( void ) const { return num_groups; }
+		unsigned int get_count( const unsigned int group, const unsigned int frame, const unsigned int codon_it ) const
+		{
+			return num_codons[ ( group * NUM_READING_FRAMES + frame ) * NUM_CODONS + codon_it ];
+		}
+		
+		TCodon_Histogram( const unsigned int histogram_num_groups = 1 ) :
+			num_groups( histogram_num_groups ),
+			num_codons( histogram_num_groups * NUM_READING_FRAMES * NUM_CODONS, 0 )
+		{ }
+};
+//==============================================================================
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -200,13 +272,13 @@ class TCalculate_AUGCAI
 //
 ////////////////////////////////////////////////////////////////////////////////
 
-void request_sel_sequence( const std::vector <std::string> & yeast_chromosomes );
+void request_sel_sequence( const std::vector <TPacked_Chrom> & yeast_chromosomes );
 
-std::string extract_DNA_seq( const std::string & chrom_seq, 
+std::string extract_DNA_seq( const TPacked_Chrom & chrom_seq, 
 							 unsigned int start_coord, 
 							 const unsigned int len, 
 							 const bool opposite_strand, 
-							 const std::vector <TFeature> untransl_reg = std::vector <TFeature> ( 0 ), 
+							 const std::vector <TFeature> & untransl_reg = std::vector <TFeature> ( 0 ), 
 							 const bool remove_untransl_reg_in_first_codon = FALSE );
 							 
 std::string get_inverted_sequence( const std::string seq_to_invert );
@@ -227,18 +299,18 @@ int get_gene_coord_from_gff( const std::string & gene_name,
 							 std::vector <TFeature> * const untransl_reg,
 							 TFeature * const fpUTR_intron );
 							 
-unsigned int find_first_stop_codon( const std::string & chomosome, 
+unsigned int find_first_stop_codon( const TPacked_Chrom & chomosome, 
 									unsigned int start_pos, 
 									bool opposite_strand, 
 									unsigned int * const len = NULL, 
-									const std::vector <TFeature> removed_reg = std::vector <TFeature> ( 0 ) 
+									const std::vector <TFeature> & removed_reg = std::vector <TFeature> ( 0 ) 
 									/*bool search_in_frame = TRUE*/ );
 									
 void generate_simple_GO_hierarchy( void );
 void parse_GO_hierarchy( std::vector <TGO_Annotation> * const All_GO_Annotations );
 void generate_list_of_children( void );
-unsigned int find_GO_parent_term( const std::string & GO_database_contents, const std::string & parent_term, const unsigned int prev_parent_id_pos = 0 );
-unsigned int find_GO_parent_term( const std::string & GO_database_contents, const int parent_term_num, 		 const unsigned int prev_parent_id_pos = 0 );
+size_t find_GO_parent_term( const std::string & GO_database_contents, const std::string & parent_term, const size_t prev_parent_id_pos = 0 );
+size_t find_GO_parent_term( const std::string & GO_database_contents, const int parent_term_num, 		 const size_t prev_parent_id_pos = 0 );
 
 std::vector <std::string> get_all_children_terms( const std::string & GO_database_contents, 
 												  const std::string & parent_term, 
@@ -247,14 +319,141 @@ std::vector <std::string> get_all_children_terms( const std::string & GO_databas
 												  
 std::vector <std::string> get_all_children_terms( const std::string & GO_database_contents, const unsigned int parent_term_num );
 std::string get_child_term( const std::string & GO_database_contents, const unsigned int parent_id_pos );
-bool is_child_descendent_of( const std::string & child_term, const std::string & parent_term, const TGO_Annotation & GO_Annotations );
-std::vector <TGO_Term> get_all_parents_of( const std::string & child_term, const TGO_Annotation & GO_Annotations );
+bool is_child_descendent_of( const TInterned_String & child_term, const TInterned_String & parent_term, const TGO_Annotation & GO_Annotations );
+std::vector <TGO_Term> get_all_parents_of( const TInterned_String & child_term, const TGO_Annotation & GO_Annotations );
 
 std::vector <unsigned int> convert_DNA_string_to_num( const std::string & DNA_string  );
 std::string convert_DNA_num_to_string( const std::vector <unsigned int> & DNA_numeric );
 
 void get_coding_and_noncoding_DNA( const TFasta_Content & S_Cerevisiae_Chrom,  std::vector <std::string> * const coding_DNA, std::vector <std::string> * const noncoding_DNA );
 
+std::string get_codon_str( const unsigned int codon_it );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// F. Inline (Non-Member) Function Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// The entries of the nucleotide tables below, evaluated at compile time.  A character other than 'A', 'C', 'G', or 'T'
+//   has no code or rank (NUM_DIFF_NT is returned instead), and is its own complement
+constexpr unsigned char get_nt_code_entry( const unsigned int c )
+{
+	return ( c == 'A' ) ? NT_A :
+		   ( c == 'C' ) ? NT_C :
+		   ( c == 'G' ) ? NT_G :
+		   ( c == 'T' ) ? NT_T : NUM_DIFF_NT;
+}
+
+// Rank in the order used by 'Tenum_nucleotide_pairs' (the pair 'x' and 'y' is 'x_rank * NUM_DIFF_NT + y_rank')
+constexpr unsigned char get_nt_pair_rank_entry( const unsigned int c )
+{
+	// The ranks are pair values, and 'not recognized' a nucleotide value, so both are cast to the table's type
+	return ( c == 'A' ) ? (unsigned char)A_AND_A :
+		   ( c == 'T' ) ? (unsigned char)A_AND_T :
+		   ( c == 'C' ) ? (unsigned char)A_AND_C :
+		   ( c == 'G' ) ? (unsigned char)A_AND_G : (unsigned char)NUM_DIFF_NT;
+}
+
+constexpr char get_nt_complement_entry( const unsigned int c )
+{
+	return ( c == 'A' ) ? 'T' :
+		   ( c == 'T' ) ? 'A' :
+		   ( c == 'C' ) ? 'G' :
+		   ( c == 'G' ) ? 'C' : (char)c;
+}
+//==============================================================================
+
+
+
+// Indexed by character (as an unsigned char), so that encoding a nucleotide is a load rather than a switch
+constexpr unsigned char Nt_Code_Table	   [ NUM_NT_TABLE_ENTRIES ] = NT_TABLE( get_nt_code_entry 	    );
+constexpr unsigned char Nt_Pair_Rank_Table [ NUM_NT_TABLE_ENTRIES ] = NT_TABLE( get_nt_pair_rank_entry  );
+constexpr char 			Nt_Complement_Table[ NUM_NT_TABLE_ENTRIES ] = NT_TABLE( get_nt_complement_entry );
+
+// Indexed by 'Tenum_nucleotides' value
+constexpr char Nt_Char_Table[ NUM_DIFF_NT ] = { 'A', 'C', 'G', 'T' };
+//==============================================================================
+
+
+
+// Bulk conversions of 'len' nucleotides, written as straight-line loops (a table load and a store per nucleotide, with
+//   no branches) so that their speed doesn't depend on the sequence.  Rather than checking each nucleotide, the codes
+//   are OR-ed together and checked once at the end:  a valid code is less than NUM_DIFF_NT, and NUM_DIFF_NT (the code
+//   of any character that isn't a nucleotide) sets a bit that no valid code does
+
+// Returns FALSE if any character isn't a nucleotide (its code is still written, as NUM_DIFF_NT)
+template <class T_code>
+inline bool encode_nt_seq( const char * const seq, const size_t len, T_code * const codes )
+{
+	unsigned char all_codes = 0;
+	
+	for( size_t i = 0; i < len; i++ )
+	{
+		const unsigned char code = Nt_Code_Table[ (unsigned char)seq[i] ];
+		
+		codes[i]   = code;
+		all_codes |= code;
+	}
+	
+	return ( all_codes & NUM_DIFF_NT ) == 0;
+}
+//------------------------------------------------------------------------------
+
+
+// As 'encode_nt_seq()', but by rank in the order used by 'Tenum_nucleotide_pairs'
+template <class T_rank>
+inline bool rank_nt_seq( const char * const seq, const size_t len, T_rank * const ranks )
+{
+	unsigned char all_ranks = 0;
+	
+	for( size_t i = 0; i < len; i++ )
+	{
+		const unsigned char rank = Nt_Pair_Rank_Table[ (unsigned char)seq[i] ];
+		
+		ranks[i]   = rank;
+		all_ranks |= rank;
+	}
+	
+	return ( all_ranks & NUM_DIFF_NT ) == 0;
+}
+//------------------------------------------------------------------------------
+
+
+// Returns FALSE if any code isn't a 'Tenum_nucleotides' value (the character written for it is then meaningless)
+template <class T_code>
+inline bool decode_nt_seq( const T_code * const codes, const size_t len, char * const seq )
+{
+	T_code all_codes = 0;
+	
+	for( size_t i = 0; i < len; i++ )
+	{
+		seq[i] 	   = Nt_Char_Table[ codes[i] & ( NUM_DIFF_NT - 1 ) ];
+		all_codes |= codes[i];
+	}
+	
+	return all_codes < NUM_DIFF_NT;
+}
+//------------------------------------------------------------------------------
+
+
+// Characters that aren't nucleotides are copied unchanged.  'seq' and 'complement' may be the same
+inline void complement_nt_seq( const char * const seq, const size_t len, char * const complement )
+{
+	for( size_t i = 0; i < len; i++ ) { complement[i] = Nt_Complement_Table[ (unsigned char)seq[i] ]; }
+	
+	return;
+}
+//==============================================================================
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -0,0 +1,660 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__columnar_io.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to write tables to, and read them back from,
+//				 columnar binary files
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <cmath>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+#include "support__file_io.h"
+#include "support__filesystem.h"
+
+// Header file for this file
+#include "support__columnar_io.h"
+
+
+
+// A columnar file holds, in the machine's byte order:
+//
+//   Header:     "uCOL", the format version, the number of columns (each as an 'unsigned int'), the number of rows (as an
+//               'unsigned long long'), and the row group size; then, by column, its type and the length of its name
+//               (each as an 'unsigned int') followed by the name
+//   Row groups: the number of rows in the group, then, by column, the size of the column's chunk in bytes (as an
+//               'unsigned long long', so readers can skip columns they don't need) followed by the chunk
+//   Footer:     the number of row groups, the offset of each from the start of the file, the offset of the footer,
+//               and "uCOL" again
+//
+// A numeric chunk is a bitmap of the rows whose cells aren't empty (bit 'i % 8' of byte 'i / 8'), then every row's
+//   value.  A string chunk is the row group's dictionary (the number of distinct strings, then each one's length and
+//   characters), the width in bytes of an index into it (1, 2, or 4, whichever is narrowest), then every row's index
+#define COLUMNAR_FILE_MAGIC				"uCOL"
+#define COLUMNAR_FILE_MAGIC_SIZE		4
+#define COLUMNAR_FORMAT_VERSION			1
+#define COLUMNAR_TRAILER_SIZE			( sizeof( unsigned long long ) + COLUMNAR_FILE_MAGIC_SIZE )		// Footer offset and magic
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// The cell as text ("" where it was empty).  Numbers are formatted as 'get_str()' formats them
+string TColumnar_Chunk::get_str( const size_t row_it ) const
+{
+	if( type == COLUMNAR_TYPE_STRING ) { return dictionary[ dictionary_its[ row_it ] ]; }
+
+	if( present[ row_it ] == FALSE ) { return ""; }
+
+	return ( type == COLUMNAR_TYPE_INT64 ) ? ::get_str( int_values[ row_it ] ) : ::get_str( double_values[ row_it ] );
+}
+//==============================================================================
+
+
+
+int TColumnar_Reader::open( const string & file_folder_path, const string & file_name )
+{
+	ifstream_file.close();
+	ifstream_file.clear();
+
+	column_names.clear();
+	column_types.clear();
+	row_group_offsets.clear();
+	num_rows = 0;
+
+	full_file_path = get_file_path( file_folder_path, file_name );
+
+	ifstream_file.open( full_file_path.c_str(), ifstream::in | ifstream::binary );
+
+	if( ifstream_file.fail() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TColumnar_Reader::open()': Unable to open file \"" + full_file_path + "\". ", __FILE__, __LINE__ );
+	}
+
+	const string NOT_COLUMNAR_FILE_MSG = (string)"Error in 'TColumnar_Reader::open()': \"" + full_file_path + "\" is not a columnar file (or is incomplete). ";
+
+	ifstream_file.seekg( 0, ifstream::end );
+	const unsigned long long file_size = ifstream_file.tellg();
+	ifstream_file.seekg( 0, ifstream::beg );
+
+
+	// Header and schema
+	char magic[ COLUMNAR_FILE_MAGIC_SIZE ] = { 0, 0, 0, 0 };
+	unsigned int file_version	  = 0;
+	unsigned int file_num_columns = 0;
+	unsigned int row_group_size	  = 0;
+
+	ifstream_file.read( magic, COLUMNAR_FILE_MAGIC_SIZE );
+	ifstream_file.read( (char *)&file_version, 	   sizeof( file_version 	) );
+	ifstream_file.read( (char *)&file_num_columns, sizeof( file_num_columns ) );
+	ifstream_file.read( (char *)&num_rows, 		   sizeof( num_rows 		) );
+	ifstream_file.read( (char *)&row_group_size,   sizeof( row_group_size 	) );
+
+	if( ifstream_file.fail() || string( magic, COLUMNAR_FILE_MAGIC_SIZE ) != COLUMNAR_FILE_MAGIC )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, NOT_COLUMNAR_FILE_MSG, __FILE__, __LINE__ );
+	}
+
+	if( file_version != COLUMNAR_FORMAT_VERSION )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TColumnar_Reader::open()': \"" + full_file_path + "\" is of format version " + get_str( file_version ) +
+															   ", but only version " + get_str( (unsigned int)COLUMNAR_FORMAT_VERSION ) + " can be read. ", __FILE__, __LINE__ );
+	}
+
+	for( unsigned int i = 0; i < file_num_columns; i++ )
+	{
+		unsigned int column_type = NUM_COLUMNAR_TYPES;
+		unsigned int name_length = 0;
+
+		ifstream_file.read( (char *)&column_type, sizeof( column_type ) );
+		ifstream_file.read( (char *)&name_length, sizeof( name_length ) );
+
+		if( ifstream_file.fail() || column_type >= NUM_COLUMNAR_TYPES || name_length > file_size )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, NOT_COLUMNAR_FILE_MSG, __FILE__, __LINE__ );
+		}
+
+		string column_name( name_length, '\0' );
+		if( name_length > 0 ) { ifstream_file.read( &column_name[0], name_length ); }
+
+		column_names.push_back( column_name );
+		column_types.push_back( (Tenum_columnar_types)column_type );
+	}
+
+
+	// Footer (found from the offset at the end of the file)
+	unsigned long long footer_offset = 0;
+	unsigned int num_row_groups		 = 0;
+
+	if( ifstream_file.fail() || file_size < COLUMNAR_TRAILER_SIZE )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, NOT_COLUMNAR_FILE_MSG, __FILE__, __LINE__ );
+	}
+
+	ifstream_file.seekg( file_size - COLUMNAR_TRAILER_SIZE, ifstream::beg );
+	ifstream_file.read( (char *)&footer_offset, sizeof( footer_offset ) );
+	ifstream_file.read( magic, COLUMNAR_FILE_MAGIC_SIZE );
+
+	if( ifstream_file.fail() || string( magic, COLUMNAR_FILE_MAGIC_SIZE ) != COLUMNAR_FILE_MAGIC || footer_offset > file_size - COLUMNAR_TRAILER_SIZE )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, NOT_COLUMNAR_FILE_MSG, __FILE__, __LINE__ );
+	}
+
+	ifstream_file.seekg( footer_offset, ifstream::beg );
+	ifstream_file.read( (char *)&num_row_groups, sizeof( num_row_groups ) );
+
+	if( ifstream_file.fail() || num_row_groups > ( file_size - footer_offset ) / sizeof( unsigned long long ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, NOT_COLUMNAR_FILE_MSG, __FILE__, __LINE__ );
+	}
+
+	row_group_offsets.resize( num_row_groups, 0 );
+	if( num_row_groups > 0 ) { ifstream_file.read( (char *)&row_group_offsets[0], num_row_groups * sizeof( unsigned long long ) ); }
+
+	if( ifstream_file.fail() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, NOT_COLUMNAR_FILE_MSG, __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+bool TColumnar_Reader::find_column( const string & column_name, unsigned int * const column_it ) const
+{
+	const vector <string>::const_iterator name_it = find( column_names.begin(), column_names.end(), column_name );
+
+	if( name_it == column_names.end() ) { return FALSE; }
+
+	*column_it = name_it - column_names.begin();
+
+	return TRUE;
+}
+//------------------------------------------------------------------------------
+
+
+// Read the chunks of the columns 'column_its' (in that order) from one row group.  Chunks of the other columns are
+//   skipped over unread, and the row group is left once the last column asked for has been read
+int TColumnar_Reader::read_row_group( const unsigned int row_group_it, const vector <unsigned int> & column_its, vector <TColumnar_Chunk> * const chunks )
+{
+	if( row_group_it >= row_group_offsets.size() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TColumnar_Reader::read_row_group()': Row group " + get_str( row_group_it ) +
+															   " requested, but \"" + full_file_path + "\" has only " + get_str( (unsigned int)row_group_offsets.size() ) + ". ", __FILE__, __LINE__ );
+	}
+
+
+	// Where each column's chunk goes (the first place, if asked for more than once)
+	vector <int> chunk_it_by_column( column_names.size(), -1 );
+	int last_column_it = -1;
+
+	for( unsigned int i = 0; i < column_its.size(); i++ )
+	{
+		if( column_its[i] >= column_names.size() )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TColumnar_Reader::read_row_group()': Column " + get_str( column_its[i] ) +
+																   " requested, but \"" + full_file_path + "\" has only " + get_str( (unsigned int)column_names.size() ) + ". ", __FILE__, __LINE__ );
+		}
+
+		if( chunk_it_by_column[ column_its[i] ] == -1 ) { chunk_it_by_column[ column_its[i] ] = i; }
+
+		last_column_it = max( last_column_it, (int)column_its[i] );
+	}
+
+	chunks->assign( column_its.size(), TColumnar_Chunk() );
+
+
+	ifstream_file.clear();
+	ifstream_file.seekg( row_group_offsets[ row_group_it ], ifstream::beg );
+
+	unsigned int group_num_rows = 0;
+	ifstream_file.read( (char *)&group_num_rows, sizeof( group_num_rows ) );
+
+	string chunk_contents;
+
+	for( int column_it = 0; column_it <= last_column_it; column_it++ )
+	{
+		unsigned long long chunk_size = 0;
+		ifstream_file.read( (char *)&chunk_size, sizeof( chunk_size ) );
+
+		if( ifstream_file.fail() ) { break; }
+
+		if( chunk_it_by_column[ column_it ] == -1 )
+		{
+			ifstream_file.seekg( chunk_size, ifstream::cur );
+			continue;
+		}
+
+
+		chunk_contents.resize( chunk_size );
+		if( chunk_size > 0 ) { ifstream_file.read( &chunk_contents[0], chunk_size ); }
+
+		if( ifstream_file.fail() || decode_columnar_chunk( chunk_contents, column_types[ column_it ], group_num_rows, &(*chunks)[ chunk_it_by_column[ column_it ] ] ) == FALSE )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TColumnar_Reader::read_row_group()': Column \"" + column_names[ column_it ] + "\" of row group " +
+																   get_str( row_group_it ) + " of \"" + full_file_path + "\" is corrupt. ", __FILE__, __LINE__ );
+		}
+	}
+
+	if( ifstream_file.fail() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TColumnar_Reader::read_row_group()': \"" + full_file_path + "\" ends partway through row group " +
+															   get_str( row_group_it ) + ". ", __FILE__, __LINE__ );
+	}
+
+	for( unsigned int i = 0; i < column_its.size(); i++ )
+	{
+		if( chunk_it_by_column[ column_its[i] ] != (int)i ) { (*chunks)[i] = (*chunks)[ chunk_it_by_column[ column_its[i] ] ]; }
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Only digits, signs, decimal points, exponents, and surrounding spaces are accepted as part of a number, so that
+//   strings 'strtod()' would also read (such as "INF1", "nan", or hex) are left as strings
+static bool parse_int_field( const string & field, long long * const value )
+{
+	if( field.find_first_not_of( " +-0123456789" ) != string::npos ) { return FALSE; }
+
+	const char * const field_start = field.c_str();
+	char * field_end = NULL;
+
+	errno = 0;
+	*value = strtoll( field_start, &field_end, 10 );
+
+	if( field_end == field_start || errno == ERANGE ) { return FALSE; }
+
+	while( *field_end == ' ' ) { field_end++; }
+
+	return ( *field_end == '\0' );
+}
+//------------------------------------------------------------------------------
+
+
+static bool parse_double_field( const string & field, double * const value )
+{
+	if( field.find_first_not_of( " +-.0123456789eE" ) != string::npos ) { return FALSE; }
+
+	const char * const field_start = field.c_str();
+	char * field_end = NULL;
+
+	*value = strtod( field_start, &field_end );
+
+	if( field_end == field_start || isfinite( *value ) == FALSE ) { return FALSE; }
+
+	while( *field_end == ' ' ) { field_end++; }
+
+	return ( *field_end == '\0' );
+}
+//------------------------------------------------------------------------------
+
+
+static bool is_field_empty( const string & field ) { return ( field.find_first_not_of( ' ' ) == string::npos ); }
+//==============================================================================
+
+
+
+// See 'Tenum_columnar_types'.  A column with no cells that aren't empty is stored as strings
+static Tenum_columnar_types get_columnar_type( const vector <vector <string> > & table, const unsigned int column_it )
+{
+	bool all_ints 	 = TRUE;
+	bool any_present = FALSE;
+
+	long long int_value;
+	double double_value;
+
+	for( size_t row_it = 1; row_it < table.size(); row_it++ )
+	{
+		const string & field = table[ row_it ][ column_it ];
+
+		if( is_field_empty( field ) ) { continue; }
+
+		any_present = TRUE;
+
+		if( all_ints == TRUE && parse_int_field( field, &int_value ) == FALSE ) { all_ints = FALSE; }
+
+		if( all_ints == FALSE && parse_double_field( field, &double_value ) == FALSE ) { return COLUMNAR_TYPE_STRING; }
+	}
+
+	if( any_present == FALSE ) { return COLUMNAR_TYPE_STRING; }
+
+	return ( all_ints == TRUE ) ? COLUMNAR_TYPE_INT64 : COLUMNAR_TYPE_DOUBLE;
+}
+//==============================================================================
+
+
+
+// Append the chunk of one column holding rows 'first_row_it' through 'end_row_it - 1' of the table
+static void encode_columnar_chunk( const vector <vector <string> > & table,
+								   const unsigned int column_it,
+								   const Tenum_columnar_types column_type,
+								   const size_t first_row_it,
+								   const size_t end_row_it,
+								   string * const chunk_contents )
+{
+	const size_t num_rows = end_row_it - first_row_it;
+
+	if( column_type == COLUMNAR_TYPE_STRING )
+	{
+		unordered_map <string, unsigned int> dictionary_its;
+		vector <const string *> dictionary;
+		vector <unsigned int> row_dictionary_its( num_rows, 0 );
+
+		for( size_t i = 0; i < num_rows; i++ )
+		{
+			const string & field = table[ first_row_it + i ][ column_it ];
+
+			const pair <unordered_map <string, unsigned int>::iterator, bool> inserted = dictionary_its.insert( make_pair( field, (unsigned int)dictionary.size() ) );
+			if( inserted.second == TRUE ) { dictionary.push_back( &field ); }
+
+			row_dictionary_its[i] = inserted.first->second;
+		}
+
+		append_binary_value( chunk_contents, (unsigned int)dictionary.size() );
+
+		for( unsigned int i = 0; i < dictionary.size(); i++ )
+		{
+			append_binary_value( chunk_contents, (unsigned int)dictionary[i]->size() );
+			chunk_contents->append( *dictionary[i] );
+		}
+
+		const unsigned int index_width = ( dictionary.size() <= 0x100 ) ? 1 : ( dictionary.size() <= 0x10000 ) ? 2 : 4;
+		append_binary_value( chunk_contents, index_width );
+
+		for( size_t i = 0; i < num_rows; i++ )
+		{
+			if	   ( index_width == 1 ) { append_binary_value( chunk_contents, (uint8_t) row_dictionary_its[i] ); }
+			else if( index_width == 2 ) { append_binary_value( chunk_contents, (uint16_t)row_dictionary_its[i] ); }
+			else/*( index_width == 4 )*/{ append_binary_value( chunk_contents, 			 row_dictionary_its[i] ); }
+		}
+	}
+	else/*( column_type == COLUMNAR_TYPE_INT64 || column_type == COLUMNAR_TYPE_DOUBLE )*/
+	{
+		string present_bitmap( ( num_rows + 7 ) / 8, '\0' );
+		string values;
+
+		for( size_t i = 0; i < num_rows; i++ )
+		{
+			const string & field = table[ first_row_it + i ][ column_it ];
+			const bool present = ( is_field_empty( field ) == FALSE );
+
+			if( present == TRUE ) { present_bitmap[ i / 8 ] |= (char)( 1 << ( i % 8 ) ); }
+
+			if( column_type == COLUMNAR_TYPE_INT64 )
+			{
+				long long value = 0;
+				if( present == TRUE ) { parse_int_field( field, &value ); }
+
+				append_binary_value( &values, value );
+			}
+			else/*( column_type == COLUMNAR_TYPE_DOUBLE )*/
+			{
+				double value = numeric_limits <double>::quiet_NaN();
+				if( present == TRUE ) { parse_double_field( field, &value ); }
+
+				append_binary_value( &values, value );
+			}
+		}
+
+		chunk_contents->append( present_bitmap );
+		chunk_contents->append( values );
+	}
+
+	return;
+}
+//==============================================================================
+
+
+
+// Decode a chunk of 'num_rows' rows written by 'encode_columnar_chunk()'.  Returns FALSE if the chunk isn't one
+bool decode_columnar_chunk( const string & chunk_contents, const Tenum_columnar_types column_type, const unsigned int num_rows, TColumnar_Chunk * const chunk )
+{
+	size_t pos = 0;
+
+	chunk->type = column_type;
+	chunk->present.assign( num_rows, TRUE );
+
+	if( column_type == COLUMNAR_TYPE_STRING )
+	{
+		unsigned int dictionary_size = 0;
+		if( extract_binary_value( chunk_contents, &pos, &dictionary_size ) == FALSE || dictionary_size > chunk_contents.size() ) { return FALSE; }
+
+		chunk->dictionary.resize( dictionary_size );
+
+		for( unsigned int i = 0; i < dictionary_size; i++ )
+		{
+			unsigned int length = 0;
+			if( extract_binary_value( chunk_contents, &pos, &length ) == FALSE || length > chunk_contents.size() - pos ) { return FALSE; }
+
+			chunk->dictionary[i].assign( chunk_contents, pos, length );
+			pos += length;
+		}
+
+		unsigned int index_width = 0;
+		if( extract_binary_value( chunk_contents, &pos, &index_width ) == FALSE ) { return FALSE; }
+
+		if( ( index_width != 1 && index_width != 2 && index_width != 4 ) || chunk_contents.size() - pos != (size_t)num_rows * index_width ) { return FALSE; }
+
+		chunk->dictionary_its.resize( num_rows );
+
+		for( unsigned int i = 0; i < num_rows; i++ )
+		{
+			uint8_t  index_8  = 0;
+			uint16_t index_16 = 0;
+
+			if	   ( index_width == 1 ) { extract_binary_value( chunk_contents, &pos, &index_8  ); chunk->dictionary_its[i] = index_8;  }
+			else if( index_width == 2 ) { extract_binary_value( chunk_contents, &pos, &index_16 ); chunk->dictionary_its[i] = index_16; }
+			else/*( index_width == 4 )*/{ extract_binary_value( chunk_contents, &pos, &chunk->dictionary_its[i] ); }
+
+			if( chunk->dictionary_its[i] >= dictionary_size ) { return FALSE; }
+		}
+	}
+	else/*( column_type == COLUMNAR_TYPE_INT64 || column_type == COLUMNAR_TYPE_DOUBLE )*/
+	{
+		const size_t bitmap_size = ( (size_t)num_rows + 7 ) / 8;
+		const size_t value_size  = ( column_type == COLUMNAR_TYPE_INT64 ) ? sizeof( long long ) : sizeof( double );
+
+		if( chunk_contents.size() != bitmap_size + (size_t)num_rows * value_size ) { return FALSE; }
+
+		for( unsigned int i = 0; i < num_rows; i++ ) { chunk->present[i] = ( ( chunk_contents[ i / 8 ] >> ( i % 8 ) ) & 1 ); }
+		pos = bitmap_size;
+
+		if( column_type == COLUMNAR_TYPE_INT64 )
+		{
+			chunk->int_values.resize( num_rows );
+			if( num_rows > 0 ) { memcpy( &chunk->int_values[0], chunk_contents.data() + pos, (size_t)num_rows * value_size ); }
+		}
+		else/*( column_type == COLUMNAR_TYPE_DOUBLE )*/
+		{
+			chunk->double_values.resize( num_rows );
+			if( num_rows > 0 ) { memcpy( &chunk->double_values[0], chunk_contents.data() + pos, (size_t)num_rows * value_size ); }
+		}
+	}
+
+	return TRUE;
+}
+//==============================================================================
+
+
+
+// Write 'table' (whose first row names the columns) as a columnar file, 'row_group_size' rows per row group.  Every
+//   column's type is chosen from all of its cells, so that it's the same in every row group
+int write_columnar_table( const string & file_folder_path, const string & file_name, const vector <vector <string> > & table, const unsigned int row_group_size )
+{
+	if( table.empty() || table[0].empty() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_columnar_table()': Table passed did not contain any columns. ", __FILE__, __LINE__ );
+	}
+
+	if( row_group_size == 0 )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_columnar_table()': Row groups must hold at least one row. ", __FILE__, __LINE__ );
+	}
+
+	const unsigned int num_columns = table[0].size();
+
+	for( size_t i = 1; i < table.size(); i++ )
+	{
+		if( table[i].size() != num_columns )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_columnar_table()': Table passed did not have an equal number of columns in each row. ", __FILE__, __LINE__ );
+		}
+	}
+
+
+	// Header and schema
+	const unsigned long long num_rows = table.size() - 1;
+
+	string file_contents( COLUMNAR_FILE_MAGIC );
+	append_binary_value( &file_contents, (unsigned int)COLUMNAR_FORMAT_VERSION );
+	append_binary_value( &file_contents, num_columns    );
+	append_binary_value( &file_contents, num_rows 	    );
+	append_binary_value( &file_contents, row_group_size );
+
+	vector <Tenum_columnar_types> column_types( num_columns, COLUMNAR_TYPE_STRING );
+
+	for( unsigned int i = 0; i < num_columns; i++ )
+	{
+		column_types[i] = get_columnar_type( table, i );
+
+		append_binary_value( &file_contents, (unsigned int)column_types[i] );
+		append_binary_value( &file_contents, (unsigned int)table[0][i].size() );
+		file_contents.append( table[0][i] );
+	}
+
+
+	// Row groups (rows of the table are offset by one, for the header row)
+	vector <unsigned long long> row_group_offsets;
+	string chunk_contents;
+
+	for( size_t first_row_it = 1; first_row_it <= num_rows; first_row_it += row_group_size )
+	{
+		const size_t end_row_it = min( first_row_it + row_group_size, (size_t)num_rows + 1 );
+
+		row_group_offsets.push_back( file_contents.size() );
+		append_binary_value( &file_contents, (unsigned int)( end_row_it - first_row_it ) );
+
+		for( unsigned int i = 0; i < num_columns; i++ )
+		{
+			chunk_contents.clear();
+			encode_columnar_chunk( table, i, column_types[i], first_row_it, end_row_it, &chunk_contents );
+
+			append_binary_value( &file_contents, (unsigned long long)chunk_contents.size() );
+			file_contents.append( chunk_contents );
+		}
+	}
+
+
+	// Footer
+	const unsigned long long footer_offset = file_contents.size();
+
+	append_binary_value( &file_contents, (unsigned int)row_group_offsets.size() );
+	for( unsigned int i = 0; i < row_group_offsets.size(); i++ ) { append_binary_value( &file_contents, row_group_offsets[i] ); }
+
+	append_binary_value( &file_contents, footer_offset );
+	file_contents.append( COLUMNAR_FILE_MAGIC );
+
+
+	if( write_file_contents( file_folder_path, file_name, file_contents, YES, YES ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'write_columnar_table()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
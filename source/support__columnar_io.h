@@ -0,0 +1,165 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__columnar_io.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the functions used to write tables to,
+//				 and read them back from, columnar binary files
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__COLUMNAR_IO_H_
+#define _SUPPORT__COLUMNAR_IO_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+#include <fstream>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// A column is stored as integers if every non-empty cell is one, otherwise as doubles if every non-empty cell is a
+//   number, and otherwise as strings (so empty cells are missing values only in the numeric columns)
+enum Tenum_columnar_types
+{
+	COLUMNAR_TYPE_INT64,
+	COLUMNAR_TYPE_DOUBLE,
+	COLUMNAR_TYPE_STRING,
+
+	NUM_COLUMNAR_TYPES
+};
+//==============================================================================
+
+
+
+// The cells of one column in one row group.  Only the values of the column's type are filled
+class TColumnar_Chunk
+{
+	public:
+		Tenum_columnar_types type;
+		std::vector <bool> present;						// By row:  FALSE where the cell was empty (numeric columns only)
+
+		std::vector <long long> int_values;				// By row (0 where not present)
+		std::vector <double> double_values;				// By row (NaN where not present)
+
+		std::vector <std::string> dictionary;			// Each distinct string in the row group, once
+		std::vector <unsigned int> dictionary_its;		// By row:  the string's position in 'dictionary'
+
+		size_t size( void ) const { return present.size(); }
+		std::string get_str( const size_t row_it ) const;
+
+		TColumnar_Chunk( void ) : type( COLUMNAR_TYPE_STRING ) { }
+};
+//==============================================================================
+
+
+
+// Reads a file written by 'write_columnar_table()' one row group at a time, and only the columns asked for, so no more
+//   than COLUMNAR_ROW_GROUP_SIZE rows of those columns are held at once
+class TColumnar_Reader
+{
+	private:
+		std::ifstream ifstream_file;
+		std::string full_file_path;
+
+		std::vector <std::string> column_names;
+		std::vector <Tenum_columnar_types> column_types;
+		unsigned long long num_rows;
+		std::vector <unsigned long long> row_group_offsets;		// From the start of the file
+
+		// Not copyable (owns the file stream)
+		TColumnar_Reader( const TColumnar_Reader & );
+		TColumnar_Reader & operator=( const TColumnar_Reader & );
+
+	public:
+		int  open( const std::string & file_folder_path, const std::string & file_name );
+
+		unsigned int get_num_columns( void ) const { return column_names.size(); }
+		unsigned long long get_num_rows( void ) const { return num_rows; }
+		unsigned int get_num_row_groups( void ) const { return row_group_offsets.size(); }
+
+		const std::string & get_column_name( const unsigned int column_it ) const { return column_names[ column_it ]; }
+		Tenum_columnar_types get_column_type( const unsigned int column_it ) const { return column_types[ column_it ]; }
+		bool find_column( const std::string & column_name, unsigned int * const column_it ) const;
+
+		int  read_row_group( const unsigned int row_group_it, const std::vector <unsigned int> & column_its, std::vector <TColumnar_Chunk> * const chunks );
+
+		TColumnar_Reader( void ) : num_rows( 0 ) { }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+int write_columnar_table( const std::string & file_folder_path,
+						  const std::string & file_name,
+						  const std::vector <std::vector <std::string> > & table,
+						  const unsigned int row_group_size = COLUMNAR_ROW_GROUP_SIZE );
+bool decode_columnar_chunk( const std::string & chunk_contents, const Tenum_columnar_types column_type, const unsigned int num_rows, TColumnar_Chunk * const chunk );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__COLUMNAR_IO_H_
@@ -0,0 +1,732 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__compressed_io.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to read gzip- and BGZF-compressed input files, a
+//				 chunk or a line at a time
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include <zlib.h>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+#include "support__parallel.h"
+#include "support__filesystem.h"
+
+// Header file for this file
+#include "support__compressed_io.h"
+
+
+
+#define GZIP_ID_1					0x1f		// First two bytes of every gzip member (and so of every BGZF block)
+#define GZIP_ID_2					0x8b
+#define GZIP_FLAG_EXTRA				0x04		// 'FLG' bit set when the header has an extra field (as BGZF headers do)
+#define GZIP_TRAILER_SIZE			8			// CRC32, then the uncompressed size (ISIZE), both little-endian
+
+#define BGZF_FIXED_HEADER_SIZE		12			// Gzip header up to and including 'XLEN'
+#define BGZF_SUBFIELD_ID_1			'B'			// Extra subfield holding the total block size ('BSIZE', minus 1)
+#define BGZF_SUBFIELD_ID_2			'C'
+
+#define BGZF_HEADER_VALID			0
+#define BGZF_HEADER_INCOMPLETE		1			// More bytes must be read before the header can be checked
+#define BGZF_HEADER_INVALID			2
+
+#define GZIP_INFLATE_BUFFER_SIZE	262144
+
+#define LINE_READER_CHUNK_SIZE		262144		// Bytes of the (decompressed) file 'TLine_Reader' reads at a time
+#define CHUNK_READER_PREFETCH_DEPTH	2			// Chunks 'TChunk_Reader' decompresses ahead of the one being parsed
+
+
+// Defined in section D
+static int parse_bgzf_header( const char * const data, const size_t data_len, size_t * const block_size );
+static int inflate_bgzf_blocks( const char * const chunk, const size_t chunk_size, const bool parallel, size_t * const num_used, string * const file_contents, const string & full_file_path, string * const error_msg );
+static int inflate_gzip_chunk( z_stream * const strm, bool * const member_ended, const char * const chunk, const size_t chunk_size, string * const file_contents, const string & full_file_path, string * const error_msg );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// As with 'read_entire_file_contents()', a compressed file may be stored under its own name or with the gzip extension
+int TLine_Reader::open( const string & file_folder_path, const string & file_name )
+{
+	close();
+	
+	full_file_path = get_file_path( file_folder_path, file_name );
+	
+	if( does_file_exist( full_file_path ) == FALSE && does_file_exist( full_file_path + GZIP_FILE_EXTENSION ) == TRUE )
+	{
+		full_file_path += GZIP_FILE_EXTENSION;
+	}
+	
+	// zlib reads files that aren't gzip-compressed as they are (and reads concatenated gzip members, such as BGZF blocks)
+	file = gzopen( full_file_path.c_str(), "rb" );
+	
+	if( file == NULL )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TLine_Reader::open()': Unable to open file \"" + full_file_path + "\". ", __FILE__, __LINE__ );
+	}
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Read the next line (without its newline, or a carriage return before it) into 'line'.  'line_read' is FALSE once
+//   the end of the file has been reached
+int TLine_Reader::get_line( string * const line, bool * const line_read )
+{
+	*line_read = FALSE;
+	
+	if( file == NULL )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TLine_Reader::get_line()': No file is open. ", __FILE__, __LINE__ );
+	}
+	
+	
+	// Read more of the file until the line is complete, keeping only the part of the line already read
+	size_t line_end_pos = buffer.find( '\n', line_start_pos );
+	
+	while( line_end_pos == string::npos && end_of_file == FALSE )
+	{
+		buffer.erase( 0, line_start_pos );
+		line_start_pos = 0;
+		
+		const size_t prev_size = buffer.size();
+		buffer.resize( prev_size + LINE_READER_CHUNK_SIZE );
+		
+		const int num_bytes_read = gzread( file, &buffer[prev_size], LINE_READER_CHUNK_SIZE );
+		
+		if( num_bytes_read < 0 )
+		{
+			int zlib_error = Z_OK;
+			const char * zlib_msg = gzerror( file, &zlib_error );
+			
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TLine_Reader::get_line()': Unable to read file \"" + full_file_path + "\" (" + zlib_msg + "). ", __FILE__, __LINE__ );
+		}
+		
+		buffer.resize( prev_size + num_bytes_read );
+		
+		if( num_bytes_read == 0 ) { end_of_file = TRUE; }
+		
+		line_end_pos = buffer.find( '\n', prev_size );
+	}
+	
+	
+	// The last line needn't end with a newline
+	if( line_end_pos == string::npos )
+	{
+		if( line_start_pos == buffer.size() ) { return SUCCESSFUL; }
+		
+		line_end_pos = buffer.size();
+	}
+	
+	line->assign( buffer, line_start_pos, line_end_pos - line_start_pos );
+	
+	if( line->empty() == FALSE && (*line)[ line->size() - 1 ] == '\r' ) { line->erase( line->size() - 1 ); }
+	
+	line_start_pos = ( line_end_pos < buffer.size() ) ? line_end_pos + 1 : buffer.size();
+	*line_read = TRUE;
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+void TLine_Reader::close( void )
+{
+	if( file != NULL ) { gzclose( file ); }
+	
+	file = NULL;
+	buffer.clear();
+	line_start_pos = 0;
+	end_of_file = FALSE;
+	
+	return;
+}
+//==============================================================================
+
+
+
+// As with 'TLine_Reader', a compressed file may be stored under its own name or with the gzip extension
+int TChunk_Reader::open( const string & file_folder_path, const string & file_name )
+{
+	close();
+	
+	full_file_path = get_file_path( file_folder_path, file_name );
+	
+	if( does_file_exist( full_file_path ) == FALSE && does_file_exist( full_file_path + GZIP_FILE_EXTENSION ) == TRUE )
+	{
+		full_file_path += GZIP_FILE_EXTENSION;
+	}
+	
+	if( file.open( full_file_path ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TChunk_Reader::open()': Unable to open file \"" + full_file_path + "\". ", __FILE__, __LINE__ );
+	}
+	
+	file_open = TRUE;
+	
+	
+	// Within a parallel task, the chunks are read on this thread as they're asked for (see the class comment)
+	if( is_within_parallel_task() == FALSE )
+	{
+		parallel_inflate = TRUE;
+		prefetcher = thread( &TChunk_Reader::run_prefetcher, this );
+	}
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Get the next chunk of the (decompressed) file into 'chunk'.  Each chunk ends with a newline (one is added to the
+//   last if the file doesn't end with one), and begins where a line does.  'chunk_read' is FALSE once the end of the
+//   file has been reached
+int TChunk_Reader::get_chunk( string * const chunk, bool * const chunk_read )
+{
+	*chunk_read = FALSE;
+	chunk->clear();
+	
+	if( file_open == FALSE )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TChunk_Reader::get_chunk()': No file is open. ", __FILE__, __LINE__ );
+	}
+	
+	string error_msg;
+	
+	if( prefetcher.joinable() == FALSE )
+	{
+		if( read_next_chunk( chunk, chunk_read, &error_msg ) )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, error_msg, __FILE__, __LINE__ );
+		}
+		
+		return SUCCESSFUL;
+	}
+	
+	
+	unique_lock <mutex> queue_lock( queue_mutex );
+	while( chunk_queue.empty() == TRUE && prefetch_finished == FALSE ) { queue_cond.wait( queue_lock ); }
+	
+	if( chunk_queue.empty() == FALSE )
+	{
+		chunk->swap( chunk_queue.front() );
+		chunk_queue.pop_front();
+		*chunk_read = TRUE;
+		
+		// Room for the prefetch thread to read another chunk
+		queue_cond.notify_all();
+		
+		return SUCCESSFUL;
+	}
+	
+	// The prefetch thread has stopped, either after the last chunk or after an error (raised here, on the caller's thread)
+	error_msg = prefetch_error;
+	queue_lock.unlock();
+	
+	if( error_msg.empty() == FALSE )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, error_msg, __FILE__, __LINE__ );
+	}
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+void TChunk_Reader::close( void )
+{
+	if( prefetcher.joinable() == TRUE )
+	{
+		{
+			lock_guard <mutex> queue_lock( queue_mutex );
+			stop_prefetching = TRUE;
+			queue_cond.notify_all();
+		}
+		
+		prefetcher.join();
+	}
+	
+	if( gzip_stream != NULL )
+	{
+		inflateEnd( gzip_stream );
+		delete gzip_stream;
+	}
+	
+	file.close();
+	file_open = FALSE;
+	format = CHUNK_READER_FORMAT_UNKNOWN;
+	gzip_stream = NULL;
+	gzip_member_ended = FALSE;
+	parallel_inflate = FALSE;
+	compressed_buffer.clear();
+	partial_chunk.clear();
+	end_of_file = FALSE;
+	chunk_queue.clear();
+	prefetch_finished = FALSE;
+	stop_prefetching = FALSE;
+	prefetch_error.clear();
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Read (and decompress) the file until another chunk is complete.  Runs on the prefetch thread if there is one, so
+//   errors are described in 'error_msg' rather than raised
+int TChunk_Reader::read_next_chunk( string * const chunk, bool * const chunk_read, string * const error_msg )
+{
+	*chunk_read = FALSE;
+	chunk->clear();
+	
+	if( end_of_file == TRUE ) { return SUCCESSFUL; }
+	
+	string read_buffer( COMPRESSED_READ_CHUNK_SIZE, '\0' );
+	
+	while( TRUE )
+	{
+		const long long read_result = file.read( &read_buffer[0], read_buffer.size() );
+		
+		if( read_result < 0 )
+		{
+			*error_msg = (string)"Error in 'TChunk_Reader::read_next_chunk()': Unable to read file \"" + full_file_path + "\" (" + strerror( errno ) + "). ";
+			return NOT_SUCCESSFUL;
+		}
+		
+		const size_t num_bytes_read = read_result;
+		
+		
+		// Gzip and BGZF files are recognized by their first bytes (not their extension)
+		if( format == CHUNK_READER_FORMAT_UNKNOWN )
+		{
+			size_t first_block_size = 0;
+			
+			if( num_bytes_read < 2 || is_gzip_data( read_buffer ) == FALSE )
+			{
+				format = CHUNK_READER_FORMAT_PLAIN;
+			}
+			else if( parse_bgzf_header( read_buffer.data(), num_bytes_read, &first_block_size ) == BGZF_HEADER_VALID )
+			{
+				format = CHUNK_READER_FORMAT_BGZF;
+			}
+			else
+			{
+				format = CHUNK_READER_FORMAT_GZIP;
+				
+				gzip_stream = new z_stream;
+				gzip_stream->zalloc   = Z_NULL;
+				gzip_stream->zfree    = Z_NULL;
+				gzip_stream->opaque   = Z_NULL;
+				gzip_stream->next_in  = Z_NULL;
+				gzip_stream->avail_in = 0;
+				
+				// 16 + MAX_WBITS:  expect a gzip (rather than zlib) wrapper
+				if( inflateInit2( gzip_stream, 16 + MAX_WBITS ) != Z_OK )
+				{
+					delete gzip_stream;
+					gzip_stream = NULL;
+					
+					*error_msg = "Error in 'TChunk_Reader::read_next_chunk()': Unable to initialize zlib. ";
+					return NOT_SUCCESSFUL;
+				}
+			}
+		}
+		
+		
+		// Whatever is read is decompressed onto the end of the data not yet handed out
+		if( format == CHUNK_READER_FORMAT_PLAIN )
+		{
+			partial_chunk.append( read_buffer, 0, num_bytes_read );
+		}
+		else if( format == CHUNK_READER_FORMAT_GZIP )
+		{
+			if( inflate_gzip_chunk( gzip_stream, &gzip_member_ended, read_buffer.data(), num_bytes_read, &partial_chunk, full_file_path, error_msg ) ) { return NOT_SUCCESSFUL; }
+		}
+		else/*( format == CHUNK_READER_FORMAT_BGZF )*/
+		{
+			// A block cut off by the end of the read is finished by the next one
+			size_t num_used = 0;
+			compressed_buffer.append( read_buffer, 0, num_bytes_read );
+			
+			if( inflate_bgzf_blocks( compressed_buffer.data(), compressed_buffer.size(), parallel_inflate, &num_used, &partial_chunk, full_file_path, error_msg ) ) { return NOT_SUCCESSFUL; }
+			
+			compressed_buffer.erase( 0, num_used );
+		}
+		
+		
+		// A short read means the end of the file has been reached:  everything left is the last chunk
+		if( num_bytes_read < read_buffer.size() )
+		{
+			end_of_file = TRUE;
+			
+			if( ( format == CHUNK_READER_FORMAT_GZIP && gzip_member_ended == FALSE ) || ( format == CHUNK_READER_FORMAT_BGZF && compressed_buffer.empty() == FALSE ) )
+			{
+				*error_msg = (string)"Error in 'TChunk_Reader::read_next_chunk()': File \"" + full_file_path + "\" ended partway through compressed data. ";
+				return NOT_SUCCESSFUL;
+			}
+			
+			// As when the file was read line by line, every line (including the last) ends with a newline
+			if( partial_chunk.empty() == FALSE && partial_chunk[ partial_chunk.size() - 1 ] != '\n' ) { partial_chunk += '\n'; }
+			
+			chunk->swap( partial_chunk );
+			partial_chunk.clear();
+			*chunk_read = ( chunk->empty() == FALSE );
+			
+			return SUCCESSFUL;
+		}
+		
+		
+		// Hand out everything up to the last newline that has a non-empty line on either side of it, keeping the rest
+		//   for the next chunk.  (A search for the end of a CSV row steps over an empty line, so runs of them are kept
+		//   within one chunk, just as they are within the whole file)
+		size_t break_pos = ( partial_chunk.size() >= 2 ) ? partial_chunk.rfind( '\n', partial_chunk.size() - 2 ) : string::npos;
+		
+		while( break_pos != string::npos && ( break_pos == 0 || partial_chunk[break_pos - 1] == '\n' || partial_chunk[break_pos + 1] == '\n' ) )
+		{
+			break_pos = ( break_pos > 0 ) ? partial_chunk.rfind( '\n', break_pos - 1 ) : string::npos;
+		}
+		
+		if( break_pos != string::npos )
+		{
+			chunk->assign( partial_chunk, 0, break_pos + 1 );
+			partial_chunk.erase( 0, break_pos + 1 );
+			*chunk_read = TRUE;
+			
+			return SUCCESSFUL;
+		}
+	}
+}
+//------------------------------------------------------------------------------
+
+
+// Body of the prefetch thread:  read chunks until the end of the file, an error, or 'close()', keeping no more than
+//   CHUNK_READER_PREFETCH_DEPTH of them waiting to be taken by 'get_chunk()'
+void TChunk_Reader::run_prefetcher( void )
+{
+	while( TRUE )
+	{
+		string chunk;
+		bool chunk_read = FALSE;
+		string error_msg;
+		
+		const int read_status = read_next_chunk( &chunk, &chunk_read, &error_msg );
+		
+		unique_lock <mutex> queue_lock( queue_mutex );
+		while( chunk_read == TRUE && chunk_queue.size() >= CHUNK_READER_PREFETCH_DEPTH && stop_prefetching == FALSE ) { queue_cond.wait( queue_lock ); }
+		
+		if( read_status != SUCCESSFUL ) { prefetch_error = error_msg; }
+		
+		if( chunk_read == TRUE && stop_prefetching == FALSE )
+		{
+			chunk_queue.push_back( string() );
+			chunk_queue.back().swap( chunk );
+		}
+		
+		if( read_status != SUCCESSFUL || chunk_read == FALSE || stop_prefetching == TRUE ) { prefetch_finished = TRUE; }
+		
+		queue_cond.notify_all();
+		
+		if( prefetch_finished == TRUE ) { return; }
+	}
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+static unsigned int get_little_endian( const char * const bytes, const unsigned int num_bytes )
+{
+	unsigned int value = 0;
+
+	for( unsigned int i = num_bytes; i > 0; i-- ) { value = ( value << 8 ) | (unsigned char)bytes[i - 1]; }
+
+	return value;
+}
+//------------------------------------------------------------------------------
+
+
+// Check whether 'data' starts with a BGZF block header, and if so, get the size of the whole block (header, compressed
+//   data, and trailer)
+static int parse_bgzf_header( const char * const data, const size_t data_len, size_t * const block_size )
+{
+	if( data_len < BGZF_FIXED_HEADER_SIZE ) { return BGZF_HEADER_INCOMPLETE; }
+
+	if( (unsigned char)data[0] != GZIP_ID_1 || (unsigned char)data[1] != GZIP_ID_2 || ( data[3] & GZIP_FLAG_EXTRA ) == 0 )
+	{
+		return BGZF_HEADER_INVALID;
+	}
+
+	const size_t extra_len = get_little_endian( &data[10], 2 );
+
+	if( data_len < BGZF_FIXED_HEADER_SIZE + extra_len ) { return BGZF_HEADER_INCOMPLETE; }
+
+
+	// Search the extra subfields (each: 2-byte ID, 2-byte length, data) for the block size
+	size_t subfield_pos = BGZF_FIXED_HEADER_SIZE;
+
+	while( subfield_pos + 4 <= BGZF_FIXED_HEADER_SIZE + extra_len )
+	{
+		const size_t subfield_len = get_little_endian( &data[subfield_pos + 2], 2 );
+
+		if( data[subfield_pos] == BGZF_SUBFIELD_ID_1 && data[subfield_pos + 1] == BGZF_SUBFIELD_ID_2 && subfield_len == 2 )
+		{
+			*block_size = get_little_endian( &data[subfield_pos + 4], 2 ) + 1;
+
+			if( *block_size < BGZF_FIXED_HEADER_SIZE + extra_len + GZIP_TRAILER_SIZE ) { return BGZF_HEADER_INVALID; }
+
+			return BGZF_HEADER_VALID;
+		}
+
+		subfield_pos += 4 + subfield_len;
+	}
+
+	return BGZF_HEADER_INVALID;
+}
+//------------------------------------------------------------------------------
+
+
+// Decompress one complete BGZF block into 'output' (which must hold exactly the block's ISIZE bytes).  Only touches the
+//   block and 'output', so blocks can be decompressed concurrently
+static int inflate_bgzf_block( const char * const block, const size_t block_size, char * const output, const size_t output_size )
+{
+	const size_t data_start = BGZF_FIXED_HEADER_SIZE + get_little_endian( &block[10], 2 );
+
+	z_stream strm;
+	strm.zalloc = Z_NULL;
+	strm.zfree  = Z_NULL;
+	strm.opaque = Z_NULL;
+
+	// The deflate data within the block is raw (no zlib/gzip wrapper)
+	if( inflateInit2( &strm, -MAX_WBITS ) != Z_OK ) { return NOT_SUCCESSFUL; }
+
+	strm.next_in   = (Bytef *)( block + data_start );
+	strm.avail_in  = block_size - data_start - GZIP_TRAILER_SIZE;
+	strm.next_out  = (Bytef *)output;
+	strm.avail_out = output_size;
+
+	// Use a dummy output byte for the empty (end-of-file) block, so 'next_out' is never NULL
+	char empty_output = 0;
+	if( output_size == 0 ) { strm.next_out = (Bytef *)&empty_output; }
+
+	int inflate_result = inflate( &strm, Z_FINISH );
+	inflateEnd( &strm );
+
+	if( inflate_result != Z_STREAM_END || strm.avail_out != 0 ) { return NOT_SUCCESSFUL; }
+
+
+	const unsigned int expected_crc = get_little_endian( &block[block_size - GZIP_TRAILER_SIZE], 4 );
+
+	if( crc32( crc32( 0L, Z_NULL, 0 ), (const Bytef *)output, output_size ) != expected_crc ) { return NOT_SUCCESSFUL; }
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Decompress every complete BGZF block at the front of 'chunk' (in parallel, if 'parallel') and append the results to
+//   'file_contents'.  'num_used' is set to the number of bytes those blocks take up; an incomplete block at the end is
+//   left for the next chunk.  Errors are described in 'error_msg' rather than raised, as this may run on a prefetch thread
+static int inflate_bgzf_blocks( const char * const chunk, const size_t chunk_size, const bool parallel, size_t * const num_used, string * const file_contents, const string & full_file_path, string * const error_msg )
+{
+	vector <size_t> block_start( 0 );
+	vector <size_t> block_size ( 0 );
+	vector <size_t> output_start( 0 );
+
+	size_t block_pos = 0;
+	size_t output_pos = file_contents->size();
+
+	while( block_pos < chunk_size )
+	{
+		size_t curr_block_size = 0;
+		int header_status = parse_bgzf_header( &chunk[block_pos], chunk_size - block_pos, &curr_block_size );
+
+		if( header_status == BGZF_HEADER_INVALID )
+		{
+			*error_msg = (string)"Error in 'inflate_bgzf_blocks()': Invalid BGZF block header in file \"" + full_file_path + "\". ";
+			return NOT_SUCCESSFUL;
+		}
+
+		if( header_status == BGZF_HEADER_INCOMPLETE || block_pos + curr_block_size > chunk_size ) { break; }
+
+		block_start .push_back( block_pos  );
+		block_size  .push_back( curr_block_size );
+		output_start.push_back( output_pos );
+
+		output_pos += get_little_endian( &chunk[block_pos + curr_block_size - 4], 4 );
+		block_pos  += curr_block_size;
+	}
+
+	file_contents->resize( output_pos );
+	output_start.push_back( output_pos );
+
+
+	// Each block is decompressed straight into its place in 'file_contents'
+	vector <int> block_status( block_start.size(), SUCCESSFUL );
+
+	const TParallel_Task inflate_block = [&]( const unsigned int block_it )
+	{
+		const size_t block_output_size = output_start[block_it + 1] - output_start[block_it];
+		char * const block_output = ( block_output_size > 0 ) ? &(*file_contents)[ output_start[block_it] ] : NULL;
+
+		block_status[block_it] = inflate_bgzf_block( &chunk[ block_start[block_it] ], block_size[block_it], block_output, block_output_size );
+	};
+
+	if( parallel == TRUE )
+	{
+		parallel_for( block_start.size(), inflate_block );
+	}
+	else/*( parallel == FALSE )*/
+	{
+		for( unsigned int block_it = 0; block_it < block_start.size(); block_it++ ) { inflate_block( block_it ); }
+	}
+
+	for( unsigned int block_it = 0; block_it < block_status.size(); block_it++ )
+	{
+		if( block_status[block_it] != SUCCESSFUL )
+		{
+			ostringstream error_oss;
+			error_oss << "Error in 'inflate_bgzf_blocks()': BGZF block at compressed offset " << block_start[block_it] << " of the current chunk of file \""
+					  << full_file_path << "\" is corrupt. ";
+			*error_msg = error_oss.str();
+			return NOT_SUCCESSFUL;
+		}
+	}
+
+	*num_used = block_pos;
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Decompress the next chunk of a (non-BGZF) gzip file onto the end of 'file_contents'.  Files made of several
+//   concatenated gzip members are decompressed member by member.  As above, errors are described in 'error_msg'
+static int inflate_gzip_chunk( z_stream * const strm, bool * const member_ended, const char * const chunk, const size_t chunk_size, string * const file_contents, const string & full_file_path, string * const error_msg )
+{
+	vector <char> output_buffer( GZIP_INFLATE_BUFFER_SIZE );
+
+	strm->next_in  = (Bytef *)chunk;
+	strm->avail_in = chunk_size;
+
+	while( strm->avail_in > 0 )
+	{
+		// Another member follows the one that ended
+		if( *member_ended == TRUE )
+		{
+			inflateReset( strm );
+			*member_ended = FALSE;
+		}
+
+		strm->next_out  = (Bytef *)&output_buffer[0];
+		strm->avail_out = output_buffer.size();
+
+		int inflate_result = inflate( strm, Z_NO_FLUSH );
+
+		if( inflate_result != Z_OK && inflate_result != Z_STREAM_END && inflate_result != Z_BUF_ERROR )
+		{
+			*error_msg = (string)"Error in 'inflate_gzip_chunk()': Corrupt gzip data in file \"" + full_file_path + "\" (" +
+								 ( strm->msg != NULL ? strm->msg : "unknown zlib error" ) + "). ";
+			return NOT_SUCCESSFUL;
+		}
+
+		file_contents->append( &output_buffer[0], output_buffer.size() - strm->avail_out );
+
+		if( inflate_result == Z_STREAM_END ) { *member_ended = TRUE; }
+	}
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+// Gzip data (a gzip or BGZF file) starts with the gzip magic bytes
+bool is_gzip_data( const string & contents )
+{
+	return ( contents.size() >= 2 && (unsigned char)contents[0] == GZIP_ID_1 && (unsigned char)contents[1] == GZIP_ID_2 );
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,180 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__compressed_io.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the classes used to read gzip- and
+//				 BGZF-compressed input files, a chunk or a line at a time
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__COMPRESSED_IO_H_
+#define _SUPPORT__COMPRESSED_IO_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+// Project-specific header files:  support functions and related
+#include "support__filesystem.h"
+
+struct gzFile_s;		// zlib's file handle ('gzFile'), so that users of 'TLine_Reader' needn't include zlib
+struct z_stream_s;		// zlib's decompression state ('z_stream'), likewise for 'TChunk_Reader'
+
+#define CHUNK_READER_FORMAT_UNKNOWN		0		// Kinds of file read by 'TChunk_Reader'
+#define CHUNK_READER_FORMAT_PLAIN		1
+#define CHUNK_READER_FORMAT_GZIP		2
+#define CHUNK_READER_FORMAT_BGZF		3
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Reads a file one line at a time, holding no more than LINE_READER_CHUNK_SIZE bytes (plus the line being read) at
+//   once.  Gzip and BGZF files are decompressed as they're read; other files are read as they are
+class TLine_Reader
+{
+	private:
+		struct gzFile_s * file;
+		std::string full_file_path;
+
+		std::string buffer;
+		size_t line_start_pos;
+		bool end_of_file;
+
+		// Not copyable (owns the file handle)
+		TLine_Reader( const TLine_Reader & );
+		TLine_Reader & operator=( const TLine_Reader & );
+
+	public:
+		int  open( const std::string & file_folder_path, const std::string & file_name );
+		int  get_line( std::string * const line, bool * const line_read );
+		void close( void );
+
+		TLine_Reader( void ) : file( NULL ), line_start_pos( 0 ), end_of_file( FALSE ) { }
+		~TLine_Reader( void ) { close(); }
+};
+//==============================================================================
+
+
+
+// Reads a file in chunks of whole lines (about COMPRESSED_READ_CHUNK_SIZE bytes each), so that a chunk can be parsed
+//   while the next is read.  Gzip and BGZF files are recognized by their first bytes and decompressed chunk by chunk;
+//   other files are read as they are.  Unless the reader is opened from within a parallel task, a prefetch thread reads
+//   and decompresses up to CHUNK_READER_PREFETCH_DEPTH chunks ahead (BGZF blocks in parallel); within one, each chunk
+//   is read (and its blocks decompressed serially) when it's asked for, since the loop's other tasks already occupy the
+//   worker threads
+class TChunk_Reader
+{
+	private:
+		TSequential_File file;
+		std::string full_file_path;
+		bool file_open;
+
+		int  format;						// CHUNK_READER_FORMAT_..., known once the first bytes have been read
+		struct z_stream_s * gzip_stream;	// Non-BGZF gzip files only
+		bool gzip_member_ended;
+		bool parallel_inflate;
+
+		std::string compressed_buffer;		// Start of a BGZF block cut off by the end of the last read
+		std::string partial_chunk;			// Decompressed data not yet handed out (after the last line break)
+		bool end_of_file;
+
+		// Prefetching
+		std::thread prefetcher;
+		std::mutex queue_mutex;
+		std::condition_variable queue_cond;
+		std::deque <std::string> chunk_queue;
+		bool prefetch_finished;
+		bool stop_prefetching;
+		std::string prefetch_error;
+
+		int  read_next_chunk( std::string * const chunk, bool * const chunk_read, std::string * const error_msg );
+		void run_prefetcher( void );
+
+		// Not copyable (owns the file and the prefetch thread)
+		TChunk_Reader( const TChunk_Reader & );
+		TChunk_Reader & operator=( const TChunk_Reader & );
+
+	public:
+		int  open( const std::string & file_folder_path, const std::string & file_name );
+		int  get_chunk( std::string * const chunk, bool * const chunk_read );
+		void close( void );
+
+		TChunk_Reader( void ) : file_open( FALSE ), format( CHUNK_READER_FORMAT_UNKNOWN ), gzip_stream( NULL ), gzip_member_ended( FALSE ), parallel_inflate( FALSE ),
+								end_of_file( FALSE ), prefetch_finished( FALSE ), stop_prefetching( FALSE ) { }
+		~TChunk_Reader( void ) { close(); }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+bool is_gzip_data( const std::string & contents );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__COMPRESSED_IO_H_
@@ -43,12 +43,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
-#include <windows.h>
 #include <sstream>
 #include <fstream>
 #include <string>
 #include <vector>
-#include <windows.h>
 #include <time.h>   	// For time() and related formatting functions
 #include <typeinfo>
 
@@ -59,10 +57,16 @@ using namespace std;
 
 // Project-specific header files:  support functions and related
 #include "support__file_io.h"
+#include "support__compressed_io.h"
+#include "support__filesystem.h"
 
 // Header file for this file
 #include "support__general.h"
 
+
+// Defined in section D
+static void convert_line_endings( string * const contents );
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -145,7 +149,7 @@ int TFasta_Content::get_contents( void )
 		string temp_sequence = temp_contents->substr( seq_start_pos, ( seq_end_pos - seq_start_pos + 1 ) );
 		remove_new_lines( &temp_sequence );
 
-		sequence.push_back( temp_sequence );
+		sequence.push_back( TPacked_Chrom( temp_sequence ) );
 	}
 
 	// Now that the file has been parsed, 'temp_contents' can be deleted to free memory
@@ -172,14 +176,14 @@ int TFasta_Content::get_contents_from_gff( void )
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'get_contents_from_gff()': File was not of .gff format. ", __FILE__, __LINE__ );
 	}
 	
-	unsigned int fasta_id_pos = temp_contents->find( GFF_FILE_FASTA_ID );
+	size_t fasta_id_pos = temp_contents->find( GFF_FILE_FASTA_ID );
 	
 	if( fasta_id_pos == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'get_contents_from_gff()': .gff file did not contain the FASTA identifier. ", __FILE__, __LINE__ );
 	}
 	
-	unsigned int fasta_start_pos = fasta_id_pos + ((string)GFF_FILE_FASTA_ID).size();
+	size_t fasta_start_pos = fasta_id_pos + ((string)GFF_FILE_FASTA_ID).size();
 	
 	
 	size_t next_chrom_start_pos = temp_contents->find( "\nchr" );
@@ -257,7 +261,7 @@ int TFasta_Content::get_contents_from_gff( void )
 //------------------------------------------------------------------------------
 
 
-vector <string> TFasta_Content::get_gff_annotations( void ) const
+const vector <string> & TFasta_Content::get_gff_annotations( void ) const
 {
 	if( gff_annotations_init == UNINITIALIZED )
 	{
@@ -281,20 +285,70 @@ void TCSV_Contents::parse_csv( void )
 		Errors.handle_error( FATAL, error_oss.str(), __FILE__, __LINE__ );
 	}
 
+	// The rows in each chunk of the file are parsed as soon as it has been read (and decompressed); reading and
+	//   decompressing the next chunk continues meanwhile (see 'TChunk_Reader')
+	TChunk_Reader csv_reader;
+	size_t file_size = 0;
+
 	string csv_buf;
-	read_entire_file_contents( file_folder_path, file_name, &csv_buf );
-	if( csv_buf.size() == 0 )
+	int read_status = csv_reader.open( file_folder_path, file_name );
+	bool chunk_read = ( read_status == SUCCESSFUL );
+
+	while( chunk_read == TRUE )
+	{
+		read_status = csv_reader.get_chunk( &csv_buf, &chunk_read );
+
+		if( chunk_read == TRUE )
+		{
+			convert_line_endings( &csv_buf );
+			file_size += csv_buf.size();
+
+			parse_csv_rows( &csv_buf );
+		}
+	}
+
+	if( read_status != SUCCESSFUL )
+	{
+		ostringstream error_oss;
+		error_oss << "File \"" << file_name << "\" could not be parsed as a CSV, since it could not be read. ";
+		Errors.handle_error( FATAL, error_oss.str(), __FILE__, __LINE__ );
+	}
+
+	if( file_size == 0 )
 	{
 		ostringstream error_oss;
 		error_oss << "File \"" << file_name << "\" could not be parsed as a CSV, since it was empty. ";
 		Errors.handle_error( FATAL, error_oss.str(), __FILE__, __LINE__ );
 	}
 
+
+	// Make sure all rows have the same number of columns
+	unsigned int longest_row = 0;
+	for( unsigned int row_num = 0; row_num < cell_contents.size(); row_num++)
+	{
+		if( cell_contents[row_num].size() > longest_row ) { longest_row = cell_contents[row_num].size(); }
+	}
+
+	for( unsigned int row_num = 0; row_num < cell_contents.size(); row_num++)
+	{
+		if( cell_contents[row_num].size() < longest_row ) { cell_contents[row_num].resize( longest_row, ""); }
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Parse the rows of one chunk of the file (ending with a newline, and starting where a row does), adding them to
+//   'cell_contents'.  Escaped quotes are removed from 'csv_chunk' as they're found
+void TCSV_Contents::parse_csv_rows( string * const csv_chunk )
+{
+	string & csv_buf = *csv_chunk;
 	size_t cell_start_pos = 0;
 
 
 	bool end_of_file = FALSE;
-	unsigned int row_num = 0;
+	unsigned int row_num = cell_contents.size();
 	size_t next_row_start_pos = 0;
 
 	while( end_of_file == FALSE )
@@ -390,19 +444,6 @@ void TCSV_Contents::parse_csv( void )
 		row_num++;
 	}
 
-
-	// Make sure all rows have the same number of columns
-	unsigned int longest_row = 0;
-	for( unsigned int row_num = 0; row_num < cell_contents.size(); row_num++)
-	{
-		if( cell_contents[row_num].size() > longest_row ) { longest_row = cell_contents[row_num].size(); }
-	}
-
-	for( unsigned int row_num = 0; row_num < cell_contents.size(); row_num++)
-	{
-		if( cell_contents[row_num].size() < longest_row ) { cell_contents[row_num].resize( longest_row, ""); }
-	}
-
 	return;
 }
 //------------------------------------------------------------------------------
@@ -478,6 +519,16 @@ void TCSV_Contents::resize_rows( const unsigned int num_rows )
 //------------------------------------------------------------------------------
 
 
+// Release the parsed cells (unlike 'resize_rows( 0 )', which keeps the memory allocated)
+void TCSV_Contents::clear( void )
+{
+	std::vector <std::vector <std::string> >().swap( cell_contents );
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+
 // Note that this is 1-indexed	
 void TCSV_Contents::add_column( const unsigned int col_num, const vector <string> & cell_column )
 {
@@ -839,55 +890,85 @@ void TCSV_Contents::write_back_to_csv( const string & fpath, const string & fnam
 
 //==============================================================================
 
+// Files are read in binary mode, so on Windows "\r\n" is converted to "\n" here (as a text mode read would).  Applied
+//   to each chunk read by a 'TChunk_Reader' (a line never spans two chunks)
+static void convert_line_endings( string * const contents )
+{
+	#ifdef _WIN32
+		size_t kept_size = 0;
+		
+		for( size_t i = 0; i < contents->size(); i++ )
+		{
+			if( (*contents)[i] == '\r' && i + 1 < contents->size() && (*contents)[i + 1] == '\n' ) { continue; }
+			
+			(*contents)[kept_size++] = (*contents)[i];
+		}
+		
+		contents->resize( kept_size );
+	#else
+		(void)contents;
+	#endif
+	
+	return;
+}
+//==============================================================================
+
+
+
 int read_entire_file_contents( string file_folder_path, string file_name, string * file_contents )
 {
-	// Open the ini file
-	ifstream ifstream_file;
-	ifstream_file.open( (file_folder_path + PATH_FOLDER_SEPARATOR + file_name).c_str(), ifstream::in );
+	// Compressed files may be stored either under their own name or with the gzip extension added (see
+	//   'TChunk_Reader::open()')
+	const string full_file_path = get_file_path( file_folder_path, file_name );
 	
-    // If the attempt to open the file fails, the file very likely does not already exist
-	if ( ifstream_file.fail() )
-    {
+	if( does_file_exist( full_file_path ) == FALSE && does_file_exist( full_file_path + GZIP_FILE_EXTENSION ) == FALSE )
+	{
 		ostringstream error_oss;
 		error_oss << ((string)"In 'read_entire_file_contents()', unable to open (for reading) file \"" + file_name + "\" at path \n" +
 						 "              \"" + file_folder_path + "\".\nFile likely does not exist or is currently open" );
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
-    }
+	}
 	
-	// Read all of the contents of the file into a string, one line at a time
-	*file_contents = "";
-    string temp_string;
-
-    getline( ifstream_file, temp_string ); // Perform a preliminary read, entering the while loop if the file has at least one line
-    
-    while ( ifstream_file.fail() == 0 )   // 'getline()' will flag an error/failure when it runs out of lines to read in the file
-    {
-        *file_contents += temp_string + '\n';  // 'getline()' ends after each newline, but the newline isn't extracted, and so must be manually appended
-
-        getline( ifstream_file, temp_string );     // Attempt to read the next line of the file, exiting from the while loop during the next iteration if no add'l lines are present
+	
+	// The file is read (and, if compressed, decompressed) a chunk at a time, so the compressed file is never held in
+	//   memory alongside the decompressed one
+	TChunk_Reader file_reader;
+	
+	if( file_reader.open( file_folder_path, file_name ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"In 'read_entire_file_contents()', unable to read file \"" + file_name + "\". ", __FILE__, __LINE__ );
 	}
-    
-	// Close the file stream, checking for any errors, and return its contents in string form
-    ifstream_file.clear();  // Reset status of error bits, which were flagged after the last line failed to be read above
-    ifstream_file.close();
-	if ( ifstream_file.fail() )
+	
+	file_contents->clear();
+	
+	string chunk;
+	bool chunk_read = TRUE;
+	
+	while( TRUE )
 	{
-		ostringstream error_oss;
-		error_oss << ((string)"In 'read_entire_file_contents()', unable to close file \"" + file_name + "\" at path \n" + 
-							  "              \"" + file_folder_path + "\".\n" );
-		return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
+		if( file_reader.get_chunk( &chunk, &chunk_read ) )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"In 'read_entire_file_contents()', unable to read (or decompress) file \"" + file_name + "\". ", __FILE__, __LINE__ );
+		}
+		
+		if( chunk_read == FALSE ) { break; }
+		
+		convert_line_endings( &chunk );
+		
+		if( file_contents->empty() == TRUE ) { file_contents->swap( chunk ); }
+		else 								 { file_contents->append( chunk ); }
 	}
 	
-
 	return SUCCESSFUL;
 }
 //==============================================================================
 
 
 
-int write_file_contents( const string file_folder_path, const string file_name, const string file_contents, const bool overwrite_file )
+int write_file_contents( const string file_folder_path, const string file_name, const string file_contents, const bool overwrite_file, const bool binary_file )
 {
-	const string full_file_path = file_folder_path + PATH_FOLDER_SEPARATOR + file_name;
+	const string full_file_path    = get_file_path( file_folder_path, file_name );
+	const string partial_file_path = get_partial_file_path( full_file_path );
 	
 	bool did_file_exist;
 	// Create the folder specified by the file path (or check that it already exists)
@@ -919,24 +1000,25 @@ int write_file_contents( const string file_folder_path, const string file_name,
 	}
 	
 	
-	// Open an output file stream to the specified file
+	// Open an output file stream to a partial file alongside the specified file (moved into place once complete)
 	ofstream ofstream_file;
+	const ios_base::openmode open_mode = ( binary_file == YES ) ? ( ofstream::out | ofstream::binary ) : ofstream::out;
 	
 	
-	ofstream_file.open( full_file_path.c_str(), ofstream::out );
+	ofstream_file.open( partial_file_path.c_str(), open_mode );
 	if ( ofstream_file.fail() != 0 )  // 'ofstream.open()' will cause 'fail()' to return false if the open operation is not successful
 	{
 		// If opening the file stream fails, request that the user closes the file and try again
-		output_text_line( (string)"Unable to open file '" + full_file_path + 
+		output_text_line( (string)"Unable to open file '" + partial_file_path + 
 								  "'.  Check that file is closed, then press any key to continue." );
 								  
 		cin.ignore( 1 );
 	
 	
-		ofstream_file.open( full_file_path.c_str(), ofstream::out );
+		ofstream_file.open( partial_file_path.c_str(), open_mode );
 		if ( ofstream_file.fail() != 0 ) 
 		{
-			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'write_file_contents()': Still unable to open file '" + full_file_path + 
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'write_file_contents()': Still unable to open file '" + partial_file_path + 
 																   "' using 'ofstream.open()'. ", __FILE__, __LINE__ );
 		}
 	}
@@ -949,9 +1031,17 @@ int write_file_contents( const string file_folder_path, const string file_name,
 	
 	if ( ofstream_file.fail() != 0 )  // 'ofstream.close()' will cause 'fail()' to return false if the close operation is not successful
 	{
-		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'write_file_contents()': Unable to close file '" + full_file_path + "' using 'ofstream.close()'",__FILE__, __LINE__ );
+		remove( partial_file_path.c_str() );
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'write_file_contents()': Unable to close file '" + partial_file_path + "' using 'ofstream.close()'",__FILE__, __LINE__ );
 	}
-		
+	
+	// Replace the specified file with the now-complete partial file
+	if( replace_file( partial_file_path, full_file_path ) )
+	{
+		remove( partial_file_path.c_str() );
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'write_file_contents()': ", __FILE__, __LINE__ );
+	}
+	
 	
 	return SUCCESSFUL;
 }
@@ -1009,30 +1099,9 @@ int create_file( const string file_folder_path, const string file_name, bool * c
 
 int check_if_file_exists( const string file_folder_path, const string file_name, bool * const did_file_already_exist )
 {
-	ifstream ifstream_target_file;
-	ifstream_target_file.open( (file_folder_path + PATH_FOLDER_SEPARATOR + file_name).c_str(), ifstream::in );
-    
-    // If the attempt to open the file was successful, the file already exists - update the tracking flag accordingly
-    if( ifstream_target_file.fail() == false )
-    {                      
-        ifstream_target_file.close();
-        if ( ifstream_target_file.fail() == true )
-        {
-            return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'check_if_file_exists()': Error closing ifstream for existing file\n" + 
-																   "    \"" + file_name + "\"\n" +
-																   "at path\n" +
-																   "    \"" + file_folder_path + "\"\n" +
-																   "in 'create_file()'." );
-        }
-        
-
-		if( did_file_already_exist != NULL ) { *did_file_already_exist = TRUE; }
-        return SUCCESSFUL;
-    }
-	else/*( ifstream_target_file.fail() == true )*/
-	{
-		if( did_file_already_exist != NULL ) { *did_file_already_exist = FALSE; }
-	}
+	const bool file_exists = does_file_exist( get_file_path( file_folder_path, file_name ) );
+	
+	if( did_file_already_exist != NULL ) { *did_file_already_exist = ( file_exists ? TRUE : FALSE ); }
 	
 	return SUCCESSFUL;
 }
@@ -1082,26 +1151,24 @@ bool create_folder( const string & arg_folder_abs_path )
         }
 
         // Create or verify this level of the absolute path
-        if ( CreateDirectory( (curr_folder_path + curr_folder_name).c_str(), NULL ) != 0 )
+        bool did_folder_already_exist = FALSE;
+        if ( make_directory( curr_folder_path + curr_folder_name, &did_folder_already_exist ) )
+        {
+            return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'create_folder()':  can't create folder\n" +
+																   "  \"" + curr_folder_name + "\"\n" +
+																   "at path\n" +
+																   "  \"" + curr_folder_path + "\"" );
+        }
+
+        if ( did_folder_already_exist == FALSE )
         {
             output_text_debug_only( (string)"  ~ Created folder \"" + curr_folder_name + "\" at path\n"
                                             "      \"" + curr_folder_path + "\"\n" );
         }
-        else // ( CreateDirectory( path_root_folder, NULL ) == 0 )
+        else // ( did_folder_already_exist == TRUE )
         {
-            DWORD error_no = GetLastError();
-            if ( error_no == ERROR_ALREADY_EXISTS )
-            {
-                output_text_debug_only( (string)"  ~ Folder \"" + curr_folder_name + "\" already exists at path\n" +
-                                                "      \"" + curr_folder_path + "\"\n" );
-            }
-            else // ( error_no == ERROR_PATH_NOT_FOUND )
-            {
-                return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'create_folder()':  error_no != 0, error_no != ERROR_ALREADY_EXISTS -- can't create folder\n" +
-																	   "  \"" + curr_folder_name + "\"\n" +
-																	   "at path\n" +
-																	   "  \"" + curr_folder_path + "\"" );
-            }
+            output_text_debug_only( (string)"  ~ Folder \"" + curr_folder_name + "\" already exists at path\n" +
+                                            "      \"" + curr_folder_path + "\"\n" );
         }
 
         curr_path_sep = next_path_pos;
@@ -30,7 +30,7 @@
 //     *B. Global Variable Declarations (including those in other files)
 //      C. Type (and Member Function) Declarations and Definitions
 //      D. Non-Member Function Declarations
-//     *E. Templated (Non-Member) Function Declarations and Definitions
+//      E. Templated (Non-Member) Function Declarations and Definitions
 //     *F. Inline (Non-Member) Function Declarations and Definitions
 //     *G. UNUSED Non-Member Function Declarations
 //
@@ -52,10 +52,14 @@
 // Standard libraries and related
 #include <string>
 #include <vector>
+#include <cstring>
 
 // Project-specific header files:  definitions and related information
 #include "defs__general.h"
 
+// Project-specific header files:  support functions and related
+#include "support__packed_genome.h"
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -86,12 +90,12 @@ class TFasta_Content
 
 	public:
 		std::vector <std::string> descr;
-		std::vector <std::string> sequence;
+		std::vector <TPacked_Chrom> sequence;		// Packed at 2 bits per nucleotide, shared by every stage
 
 		int get_contents();
 		int get_contents_from_gff();
 		
-		std::vector <std::string> get_gff_annotations( void ) const;
+		const std::vector <std::string> & get_gff_annotations( void ) const;
 		
 
 		TFasta_Content( std::string fpath, std::string fname ) :
@@ -101,7 +105,7 @@ class TFasta_Content
 			file_read( FALSE ),
 			gff_annotations_init( UNINITIALIZED ),
 			descr( std::vector <std::string>(0) ),
-			sequence( std::vector <std::string>(0) )
+			sequence( std::vector <TPacked_Chrom>(0) )
 		{ }
 		
 		~TFasta_Content( void )
@@ -121,6 +125,8 @@ class TCSV_Contents
 		
 		std::vector <std::vector <std::string> > cell_contents;
 
+		void parse_csv_rows( std::string * const csv_chunk );
+
 	public:
 		
 		void parse_csv( void );
@@ -131,6 +137,8 @@ class TCSV_Contents
 		void append_row( const std::vector <std::string> & cell_row );
 		void replace_row( const unsigned int row_num, const std::vector <std::string> & new_cell_row );
 		void resize_rows( const unsigned int num_rows );
+		unsigned int get_num_rows( void ) const { return cell_contents.size(); }
+		void clear( void );
 		
 		void add_column( const unsigned int col_num, const std::vector <std::string> & cell_column );
 		void append_column( const std::vector <std::string> & cell_column );
@@ -176,7 +184,7 @@ class TCSV_Contents
 ////////////////////////////////////////////////////////////////////////////////
 
 int read_entire_file_contents( std::string file_folder_path, std::string file_name, std::string * file_contents );
-int write_file_contents( const std::string file_folder_path, const std::string file_name, const std::string file_contents, const bool overwrite_file = YES );
+int write_file_contents( const std::string file_folder_path, const std::string file_name, const std::string file_contents, const bool overwrite_file = YES, const bool binary_file = NO );
 int create_file( const std::string file_folder_path, const std::string file_name, bool * const did_file_already_exist  = NULL );
 int check_if_file_exists( const std::string file_folder_path, const std::string file_name, bool * const did_file_already_exist );
 bool create_folder( const std::string & arg_folder_abs_path );
@@ -189,6 +197,44 @@ std::string format_csv_field_with_quotes( std::string * const str_to_modify );
 
 
 
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// E. Templated (Non-Member) Function Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Appends the bytes of 'value' (in the machine's byte order) to the contents of a binary file
+template <class type>
+void append_binary_value( std::string * const file_contents, const type & value )
+{
+	file_contents->append( reinterpret_cast <const char *>( &value ), sizeof( value ) );
+	
+	return;
+}
+//==============================================================================
+
+
+
+// Reads a value appended by 'append_binary_value()' from 'file_contents' at '*pos', then moves '*pos' past it.  Returns
+//   FALSE (leaving both unchanged) if the contents end first
+template <class type>
+bool extract_binary_value( const std::string & file_contents, size_t * const pos, type * const value )
+{
+	if( *pos > file_contents.size() || file_contents.size() - *pos < sizeof( type ) ) { return FALSE; }
+	
+	memcpy( value, file_contents.data() + *pos, sizeof( type ) );
+	*pos += sizeof( type );
+	
+	return TRUE;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
 #endif  // _SUPPORT__FILE_IO_H_
 
 
@@ -0,0 +1,358 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__filesystem.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code wrapping the file system calls (including sequential
+//				 file reads) which differ between Windows and POSIX systems
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>		// For min()
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+
+// Header file for this file
+#include "support__filesystem.h"
+
+
+
+#define DIRECT_IO_ALIGNMENT			4096		// 'O_DIRECT' buffers, offsets, and lengths must be multiples of the block size
+#define DIRECT_IO_BUFFER_SIZE		4194304
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+TSequential_File::TSequential_File( void ) :
+	file_open( FALSE )
+	#ifndef _WIN32
+		, file_descriptor( -1 ),
+		direct_buffer( NULL ),
+		direct_buffer_pos( 0 ),
+		direct_buffer_len( 0 ),
+		direct_end_of_file( FALSE )
+	#endif
+{ }
+//------------------------------------------------------------------------------
+
+
+int TSequential_File::open( const string & file_path )
+{
+	close();
+
+	full_file_path = file_path;
+
+	#ifdef _WIN32
+		ifstream_file.open( full_file_path.c_str(), ifstream::in | ifstream::binary );
+
+		if( ifstream_file.fail() )
+		{
+			ifstream_file.clear();
+
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TSequential_File::open()': Unable to open file \"" + full_file_path + "\". ", __FILE__, __LINE__ );
+		}
+	#else
+		file_descriptor = ::open( full_file_path.c_str(), O_RDONLY );
+
+		if( file_descriptor < 0 )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TSequential_File::open()': Unable to open file \"" + full_file_path + "\" (" + strerror( errno ) + "). ", __FILE__, __LINE__ );
+		}
+
+		// If the file system doesn't support direct I/O, the file is read through the page cache after all
+		#if defined( ENABLE_DIRECT_IO ) && defined( O_DIRECT )
+			struct stat file_status;
+
+			if( fstat( file_descriptor, &file_status ) == 0 && (size_t)file_status.st_size >= DIRECT_IO_MIN_FILE_SIZE )
+			{
+				int direct_file_descriptor = ::open( full_file_path.c_str(), O_RDONLY | O_DIRECT );
+				void * aligned_buffer = NULL;
+
+				if( direct_file_descriptor >= 0 && posix_memalign( &aligned_buffer, DIRECT_IO_ALIGNMENT, DIRECT_IO_BUFFER_SIZE ) == 0 )
+				{
+					::close( file_descriptor );
+					file_descriptor = direct_file_descriptor;
+					direct_buffer = (char *)aligned_buffer;
+				}
+				else if( direct_file_descriptor >= 0 )
+				{
+					::close( direct_file_descriptor );
+				}
+			}
+		#endif
+
+		#ifdef POSIX_FADV_SEQUENTIAL
+			if( direct_buffer == NULL ) { posix_fadvise( file_descriptor, 0, 0, POSIX_FADV_SEQUENTIAL ); }
+		#endif
+	#endif
+
+	file_open = TRUE;
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Read the next 'max_bytes' bytes of the file into 'buffer'.  Returns the number of bytes read, which is only less than
+//   'max_bytes' once the end of the file has been reached, or -1 if the file couldn't be read ('errno' says why)
+long long TSequential_File::read( char * const buffer, const size_t max_bytes )
+{
+	if( file_open == FALSE ) { errno = EBADF; return -1; }
+
+	size_t num_read = 0;
+
+	#ifdef _WIN32
+		ifstream_file.read( buffer, max_bytes );
+		num_read = ifstream_file.gcount();
+
+		if( ifstream_file.bad() ) { errno = EIO; return -1; }
+	#else
+		while( num_read < max_bytes )
+		{
+			// 'O_DIRECT' reads fill the aligned buffer, which is then copied from
+			if( direct_buffer != NULL && direct_buffer_pos < direct_buffer_len )
+			{
+				const size_t num_copied = min( max_bytes - num_read, direct_buffer_len - direct_buffer_pos );
+
+				memcpy( buffer + num_read, direct_buffer + direct_buffer_pos, num_copied );
+				num_read += num_copied;
+				direct_buffer_pos += num_copied;
+
+				continue;
+			}
+
+			if( direct_buffer != NULL && direct_end_of_file == TRUE ) { break; }
+
+
+			ssize_t read_result = 0;
+
+			if( direct_buffer != NULL ) { read_result = ::read( file_descriptor, direct_buffer, DIRECT_IO_BUFFER_SIZE ); }
+			else 						{ read_result = ::read( file_descriptor, buffer + num_read, max_bytes - num_read ); }
+
+			if( read_result < 0 && errno == EINTR ) { continue; }
+			if( read_result < 0 ) { return -1; }
+
+			if( direct_buffer != NULL )
+			{
+				// A short read is only returned at the end of the file (after which the offset is no longer aligned)
+				if( read_result < DIRECT_IO_BUFFER_SIZE ) { direct_end_of_file = TRUE; }
+
+				direct_buffer_pos = 0;
+				direct_buffer_len = read_result;
+			}
+			else/*( direct_buffer == NULL )*/
+			{
+				if( read_result == 0 ) { break; }
+
+				num_read += read_result;
+			}
+		}
+	#endif
+
+	return num_read;
+}
+//------------------------------------------------------------------------------
+
+
+void TSequential_File::close( void )
+{
+	#ifdef _WIN32
+		if( file_open == TRUE ) { ifstream_file.close(); }
+
+		ifstream_file.clear();
+	#else
+		if( file_descriptor >= 0 ) { ::close( file_descriptor ); }
+
+		free( direct_buffer );
+
+		file_descriptor = -1;
+		direct_buffer = NULL;
+		direct_buffer_pos = 0;
+		direct_buffer_len = 0;
+		direct_end_of_file = FALSE;
+	#endif
+
+	file_open = FALSE;
+
+	return;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+string get_file_path( const string & file_folder_path, const string & file_name )
+{
+	return file_folder_path + PATH_FOLDER_SEPARATOR + file_name;
+}
+//------------------------------------------------------------------------------
+
+
+// Outputs are written to this path, then moved into place by 'replace_file()' once complete, so an interrupted run never
+//   leaves a partially written file under the real name
+string get_partial_file_path( const string & full_file_path )
+{
+	return full_file_path + PARTIAL_FILE_EXTENSION;
+}
+//==============================================================================
+
+
+
+// Create a single folder (its parent must already exist)
+int make_directory( const string & folder_path, bool * const did_folder_already_exist )
+{
+	*did_folder_already_exist = FALSE;
+
+	#ifdef _WIN32
+		if( CreateDirectory( folder_path.c_str(), NULL ) == 0 )
+		{
+			if( GetLastError() != ERROR_ALREADY_EXISTS )
+			{
+				return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'make_directory()': Unable to create folder \"" + folder_path + "\". ", __FILE__, __LINE__ );
+			}
+
+			*did_folder_already_exist = TRUE;
+		}
+	#else
+		if( mkdir( folder_path.c_str(), 0777 ) != 0 )
+		{
+			if( errno != EEXIST )
+			{
+				return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'make_directory()': Unable to create folder \"" + folder_path + "\" (" + strerror( errno ) + "). ", __FILE__, __LINE__ );
+			}
+
+			*did_folder_already_exist = TRUE;
+		}
+	#endif
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+bool does_file_exist( const string & full_file_path )
+{
+	struct stat file_status;
+
+	if( stat( full_file_path.c_str(), &file_status ) != 0 ) { return FALSE; }
+
+	return ( ( file_status.st_mode & S_IFMT ) != S_IFDIR );
+}
+//==============================================================================
+
+
+
+// Move a completed output file over the file it replaces.  The move is atomic, so other processes (and later runs) see
+//   either the old file or the complete new one
+int replace_file( const string & partial_file_path, const string & full_file_path )
+{
+	#ifdef _WIN32
+		if( MoveFileEx( partial_file_path.c_str(), full_file_path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH ) == 0 )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'replace_file()': Unable to move \"" + partial_file_path + "\" to \"" + full_file_path + "\". ", __FILE__, __LINE__ );
+		}
+	#else
+		if( rename( partial_file_path.c_str(), full_file_path.c_str() ) != 0 )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'replace_file()': Unable to move \"" + partial_file_path + "\" to \"" + full_file_path + "\" (" + strerror( errno ) + "). ", __FILE__, __LINE__ );
+		}
+	#endif
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__filesystem.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the functions (and the sequential file
+//				 reader) that wrap the file system calls which differ between
+//				 Windows and POSIX systems
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__FILESYSTEM_H_
+#define _SUPPORT__FILESYSTEM_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <fstream>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Reads a file, as is (in binary mode), from start to end.  On POSIX systems the kernel is told to read ahead
+//   ('posix_fadvise()'); if 'ENABLE_DIRECT_IO' is defined, files of at least 'DIRECT_IO_MIN_FILE_SIZE' bytes are read with
+//   'O_DIRECT' instead, through an aligned buffer of the reader's own.  'read()' raises no errors, so the file may be
+//   read from a thread other than the one that opened it
+class TSequential_File
+{
+	private:
+		bool file_open;
+		std::string full_file_path;
+
+		#ifdef _WIN32
+			std::ifstream ifstream_file;
+		#else
+			int file_descriptor;
+			char * direct_buffer;			// NULL unless the file was opened with 'O_DIRECT'
+			size_t direct_buffer_pos;
+			size_t direct_buffer_len;
+			bool direct_end_of_file;
+		#endif
+
+		// Not copyable (owns the file)
+		TSequential_File( const TSequential_File & );
+		TSequential_File & operator=( const TSequential_File & );
+
+	public:
+		int  open( const std::string & file_path );
+		long long read( char * const buffer, const size_t max_bytes );
+		void close( void );
+
+		TSequential_File( void );
+		~TSequential_File( void ) { close(); }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+std::string get_file_path( const std::string & file_folder_path, const std::string & file_name );
+std::string get_partial_file_path( const std::string & full_file_path );
+
+int  make_directory( const std::string & folder_path, bool * const did_folder_already_exist );
+bool does_file_exist( const std::string & full_file_path );
+
+int  replace_file( const std::string & partial_file_path, const std::string & full_file_path );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__FILESYSTEM_H_
@@ -44,13 +44,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
-#include <windows.h>
 #include <string>
 #include <vector>
 #include <time.h>
 #include <cmath>
 #include <iomanip>      // For controlling how doubles are displayed using "setprecision()" and "fixed"/"scientific"
 #include <algorithm>    // For "sort()"
+#include <unordered_set>
+#include <cstring>
+#include <cctype>
 
 using namespace std;
 
@@ -80,6 +82,8 @@ using namespace std;
 TErrors Errors;						// Stores information about errors and responds to them in several ways
 extern TProgram_Log Program_Log;
 
+static thread_local TTask_Error_Scope * current_task_scope = NULL;		// The task (if any) running on this thread
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -109,7 +113,7 @@ void TErrors::fatal_error_response( )
 	output_text_line( (string)"\n" +
 							  "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n" +
 							  "!! FATAL ERROR OCCURRED\n" +
-							  "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n\n" );
+							  "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n\n", LOG_LEVEL_ERROR );
 
 
 	// Assemble the formatted error message to display to the user in a message box, first showing the source file and line number
@@ -119,10 +123,10 @@ void TErrors::fatal_error_response( )
 
 	const string error_line_separator = "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!";
 
-	output_text_line( error_line_separator );
+	output_text_line( error_line_separator, LOG_LEVEL_ERROR );
 
     temp_string = "Encountered a fatal error in the file";
-      output_text_line( temp_string );
+      output_text_line( temp_string, LOG_LEVEL_ERROR );
     
     temp_string = "    " + file_name;
       error_message << temp_string << "\n";
@@ -148,9 +152,9 @@ void TErrors::fatal_error_response( )
 		error_message << "\n" << temp_string << "\n\n";
 	}
 	
-	output_text( error_message.str() );
-	output_text_line( error_line_separator );
-	output_text_line( "" );
+	output_text( error_message.str(), LOG_LEVEL_ERROR );
+	output_text_line( error_line_separator, LOG_LEVEL_ERROR );
+	output_text_line( "", LOG_LEVEL_ERROR );
 
 	
 	exit( Program_Log.print_log_to_file( PATH_PROGRAM_LOG_FOLDER, uORF_APPL_VERSION_NUMBER, NOT_SUCCESSFUL ) );
@@ -160,13 +164,13 @@ void TErrors::fatal_error_response( )
 
 void TErrors::nonfatal_error_response( )
 {
-	output_text_line( "" );
-	output_text_line( "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!" );
+	output_text_line( "", LOG_LEVEL_ERROR );
+	output_text_line( "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!", LOG_LEVEL_ERROR );
 	
 	// Output the argument error message (emphasizing it to show that an error occurred)
-    output_text_line( whole_error_msg );
-	output_text_line( "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!" );
-	output_text_line( "" );
+    output_text_line( whole_error_msg, LOG_LEVEL_ERROR );
+	output_text_line( "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!", LOG_LEVEL_ERROR );
+	output_text_line( "", LOG_LEVEL_ERROR );
 		
 	whole_error_msg.clear();
 
@@ -179,9 +183,19 @@ void TErrors::nonfatal_error_response( )
 
 int TErrors::handle_error( unsigned int error_type, string error_message, string file_nm, int line_num )
 {
-	// Update the file name and line number with the passed information
-	file_name = file_nm;
-	line_number = line_num;
+	// Update the file name and line number with the passed information (those of the running task, if any)
+	TTask_Error_Scope * const task_scope = TTask_Error_Scope::get_current();
+	
+	if( task_scope != NULL )
+	{
+		task_scope->file_name   = file_nm;
+		task_scope->line_number = line_num;
+	}
+	else /*( task_scope == NULL )*/
+	{
+		file_name = file_nm;
+		line_number = line_num;
+	}
 
 	// Call the overloaded version of handle_error() and return 1 (in case the error is passed up one level)
 	return handle_error(error_type, error_message);
@@ -191,6 +205,9 @@ int TErrors::handle_error( unsigned int error_type, string error_message, string
 
 int TErrors::handle_error( unsigned int error_type, string error_message, int error_code )
 {
+	// Errors raised within a task run by a 'TError_Collector' are collected (see 'task_error_response()')
+	if( TTask_Error_Scope::get_current() != NULL ) { return task_error_response( error_type, error_message, error_code ); }
+	
 	// Update the error message string by adding the passed error message to the front
 	whole_error_msg = error_message + " " + whole_error_msg;
 	error_type_local = error_type;
@@ -218,6 +235,33 @@ int TErrors::handle_error( unsigned int error_type, string error_message, int er
 //------------------------------------------------------------------------------
 
 
+// Rather than responding to the error, hand it to the running task's collector, which reports it once the loop ends.  A
+//   fatal error abandons the task (unwinding it to 'TError_Collector::run_task()'), since the program can't exit while
+//   other tasks are still running
+int TErrors::task_error_response( unsigned int error_type, const string & error_message, int error_code )
+{
+	TTask_Error_Scope * const task_scope = TTask_Error_Scope::get_current();
+	
+	task_scope->whole_error_msg = error_message + " " + task_scope->whole_error_msg;
+	
+	if( error_type == PASS_UP_ONE_LEVEL ) { return error_code; }
+	
+	const TTask_Error task_error( task_scope->task_it, task_scope->whole_error_msg, task_scope->file_name, task_scope->line_number );
+	task_scope->whole_error_msg.clear();
+	
+	if( error_type == NONFATAL )
+	{
+		task_scope->collector->add_nonfatal_error( task_error );
+		return SUCCESSFUL;
+	}
+	
+	// 'FATAL' (or an invalid error type, which is also fatal)
+	task_scope->collector->add_failed_task( task_error );
+	throw TTask_Aborted();
+}
+//------------------------------------------------------------------------------
+
+
 void TErrors::update_error_msg_global( const string text_to_add )
 {
 	// If the argument specifies to clear the error message instead of setting or appending to it, do so
@@ -243,9 +287,125 @@ void TErrors::update_error_msg_global( const string text_to_add )
 
 
 
+TTask_Error_Scope * TTask_Error_Scope::get_current( void )
+{
+	return current_task_scope;
+}
+//------------------------------------------------------------------------------
+
+
+TTask_Error_Scope::TTask_Error_Scope( TError_Collector * const task_collector, const unsigned int task ) :
+	prev_scope ( current_task_scope ),
+	collector  ( task_collector 	),
+	task_it	   ( task 				),
+	line_number( 0 					)
+{
+	current_task_scope = this;
+}
+//------------------------------------------------------------------------------
+
+
+TTask_Error_Scope::~TTask_Error_Scope( void )
+{
+	current_task_scope = prev_scope;
+}
+//==============================================================================
+
+
+
+void TError_Collector::add_failed_task( const TTask_Error & task_error )
+{
+	lock_guard <mutex> collector_lock( collector_mutex );
+	
+	failed_tasks.push_back( task_error );
+	
+	if( task_error.task_it >= task_failed.size() ) { task_failed.resize( task_error.task_it + 1, FALSE ); }
+	task_failed[task_error.task_it] = TRUE;
+	
+	if( error_policy != TASK_ERROR_SKIP ) { stop_requested.store( true ); }
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TError_Collector::add_nonfatal_error( const TTask_Error & task_error )
+{
+	lock_guard <mutex> collector_lock( collector_mutex );
+	
+	nonfatal_errors.push_back( task_error );
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+bool TError_Collector::did_task_fail( const unsigned int task_it )
+{
+	lock_guard <mutex> collector_lock( collector_mutex );
+	
+	return ( task_it < task_failed.size() && task_failed[task_it] == TRUE );
+}
+//------------------------------------------------------------------------------
+
+
+unsigned int TError_Collector::get_num_failed_tasks( void )
+{
+	lock_guard <mutex> collector_lock( collector_mutex );
+	
+	return failed_tasks.size();
+}
+//------------------------------------------------------------------------------
+
+
+// Respond to the collected errors (from the thread that ran the loop, once its tasks have finished).  Errors are reported
+//   in task order, so the output doesn't depend on how the tasks were scheduled
+int TError_Collector::report( void )
+{
+	// Take the errors out under the lock, but report them after releasing it, since a fatal error doesn't return
+	vector <TTask_Error> reported_nonfatal_errors;
+	vector <TTask_Error> reported_failed_tasks;
+	{
+		lock_guard <mutex> collector_lock( collector_mutex );
+		
+		reported_nonfatal_errors.swap( nonfatal_errors );
+		reported_failed_tasks = failed_tasks;
+	}
+	
+	stable_sort( reported_nonfatal_errors.begin(), reported_nonfatal_errors.end(), compare_task_errors );
+	stable_sort( reported_failed_tasks.begin(),    reported_failed_tasks.end(),	   compare_task_errors );
+	
+	for( unsigned int i = 0; i < reported_nonfatal_errors.size(); i++ )
+	{
+		Errors.handle_error( NONFATAL, reported_nonfatal_errors[i].error_msg, reported_nonfatal_errors[i].file_name, reported_nonfatal_errors[i].line_number );
+	}
+	
+	if( reported_failed_tasks.empty() ) { return SUCCESSFUL; }
+	
+	
+	if( error_policy != TASK_ERROR_SKIP )
+	{
+		Errors.handle_error( FATAL, (string)"Error in " + loop_name + " (item " + get_str( reported_failed_tasks[0].task_it ) + "): " + reported_failed_tasks[0].error_msg, 
+							 reported_failed_tasks[0].file_name, reported_failed_tasks[0].line_number );
+	}
+	
+	for( unsigned int i = 0; i < reported_failed_tasks.size(); i++ )
+	{
+		Errors.handle_error( NONFATAL, (string)"Error in " + loop_name + " (item " + get_str( reported_failed_tasks[i].task_it ) + ", skipped): " + reported_failed_tasks[i].error_msg, 
+							 reported_failed_tasks[i].file_name, reported_failed_tasks[i].line_number );
+	}
+	
+	output_text_line( "Skipped " + get_str( (unsigned int)reported_failed_tasks.size() ) + " item(s) in " + loop_name + " due to errors" );
+	
+	return NOT_SUCCESSFUL;
+}
+//==============================================================================
+
+
+
 void TProgram_Log::add_to_log( const string & text_to_add )
 {
-	log += text_to_add;
+	Log_Backend.write( text_to_add, LOG_TO_FILE_ONLY );
 	
 	return;
 }
@@ -276,7 +436,7 @@ int TProgram_Log::print_log_to_file( const string & path_program_log_file, const
 		
 	} while( add_comment_to_file_name == "C" );
 	
-	log += USER_COMMENT_PROMPT + ( user_comment == "" ? "NA" : user_comment ) + "\n"; 
+	add_to_log( USER_COMMENT_PROMPT + ( user_comment == "" ? "NA" : user_comment ) + "\n" );
 
 	
 	string file_name = format_system_date_time_filesystem_safe( time( NULL ) ) + 
@@ -289,12 +449,12 @@ int TProgram_Log::print_log_to_file( const string & path_program_log_file, const
 	const string PATH_PROGRAM_LOG_RESULT_FOLDER  = PATH_PROGRAM_LOG_VERSION_FOLDER + PATH_FOLDER_SEPARATOR + ( program_result == SUCCESSFUL ? "no_error" : "error" );
 
 	
-	if( write_file_contents( PATH_PROGRAM_LOG_ALL_FOLDER, file_name, log, TRUE ) )
+	if( Log_Backend.copy_log_to_file( PATH_PROGRAM_LOG_ALL_FOLDER, file_name ) )
 	{
 		Errors.handle_error( NONFATAL, (string)"Error in 'TProgram_Log::print_program_log_to_file()': " );
 	}
 	
-	if( write_file_contents( PATH_PROGRAM_LOG_RESULT_FOLDER, file_name, log, TRUE ) )
+	if( Log_Backend.copy_log_to_file( PATH_PROGRAM_LOG_RESULT_FOLDER, file_name ) )
 	{
 		Errors.handle_error( NONFATAL, (string)"Error in 'TProgram_Log::print_program_log_to_file()': " );
 	}
@@ -443,6 +603,38 @@ void TCount_Term_Vect::sort_terms( const bool by_count_or_alphabet, const bool i
 //------------------------------------------------------------------------------
 
 //==============================================================================
+
+
+
+// Returns the position of 'c' relative to the start of the field, or 'string::npos' if the field doesn't contain it
+size_t TField_View::find( const string & source, const char c ) const
+{
+	const void * const c_ptr = memchr( source.data() + start_pos, c, length );
+	
+	return ( c_ptr == NULL ) ? string::npos : ( (const char *)c_ptr - source.data() - start_pos );
+}
+//------------------------------------------------------------------------------
+
+
+// Reads the field (starting 'offset' characters in) as 'atoi()' would, without reading past the end of the field
+int TField_View::to_int( const string & source, const size_t offset ) const
+{
+	const char * curr_char = source.data() + start_pos + min( offset, length );
+	const char * const field_end = source.data() + start_pos + length;
+	
+	while( curr_char < field_end && isspace( (unsigned char)*curr_char ) ) { curr_char++; }
+	
+	bool negative = FALSE;
+	if( curr_char < field_end && ( *curr_char == '-' || *curr_char == '+' ) ) { negative = ( *curr_char == '-' ); curr_char++; }
+	
+	int value = 0;
+	for( ; curr_char < field_end && isdigit( (unsigned char)*curr_char ); curr_char++ ) { value = value * 10 + ( *curr_char - '0' ); }
+	
+	return negative ? -value : value;
+}
+//------------------------------------------------------------------------------
+
+//==============================================================================
 		
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -741,9 +933,9 @@ bool is_char_white_space( const string searched_str, const size_t pos )
 void cap_or_uncap_str( string * const str_to_modify, const bool cap_or_uncap, const unsigned int start_pos, const unsigned int length )
 {
 	unsigned int char_type;
-	unsigned int end_pos = start_pos + length - 1;
+	size_t end_pos = start_pos + length - 1;
 	
-	if( length == string::npos ) { end_pos = str_to_modify->size() - 1; }
+	if( length == (unsigned int)string::npos ) { end_pos = str_to_modify->size() - 1; }
 
 	if( start_pos >= str_to_modify->size() )
 	{
@@ -943,89 +1135,274 @@ double mean  ( const std::vector <double> & set )
 
 
 
+// Finds the text between 'before_delimiter' and 'after_delimiter', wherever they occur in 'str'.  A field is at least one
+//   character long, and is skipped if it spans a newline (unless 'exclude_newlines' is FALSE) or if its line doesn't
+//   contain 'line_indicator'; if 'after_delimiter' never appears again, the rest of 'str' is the last field
 vector <string> extract_fields( const string & str, const string & before_delimiter, const string & after_delimiter, const string & line_indicator, const bool add_repeats, const bool exclude_newlines )
 {
-	vector <string> field_contents( 0 );
-	unsigned int field_start_pos = -1;
-	unsigned int field_end_pos   = -1;
+	vector <TField_Spec> field_specs( 1, TField_Spec( before_delimiter, after_delimiter, line_indicator, add_repeats, exclude_newlines ) );
 	
-	bool str_end_reached = FALSE;		
+	return extract_fields( str, field_specs ).front();
+}
+//==============================================================================
 
-	do
-	{	
-		if( str.find( before_delimiter, field_end_pos + 1 ) == string::npos )
+
+
+vector <vector <string> > extract_fields( const string & str, const vector <TField_Spec> & field_specs )
+{
+	vector <vector <TField_View> > field_views;
+	extract_field_views( str, field_specs, &field_views );
+	
+	vector <vector <string> > field_contents( field_specs.size() );
+	
+	for( unsigned int i = 0; i < field_views.size(); i++ )
+	{
+		field_contents[i].reserve( field_views[i].size() );
+		
+		for( unsigned int j = 0; j < field_views[i].size(); j++ ) { field_contents[i].push_back( field_views[i][j].get_str( str ) ); }
+	}
+	
+	
+	return field_contents;
+}
+//==============================================================================
+
+
+
+// Hashes and compares fields by their text (rather than their positions), to find repeats
+class TField_Text_Hash
+{
+	private:
+		const string * source;
+	
+	public:
+		size_t operator()( const TField_View & field ) const
 		{
-			str_end_reached = TRUE;
+			size_t hash_value = 14695981039346656037ULL;	// FNV-1a
+			
+			for( size_t i = field.start_pos; i < field.start_pos + field.length; i++ ) { hash_value = ( hash_value ^ (unsigned char)(*source)[i] ) * 1099511628211ULL; }
+			
+			return hash_value;
 		}
-		else
+		
+		TField_Text_Hash( const string * const source_str ) : source( source_str ) { }
+};
+//------------------------------------------------------------------------------
+
+
+class TField_Text_Equal
+{
+	private:
+		const string * source;
+	
+	public:
+		bool operator()( const TField_View & lhs, const TField_View & rhs ) const
+		{
+			return lhs.length == rhs.length && memcmp( source->data() + lhs.start_pos, source->data() + rhs.start_pos, lhs.length ) == 0;
+		}
+		
+		TField_Text_Equal( const string * const source_str ) : source( source_str ) { }
+};
+//------------------------------------------------------------------------------
+
+
+typedef unordered_set <TField_View, TField_Text_Hash, TField_Text_Equal> TField_View_Set;
+//==============================================================================
+
+
+
+// Extracts every kind of field in 'field_specs' (each as described for 'extract_fields()') in a single pass through
+//   'str':  specs sharing a 'before_delimiter' share the search for it, the matches of all delimiters are visited in
+//   order of position, and newline and 'after_delimiter' searches are remembered, so no part of 'str' is searched for
+//   the same thing twice.  The fields are returned as views into 'str' (in 'field_views[i]' for 'field_specs[i]')
+void extract_field_views( const string & str, const vector <TField_Spec> & field_specs, vector <vector <TField_View> > * const field_views )
+{
+	field_views->assign( field_specs.size(), vector <TField_View>() );
+	
+	
+	// ------------------------------
+	// Group the specs by 'before_delimiter'
+	vector <unsigned int> group_first_spec( 0 );				// The spec whose 'before_delimiter' the group searches for
+	vector <vector <unsigned int> > group_specs( 0 );
+	
+	for( unsigned int i = 0; i < field_specs.size(); i++ )
+	{
+		unsigned int group_it = 0;
+		while( group_it < group_first_spec.size() && field_specs[ group_first_spec[group_it] ].before_delimiter != field_specs[i].before_delimiter ) { group_it++; }
+		
+		if( group_it == group_first_spec.size() )
+		{
+			group_first_spec.push_back( i );
+			group_specs.push_back( vector <unsigned int>( 0 ) );
+		}
+		
+		group_specs[group_it].push_back( i );
+	}
+	// ------------------------------
+	
+	
+	
+	// ------------------------------
+	// Per-spec (and per-group) scanning state
+	vector <size_t> search_start_pos ( field_specs.size(), 0 		    );		// Where the spec's next 'before_delimiter' search starts
+	vector <size_t> next_after_pos	 ( field_specs.size(), 0 		    );		// First 'after_delimiter' at or after 'after_searched_from'
+	vector <size_t> after_searched_from( field_specs.size(), string::npos );
+	vector <bool>   spec_done		 ( field_specs.size(), FALSE 	    );
+	
+	vector <TField_View_Set *> added_fields( field_specs.size(), NULL );
+	for( unsigned int i = 0; i < field_specs.size(); i++ )
+	{
+		if( field_specs[i].add_repeats == FALSE ) { added_fields[i] = new TField_View_Set( 64, TField_Text_Hash( &str ), TField_Text_Equal( &str ) ); }
+	}
+	
+	vector <size_t> group_match_pos( group_first_spec.size(), 0 );				// 'string::npos' once the group is finished
+	for( unsigned int i = 0; i < group_first_spec.size(); i++ ) { group_match_pos[i] = str.find( field_specs[ group_first_spec[i] ].before_delimiter ); }
+	
+	size_t next_newline_pos = string::npos;		// First newline at or after 'newline_searched_from'
+	size_t newline_searched_from = string::npos;
+	// ------------------------------
+	
+	
+	
+	// ------------------------------
+	// Visit the delimiter matches in order of position
+	while( TRUE )
+	{
+		unsigned int group_it = group_first_spec.size();
+		for( unsigned int i = 0; i < group_match_pos.size(); i++ )
+		{
+			if( group_match_pos[i] != string::npos && ( group_it == group_first_spec.size() || group_match_pos[i] < group_match_pos[group_it] ) ) { group_it = i; }
+		}
+		
+		if( group_it == group_first_spec.size() ) { break; }
+		
+		const size_t match_pos 		 = group_match_pos[group_it];
+		const size_t field_start_pos = match_pos + field_specs[ group_first_spec[group_it] ].before_delimiter.size();
+		
+		bool group_active = FALSE;
+		
+		for( unsigned int j = 0; j < group_specs[group_it].size(); j++ )
 		{
-			field_start_pos = str.find( before_delimiter, field_end_pos + 1 ) + before_delimiter.size();
+			const unsigned int spec_it = group_specs[group_it][j];
+			const TField_Spec & spec = field_specs[spec_it];
 			
-			if( field_start_pos >= str.size() )
+			if( spec_done[spec_it] == TRUE ) 	  		  { continue; }
+			if( match_pos < search_start_pos[spec_it] ) { group_active = TRUE; continue; }
+			
+			if( field_start_pos >= str.size() ) { spec_done[spec_it] = TRUE; continue; }
+			
+			
+			// The first 'after_delimiter' following the field's first character (searched for again only if it has been passed)
+			if( after_searched_from[spec_it] == string::npos || 
+				( next_after_pos[spec_it] != string::npos && next_after_pos[spec_it] < field_start_pos + 1 ) )
 			{
-				str_end_reached = TRUE;
+				next_after_pos	   [spec_it] = str.find( spec.after_delimiter, field_start_pos + 1 );
+				after_searched_from[spec_it] = field_start_pos + 1;
 			}
-			else
+			
+			const size_t after_pos = next_after_pos[spec_it];
+			
+			
+			// The first newline within the field (or after it)
+			if( newline_searched_from == string::npos || newline_searched_from > field_start_pos + 1 || 
+				( next_newline_pos != string::npos && next_newline_pos < field_start_pos + 1 ) )
 			{
-				field_end_pos = str.find( after_delimiter, field_start_pos + 1 ) - 1;
-				
-				bool line_indicator_present = TRUE;
+				const void * const newline_ptr = memchr( str.data() + field_start_pos + 1, '\n', str.size() - ( field_start_pos + 1 ) );
 				
-				if( line_indicator != "" )
-				{
-					unsigned int prev_new_line = str.rfind( '\n', field_start_pos );
-					if( prev_new_line == string::npos ) { prev_new_line = 0; }
-					
-					if( str.substr( prev_new_line, ( str.find( '\n', prev_new_line + 1 ) - prev_new_line ) ).find( line_indicator ) == string::npos )
-					{
-						line_indicator_present = FALSE;
-					}
-				}
+				next_newline_pos = ( newline_ptr == NULL ) ? string::npos : ( (const char *)newline_ptr - str.data() );
+				newline_searched_from = field_start_pos + 1;
+			}
+			
+			
+			bool line_indicator_present = TRUE;
+			
+			if( spec.line_indicator != "" )
+			{
+				size_t prev_newline_pos = str.rfind( '\n', field_start_pos );
+				if( prev_newline_pos == string::npos ) { prev_newline_pos = 0; }
 				
+				const void * const line_end_ptr = memchr( str.data() + prev_newline_pos + 1, '\n', str.size() - ( prev_newline_pos + 1 ) );
+				const char * const line_end = ( line_end_ptr == NULL ) ? str.data() + str.size() : (const char *)line_end_ptr;
 				
-				// If no end of field character is found after the start field character, all fields have been extracted
-				if( field_end_pos == string::npos ) 
-				{ 
-					str_end_reached = TRUE; 			 
-				}
-				else if( exclude_newlines == TRUE && field_end_pos >= str.find( '\n', field_start_pos + 1 ) )
-				{ 
-					field_end_pos = field_start_pos; 
-				}
-				else if( line_indicator_present == FALSE )
+				if( std::search( str.data() + prev_newline_pos, line_end, spec.line_indicator.begin(), spec.line_indicator.end() ) == line_end )
 				{
-					field_end_pos = field_start_pos; 
+					line_indicator_present = FALSE;
 				}
-				else
+			}
+			
+			
+			TField_View field( field_start_pos, 0 );
+			
+			if( after_pos == string::npos )
+			{
+				// If no end of field is found, the rest of the string is the last field (unless it spans a newline)
+				if( ( spec.exclude_newlines == TRUE && next_newline_pos != string::npos ) || line_indicator_present == FALSE )
 				{
-					string indiv_field_content = str.substr( field_start_pos, field_end_pos - field_start_pos + 1 );
-					
-					if( add_repeats == FALSE )
-					{
-						bool field_already_added = FALSE;
-						
-						for( unsigned int j = 0; j < field_contents.size(); j++ )
-						{
-							if( indiv_field_content == field_contents[j] ) { field_already_added = TRUE; }
-						}
-						
-						if( field_already_added == FALSE )
-						{
-							field_contents.push_back( indiv_field_content );
-						}
-					}
-					else/*( add_repeats == TRUE )*/
-					{
-						field_contents.push_back( indiv_field_content );
-					}
+					search_start_pos[spec_it] = field_start_pos + 1;
+					group_active = TRUE;
+					continue;
 				}
+				
+				field.length = str.size() - field_start_pos;
+				spec_done[spec_it] = TRUE;
+			}
+			else if( ( spec.exclude_newlines == TRUE && next_newline_pos < after_pos ) || line_indicator_present == FALSE )
+			{
+				search_start_pos[spec_it] = field_start_pos + 1;
+				group_active = TRUE;
+				continue;
+			}
+			else
+			{
+				field.length = after_pos - field_start_pos;
+				search_start_pos[spec_it] = after_pos;
+				group_active = TRUE;
+			}
+			
+			
+			if( added_fields[spec_it] == NULL || added_fields[spec_it]->insert( field ).second == TRUE )
+			{
+				(*field_views)[spec_it].push_back( field );
 			}
 		}
+		
+		
+		group_match_pos[group_it] = ( group_active == TRUE ) ? str.find( field_specs[ group_first_spec[group_it] ].before_delimiter, match_pos + 1 ) : string::npos;
+	}
+	// ------------------------------
+	
+	
+	for( unsigned int i = 0; i < added_fields.size(); i++ ) { delete added_fields[i]; }
+	
+	return;
+}
+//==============================================================================
+
 
-	} while( str_end_reached == FALSE );
+
+// Splits 'str' at every 'delimiter' (e.g. the cells of a row of a CSV without quoted fields), as views into 'str'.
+//   'field_views' is reused, so splitting many lines allocates nothing once it has grown to the longest
+void split_field_views( const string & str, const char delimiter, vector <TField_View> * const field_views )
+{
+	field_views->clear();
 	
+	size_t field_start_pos = 0;
 	
-	return field_contents;	
+	while( TRUE )
+	{
+		const size_t delimiter_pos = str.find( delimiter, field_start_pos );
+		
+		if( delimiter_pos == string::npos )
+		{
+			field_views->push_back( TField_View( field_start_pos, str.size() - field_start_pos ) );
+			break;
+		}
+		
+		field_views->push_back( TField_View( field_start_pos, delimiter_pos - field_start_pos ) );
+		field_start_pos = delimiter_pos + 1;
+	}
+	
+	return;
 }
 //==============================================================================
 
@@ -1035,7 +1412,7 @@ unsigned int count_instances_of( const string & str, const string & txt_to_searc
 {
 	int count = 0;
 	
-	unsigned int txt_start_pos = -1;
+	size_t txt_start_pos = -1;
 	
 	while( str.find( txt_to_search, txt_start_pos + 1 ) != string::npos )
 	{	
@@ -1176,6 +1553,14 @@ bool compare_terms_count( const TCount_Term & term_1, const TCount_Term & term_2
 
 
 
+bool compare_task_errors( const TTask_Error & error_1, const TTask_Error & error_2 )
+{
+	return error_1.task_it < error_2.task_it;
+}
+//==============================================================================
+
+
+
 bool compare_strings( const string & str_1, const string & str_2 )
 {
 	if	   ( str_1.compare( str_2 ) > 0 ) { return TERM_1_BEFORE_TERM_2; }
@@ -1235,6 +1620,7 @@ string get_str( const type & field )
 
 template string get_str<int>		 ( const int & );
 template string get_str<unsigned int>( const unsigned int & );
+template string get_str<long long>	 ( const long long & );
 template string get_str<double>		 ( const double & );
 template string get_str<string>		 ( const string & );
 //==============================================================================
@@ -1245,6 +1631,9 @@ template < class type >
 type get_input_line( void )
 {
 	string temp_str;
+	
+	// Make sure any pending output (e.g. the prompt) has actually been shown before waiting on the user
+	Log_Backend.flush();
 	getline( cin, temp_str );
 	
 	return get_type<type>( temp_str );
@@ -1259,7 +1648,7 @@ template string 	  get_input_line<string>	  ( void );
 
 
 template < class type >
-type prompt_for_input( const string & prompt, const bool print_prompt_to_log = PRINT_PROMPT_TO_LOG )
+type prompt_for_input( const string & prompt, const bool print_prompt_to_log )
 {
 	type input;
 	
@@ -1342,8 +1731,8 @@ vector <type> parse_delimited_list( const string & str_list, const string & deli
 
 	if( str_list.size() != 0 )
 	{
-		unsigned int field_start_pos = 0;
-		unsigned int delim_pos = 0;
+		size_t field_start_pos = 0;
+		size_t delim_pos = 0;
 		
 		if( str_list.find( delimiter ) == 0 )
 		{
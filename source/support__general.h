@@ -53,12 +53,16 @@
 #include <sstream>
 #include <string>
 #include <vector>
+#include <mutex>
+#include <atomic>
 
 // Project-specific header files:  definitions and related information
 #include "defs__general.h"
+#include "defs__appl_parameters.h"
 
 // Project-specific header files:  support functions and related
 #include "support__file_io.h"
+#include "support__logging.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -82,6 +86,7 @@ class TErrors
 	// User calls handle_error(), which subsequently calls one of these three private functions
 		void fatal_error_response();
 		void nonfatal_error_response();
+		int  task_error_response( unsigned int error_type, const std::string & error_message, int error_code );
 
 	public:
 		unsigned int num_nonfatal_errors;
@@ -108,11 +113,175 @@ class TErrors
 
 
 
-class TProgram_Log
+// An error raised by one of the tasks run by a 'TError_Collector'
+class TTask_Error
+{
+	public:
+		unsigned int task_it;
+		std::string error_msg;
+		std::string file_name;
+		int line_number;
+		
+		TTask_Error( const unsigned int task, const std::string & message, const std::string & file_nm, const int line_num ) :
+			task_it	   ( task 	  ),
+			error_msg  ( message  ),
+			file_name  ( file_nm  ),
+			line_number( line_num )
+		{ }
+};
+//===============================================================================
+
+
+
+// Thrown by 'Errors.handle_error( FATAL, ... )' within a task, unwinding the task (in place of ending the program);
+//   caught by 'TError_Collector::run_task()'
+class TTask_Aborted { };
+//===============================================================================
+
+
+
+class TError_Collector;
+
+// While a task runs (on this thread), its errors are sent to its collector, and the messages passed up to the task
+//   are assembled here (rather than in the shared 'Errors')
+class TTask_Error_Scope
+{
+	private:
+		TTask_Error_Scope * prev_scope;
+		
+		// Not copyable (installed for the current thread)
+		TTask_Error_Scope( const TTask_Error_Scope & );
+		TTask_Error_Scope & operator=( const TTask_Error_Scope & );
+		
+	public:
+		TError_Collector * const collector;
+		const unsigned int task_it;
+		std::string whole_error_msg;
+		std::string file_name;
+		int line_number;
+		
+		static TTask_Error_Scope * get_current( void );
+		
+		TTask_Error_Scope( TError_Collector * const task_collector, const unsigned int task );
+		~TTask_Error_Scope( void );
+};
+//===============================================================================
+
+
+
+// Runs the tasks of one loop (genes, rows, datasets, ...; possibly in parallel), collecting their errors rather than
+//   responding to each as it occurs.  A task that raises a fatal error is abandoned, and either the loop is stopped
+//   ('TASK_ERROR_ABORT') or the task is skipped ('TASK_ERROR_SKIP'); 'report()' then responds to the collected errors
+//   from the calling thread.  Nothing is done unless an error occurs
+class TError_Collector
 {
 	private:
-		std::string log;
+		std::mutex collector_mutex;
+		std::vector <TTask_Error> failed_tasks;
+		std::vector <TTask_Error> nonfatal_errors;
+		std::vector <bool> task_failed;
+		std::atomic <bool> stop_requested;
+		const std::string loop_name;
+		const unsigned int error_policy;
+		
+		// Not copyable (holds a mutex)
+		TError_Collector( const TError_Collector & );
+		TError_Collector & operator=( const TError_Collector & );
 		
+	public:
+		template <typename TTask>
+		bool run_task( const unsigned int task_it, const TTask & task );
+		
+		void add_failed_task   ( const TTask_Error & task_error );
+		void add_nonfatal_error( const TTask_Error & task_error );
+		
+		bool did_task_fail( const unsigned int task_it );
+		bool is_stop_requested( void ) const { return stop_requested.load(); }
+		unsigned int get_num_failed_tasks( void );
+		
+		int report( void );
+		
+		TError_Collector( const std::string & name, const unsigned int policy ) :
+			stop_requested( false ),
+			loop_name	  ( name   ),
+			error_policy  ( policy )
+		{ }
+};
+//-------------------------------------------------------------------------------
+
+
+// Returns FALSE if the loop should stop (the task failed, or an earlier one did, with 'TASK_ERROR_ABORT')
+template <typename TTask>
+bool TError_Collector::run_task( const unsigned int task_it, const TTask & task )
+{
+	if( stop_requested.load( std::memory_order_relaxed ) == true ) { return FALSE; }
+	
+	TTask_Error_Scope task_scope( this, task_it );
+	
+	try
+	{
+		task();
+	}
+	catch( const TTask_Aborted & )
+	{
+		return ( error_policy == TASK_ERROR_SKIP ) ? TRUE : FALSE;
+	}
+	
+	return TRUE;
+}
+//===============================================================================
+
+
+
+// A field found by 'extract_field_views()':  a position and length within the searched string (which must outlive it)
+class TField_View
+{
+	public:
+		size_t start_pos;
+		size_t length;
+		
+		std::string get_str( const std::string & source ) const { return source.substr( start_pos, length ); }
+		size_t find		   ( const std::string & source, const char c ) const;
+		int    to_int	   ( const std::string & source, const size_t offset = 0 ) const;
+		
+		TField_View( const size_t field_start_pos, const size_t field_length ) :
+			start_pos( field_start_pos ),
+			length	 ( field_length    )
+		{ }
+};
+//===============================================================================
+
+
+
+// One kind of field to extract (see 'extract_fields()' for the meaning of each member)
+class TField_Spec
+{
+	public:
+		std::string before_delimiter;
+		std::string after_delimiter;
+		std::string line_indicator;
+		bool add_repeats;
+		bool exclude_newlines;
+		
+		TField_Spec( const std::string & before_delim, 
+					 const std::string & after_delim, 
+					 const std::string & line_ind = "", 
+					 const bool repeats = TRUE, 
+					 const bool excl_newlines = TRUE ) :
+			before_delimiter( before_delim  ),
+			after_delimiter ( after_delim   ),
+			line_indicator	( line_ind 		),
+			add_repeats		( repeats 		),
+			exclude_newlines( excl_newlines )
+		{ }
+};
+//===============================================================================
+
+
+
+// The log itself is spooled to a temporary file by 'Log_Backend' rather than held in memory (see "support__logging.h")
+class TProgram_Log
+{
 	public:
 		void add_to_log( const std::string & text_to_add );
 		int print_log_to_file( const std::string & path_log, const std::string & version, bool program_result );
@@ -201,7 +370,7 @@ void remove_white_space( std::string * const str_to_modify, const size_t start_p
 std::string replace_spaces_w_underscores( std::string * const str_to_modify );
 std::string format_string_replace_all( const std::string & string_to_be_formatted, const std::string & string_to_replace, const std::string & replacement_string = "" );
 bool is_char_white_space( const std::string searched_str, const size_t pos );
-void cap_or_uncap_str( std::string * const str_to_modify, const bool cap_or_uncap, const unsigned int start_pos = 0, const unsigned int length = std::string::npos );
+void cap_or_uncap_str( std::string * const str_to_modify, const bool cap_or_uncap, const unsigned int start_pos = 0, const unsigned int length = (unsigned int)std::string::npos );
 size_t find_first_digit_or_char( int digit_or_char, std::string searched_str, size_t start_pos = 0 ); 
 size_t find_last_digit_or_char( int digit_or_char, std::string searched_str, size_t start_pos = 0 ); 
 unsigned int is_char_num_lower_upper( unsigned char c );
@@ -216,6 +385,10 @@ std::vector <std::string> extract_fields( const std::string & str,
 										  const std::string & line_indicator = "", 
 										  const bool add_repeats = TRUE, 
 										  const bool exclude_newlines = TRUE );
+
+void extract_field_views( const std::string & str, const std::vector <TField_Spec> & field_specs, std::vector <std::vector <TField_View> > * const field_views );
+void split_field_views( const std::string & str, const char delimiter, std::vector <TField_View> * const field_views );
+std::vector <std::vector <std::string> > extract_fields( const std::string & str, const std::vector <TField_Spec> & field_specs );
 										  
 unsigned int count_instances_of( const std::string & str, const std::string & txt_to_search );
 std::string format_with_rounding( double number_to_format, unsigned int num_places );
@@ -226,6 +399,7 @@ std::string convert_uint_to_roman_numeral( const unsigned int uint );
 bool compare_terms_alphabet( const TCount_Term & term_1, const TCount_Term & term_2 );
 bool compare_terms_count   ( const TCount_Term & term_1, const TCount_Term & term_2 );
 bool compare_strings	   ( const std::string & str_1,  const std::string & str_2  );
+bool compare_task_errors   ( const TTask_Error & error_1, const TTask_Error & error_2 );
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -278,8 +452,9 @@ inline
 void output_text_line_debug_only( const std::string & arg_line )
 {
 	// Output the argument text to the console for debugging
-	cout << arg_line << endl;
-	cout.flush();
+	if( LOG_LEVEL_DEBUG < MIN_LOG_LEVEL || LOG_LEVEL_DEBUG < Log_Backend.get_min_log_level() ) { return; }
+	
+	Log_Backend.write( arg_line, LOG_TO_CONSOLE_ONLY, TRUE );
 }
 
 
@@ -288,33 +463,43 @@ void output_text_line_debug_only( const std::string & arg_line )
 inline
 void output_text_debug_only( const std::string & arg_text )
 {
-	// Output the argument text to the console for debugging without including a newline (but still flushing to actually show output)
-	cout << arg_text;
-	cout.flush();
+	// Output the argument text to the console for debugging without including a newline
+	if( LOG_LEVEL_DEBUG < MIN_LOG_LEVEL || LOG_LEVEL_DEBUG < Log_Backend.get_min_log_level() ) { return; }
+	
+	Log_Backend.write( arg_text, LOG_TO_CONSOLE_ONLY );
 }
 //==============================================================================
 
 
 
 inline
-void output_text_line( const std::string & arg_line )
+void output_text_line( const std::string & arg_line, const unsigned int log_level = LOG_LEVEL_INFO )
 {
-    // Output the argument text to the console for debugging
-    output_text_line_debug_only( arg_line );
+    // Output the argument text to the console and the program log.  Neither is flushed here; 'Log_Backend'
+	//   writes the text from its own thread
+	// (Nothing is below 'MIN_LOG_LEVEL' when it's the lowest level, so only compare against it when it's been raised)
+#if( MIN_LOG_LEVEL > LOG_LEVEL_DEBUG )
+	if( log_level < MIN_LOG_LEVEL ) { return; }
+#endif
+	if( log_level < Log_Backend.get_min_log_level() ) { return; }
 	
-	Program_Log.add_to_log( arg_line + (string)"\n" );
+	Log_Backend.write( arg_line, LOG_TO_CONSOLE_AND_FILE, TRUE );
 }
 //==============================================================================
 
 
 
 inline
-void output_text( const std::string & arg_line )
+void output_text( const std::string & arg_line, const unsigned int log_level = LOG_LEVEL_INFO )
 {
-    // Output the argument text to the console for debugging
-    output_text_debug_only( arg_line );
+    // Output the argument text to the console and the program log without including a newline
+	// (Nothing is below 'MIN_LOG_LEVEL' when it's the lowest level, so only compare against it when it's been raised)
+#if( MIN_LOG_LEVEL > LOG_LEVEL_DEBUG )
+	if( log_level < MIN_LOG_LEVEL ) { return; }
+#endif
+	if( log_level < Log_Backend.get_min_log_level() ) { return; }
 	
-	Program_Log.add_to_log( arg_line );
+	Log_Backend.write( arg_line, LOG_TO_CONSOLE_AND_FILE );
 }
 //==============================================================================
 
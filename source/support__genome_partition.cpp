@@ -0,0 +1,329 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__genome_partition.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to partition each strand of the genome into
+//				 coding, 5' TL, intronic, and intergenic segments
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//     *D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+
+// Header file for this file
+#include "support__genome_partition.h"
+
+
+
+#define NUM_GFF_COLUMNS				9			// seqid, source, type, start, end, score, strand, phase, attributes
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Collect the coding, intronic, and 5' TL features annotated in the GFF.  Lines are split into their columns in place;
+//   introns not annotated as such are taken to be the gaps between consecutive CDS's of the same transcript
+void TGenome_Partition::get_gff_features( vector <TGenome_Feature> * const features ) const
+{
+	const vector <string> & gff_annotations = genome->get_gff_annotations();
+
+	const unsigned int num_chrom = min( gff_annotations.size(), genome->sequence.size() );
+
+	for( unsigned int chrom_it = 0; chrom_it < num_chrom; chrom_it++ )
+	{
+		const string & annotations = gff_annotations[chrom_it];
+
+		vector <pair <string, TGenome_Feature> > CDS_by_parent;
+
+		size_t line_start_pos = 0;
+
+		while( line_start_pos < annotations.size() )
+		{
+			size_t line_end_pos = annotations.find( '\n', line_start_pos );
+			if( line_end_pos == string::npos ) { line_end_pos = annotations.size(); }
+
+
+			// ------------------------------
+			// Split the line into its columns (skipping blank lines, comments, and anything else not a feature)
+			vector <TField_View> columns;
+			size_t col_start_pos = line_start_pos;
+
+			while( columns.size() < NUM_GFF_COLUMNS && col_start_pos <= line_end_pos )
+			{
+				size_t col_end_pos = annotations.find( '\t', col_start_pos );
+				if( col_end_pos == string::npos || col_end_pos > line_end_pos || columns.size() == NUM_GFF_COLUMNS - 1 ) { col_end_pos = line_end_pos; }
+
+				columns.push_back( TField_View( col_start_pos, col_end_pos - col_start_pos ) );
+				col_start_pos = col_end_pos + 1;
+			}
+
+			line_start_pos = line_end_pos + 1;
+
+			if( columns.size() != NUM_GFF_COLUMNS || annotations[ columns[0].start_pos ] == '#' ) { continue; }
+			// ------------------------------
+
+
+
+			// ------------------------------
+			// Classify the feature
+			const string feature_type = columns[2].get_str( annotations );
+
+			Tenum_genome_segment_types type;
+
+			if	   ( feature_type == "CDS" ) 											 { type = SEGMENT_CODING; 	  }
+			else if( feature_type == "intron" || feature_type == "five_prime_UTR_intron" ) { type = SEGMENT_INTRONIC;   }
+			else if( feature_type == "five_prime_UTR" ) 								 { type = SEGMENT_5_PRIME_TL; }
+			else 																		 { continue; 				  }
+
+
+			const int first_coord = columns[3].to_int( annotations );
+			const int last_coord  = columns[4].to_int( annotations );
+			const char strand_id  = annotations[ columns[6].start_pos ];
+
+			if( first_coord < 1 || last_coord < first_coord || (size_t)last_coord > genome->sequence[chrom_it].size() || ( strand_id != '+' && strand_id != '-' ) )
+			{
+				continue;
+			}
+
+			features->push_back( TGenome_Feature( chrom_it, ( strand_id == '-' ), first_coord, last_coord, type ) );
+			// ------------------------------
+
+
+
+			// ------------------------------
+			// Remember which transcript each CDS belongs to, to find the introns between them
+			if( type == SEGMENT_CODING )
+			{
+				const size_t parent_pos = annotations.find( "Parent=", columns[8].start_pos );
+
+				if( parent_pos != string::npos && parent_pos < line_end_pos )
+				{
+					const size_t parent_start_pos = parent_pos + ((string)"Parent=").size();
+					size_t parent_end_pos = annotations.find( ';', parent_start_pos );
+					if( parent_end_pos == string::npos || parent_end_pos > line_end_pos ) { parent_end_pos = line_end_pos; }
+
+					CDS_by_parent.push_back( make_pair( annotations.substr( parent_start_pos, parent_end_pos - parent_start_pos ), features->back() ) );
+				}
+			}
+			// ------------------------------
+		}
+
+
+
+		// ------------------------------
+		// Add the gap between each pair of consecutive CDS's of a transcript as an intron
+		sort( CDS_by_parent.begin(), CDS_by_parent.end(),
+			  []( const pair <string, TGenome_Feature> & CDS_1, const pair <string, TGenome_Feature> & CDS_2 )
+			  {
+				  return ( CDS_1.first != CDS_2.first ) ? ( CDS_1.first < CDS_2.first ) : ( CDS_1.second.first_coord < CDS_2.second.first_coord );
+			  } );
+
+		for( unsigned int i = 1; i < CDS_by_parent.size(); i++ )
+		{
+			const TGenome_Feature & prev_CDS = CDS_by_parent[i - 1].second;
+			const TGenome_Feature & curr_CDS = CDS_by_parent[i].second;
+
+			if( CDS_by_parent[i - 1].first == CDS_by_parent[i].first && prev_CDS.last_coord + 1 < curr_CDS.first_coord )
+			{
+				features->push_back( TGenome_Feature( chrom_it, curr_CDS.opposite_strand, prev_CDS.last_coord + 1, curr_CDS.first_coord - 1, SEGMENT_INTRONIC ) );
+			}
+		}
+		// ------------------------------
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Classify each nucleotide of each strand by the highest-precedence feature covering it (intergenic if none), then
+//   store each run of nucleotides of one type as a segment
+void TGenome_Partition::build( const TFasta_Content & genome_seq, const vector <TGenome_Feature> & added_features )
+{
+	genome   = &genome_seq;
+	segments = vector <vector <TGenome_Segment> >( NUM_GENOME_SEGMENT_TYPES );
+	num_nt	 = vector <size_t>( NUM_GENOME_SEGMENT_TYPES, 0 );
+
+	vector <TGenome_Feature> features;
+	get_gff_features( &features );
+
+	for( unsigned int i = 0; i < added_features.size(); i++ )
+	{
+		if( added_features[i].chrom_it >= genome->sequence.size() || added_features[i].first_coord < 1 ||
+			added_features[i].last_coord < added_features[i].first_coord || added_features[i].last_coord > genome->sequence[ added_features[i].chrom_it ].size() )
+		{
+			Errors.handle_error( FATAL, (string)"Error in 'TGenome_Partition::build()': Feature (" + get_str( added_features[i].first_coord ) + "-" +
+										get_str( added_features[i].last_coord ) + ") lies outside chromosome " + get_str( added_features[i].chrom_it + 1 ) + ". ", __FILE__, __LINE__ );
+		}
+
+		features.push_back( added_features[i] );
+	}
+
+
+	// Group the features by chromosome and strand, so each strand is labeled in one pass
+	sort( features.begin(), features.end(),
+		  []( const TGenome_Feature & feature_1, const TGenome_Feature & feature_2 )
+		  {
+			  if( feature_1.chrom_it != feature_2.chrom_it ) { return feature_1.chrom_it < feature_2.chrom_it; }
+
+			  return feature_1.opposite_strand < feature_2.opposite_strand;
+		  } );
+
+
+	vector <unsigned char> labels;
+	unsigned int feature_it = 0;
+
+	for( unsigned int chrom_it = 0; chrom_it < genome->sequence.size(); chrom_it++ )
+	{
+		const size_t chrom_size = genome->sequence[chrom_it].size();
+
+		for( int strand = STRAND_W; strand <= STRAND_C; strand++ )
+		{
+			const bool opposite_strand = ( strand == STRAND_C );
+
+			labels.assign( chrom_size, SEGMENT_INTERGENIC );
+
+
+			// Label the strand, by position along it (so the Crick strand's labels run from the chromosome's last coordinate)
+			for( ; feature_it < features.size() && features[feature_it].chrom_it == chrom_it && features[feature_it].opposite_strand == opposite_strand; feature_it++ )
+			{
+				const TGenome_Feature & feature = features[feature_it];
+
+				const size_t first_pos = ( opposite_strand == FALSE ) ? feature.first_coord - 1 : chrom_size - feature.last_coord;
+				const size_t end_pos   = first_pos + ( feature.last_coord - feature.first_coord + 1 );
+
+				for( size_t pos = first_pos; pos < end_pos; pos++ )
+				{
+					if( labels[pos] < feature.type ) { labels[pos] = feature.type; }
+				}
+			}
+
+
+			// Store each run of one label as a segment
+			size_t run_start_pos = 0;
+
+			for( size_t pos = 1; pos <= chrom_size; pos++ )
+			{
+				if( pos == chrom_size || labels[pos] != labels[run_start_pos] )
+				{
+					segments[ labels[run_start_pos] ].push_back( TGenome_Segment( chrom_it, opposite_strand, run_start_pos, pos - run_start_pos ) );
+					num_nt	[ labels[run_start_pos] ] += pos - run_start_pos;
+
+					run_start_pos = pos;
+				}
+			}
+		}
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Find the segments of a type overlapping positions 'first_pos' through 'last_pos' of a strand, clipped to those positions
+void TGenome_Partition::find_segments( const Tenum_genome_segment_types type,
+									   const unsigned int chrom_it,
+									   const bool opposite_strand,
+									   const unsigned int first_pos,
+									   const unsigned int last_pos,
+									   vector <TGenome_Segment> * const found_segments ) const
+{
+	found_segments->clear();
+
+	const vector <TGenome_Segment> & type_segments = segments[type];
+
+	// Segments of one type never overlap, so along a strand their ends are sorted as their starts are
+	vector <TGenome_Segment>::const_iterator segment_it =
+		lower_bound( type_segments.begin(), type_segments.end(), TGenome_Segment( chrom_it, opposite_strand, first_pos, 1 ),
+					 []( const TGenome_Segment & segment, const TGenome_Segment & target )
+					 {
+						 if( segment.chrom_it 		 != target.chrom_it 	   ) { return segment.chrom_it 		  < target.chrom_it; 		}
+						 if( segment.opposite_strand != target.opposite_strand ) { return segment.opposite_strand < target.opposite_strand; }
+
+						 return segment.get_end_pos() <= target.start_pos;
+					 } );
+
+	for( ; segment_it != type_segments.end() && segment_it->chrom_it == chrom_it && segment_it->opposite_strand == opposite_strand && segment_it->start_pos <= last_pos; segment_it++ )
+	{
+		const unsigned int clipped_start_pos = max( segment_it->start_pos, 	   first_pos 	);
+		const unsigned int clipped_end_pos   = min( segment_it->get_end_pos(), last_pos + 1 );
+
+		found_segments->push_back( TGenome_Segment( chrom_it, opposite_strand, clipped_start_pos, clipped_end_pos - clipped_start_pos ) );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
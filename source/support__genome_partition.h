@@ -0,0 +1,179 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__genome_partition.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the partition of each strand of the
+//				 genome into coding, 5' TL, intronic, and intergenic segments
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//     *D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__GENOME_PARTITION_H_
+#define _SUPPORT__GENOME_PARTITION_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+// Project-specific header files:  support functions and related
+#include "support__packed_genome.h"
+#include "support__file_io.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// In order of precedence:  where features of different types overlap, the nucleotides take the type listed last
+enum Tenum_genome_segment_types
+{
+	SEGMENT_INTERGENIC,
+	SEGMENT_5_PRIME_TL,
+	SEGMENT_INTRONIC,
+	SEGMENT_CODING,
+
+	NUM_GENOME_SEGMENT_TYPES
+};
+//==============================================================================
+
+
+
+// An annotated stretch of one strand of a chromosome, in chromosome coordinates (1-based, with 'first_coord' the lower
+//   coordinate, whichever the strand)
+class TGenome_Feature
+{
+	public:
+		unsigned int chrom_it;
+		bool opposite_strand;
+		unsigned int first_coord;
+		unsigned int last_coord;
+		Tenum_genome_segment_types type;
+
+		TGenome_Feature( const unsigned int feature_chrom_it,
+						 const bool feature_opposite_strand,
+						 const unsigned int feature_first_coord,
+						 const unsigned int feature_last_coord,
+						 const Tenum_genome_segment_types feature_type ) :
+			chrom_it	   ( feature_chrom_it 		 ),
+			opposite_strand( feature_opposite_strand ),
+			first_coord	   ( feature_first_coord 	 ),
+			last_coord	   ( feature_last_coord 	 ),
+			type		   ( feature_type 			 )
+		{ }
+};
+//==============================================================================
+
+
+
+// A run of nucleotides of one type on one strand.  'start_pos' counts 5' to 3' along the strand from 0 (as positions of
+//   a 'TStrand_View' do), so the segment reads, in order, as 'strand[start_pos]' through 'strand[start_pos + length - 1]'
+class TGenome_Segment
+{
+	public:
+		unsigned int chrom_it;
+		bool opposite_strand;
+		unsigned int start_pos;
+		unsigned int length;
+
+		unsigned int get_end_pos( void ) const { return start_pos + length; }
+
+		TGenome_Segment( const unsigned int segment_chrom_it, const bool segment_opposite_strand, const unsigned int segment_start_pos, const unsigned int segment_length ) :
+			chrom_it	   ( segment_chrom_it 		 ),
+			opposite_strand( segment_opposite_strand ),
+			start_pos	   ( segment_start_pos 		 ),
+			length		   ( segment_length 		 )
+		{ }
+};
+//==============================================================================
+
+
+
+// Every nucleotide of both strands of the genome, classified once (from the GFF annotations, plus any features added by
+//   the caller) as coding, 5' TL, intronic, or intergenic, and stored as segments of each type.  The segments are read
+//   through views of the genome, so nothing is copied; the genome must outlive the partition
+class TGenome_Partition
+{
+	private:
+		const TFasta_Content * genome;
+		std::vector <std::vector <TGenome_Segment> > segments;		// By type; each sorted by chromosome, strand, then position
+		std::vector <size_t> num_nt;								// By type
+
+		void get_gff_features( std::vector <TGenome_Feature> * const features ) const;
+
+	public:
+		void build( const TFasta_Content & genome_seq, const std::vector <TGenome_Feature> & added_features = std::vector <TGenome_Feature>() );
+
+		const std::vector <TGenome_Segment> & get_segments( const Tenum_genome_segment_types type ) const { return segments[type]; }
+		size_t get_num_nt( const Tenum_genome_segment_types type ) const { return num_nt[type]; }
+
+		void find_segments( const Tenum_genome_segment_types type,
+							const unsigned int chrom_it,
+							const bool opposite_strand,
+							const unsigned int first_pos,
+							const unsigned int last_pos,
+							std::vector <TGenome_Segment> * const found_segments ) const;
+
+		TStrand_View get_strand( const unsigned int chrom_it, const bool opposite_strand ) const { return genome->sequence[ chrom_it ].get_strand( opposite_strand ); }
+		TStrand_View get_strand( const TGenome_Segment & segment ) 					 const { return get_strand( segment.chrom_it, segment.opposite_strand ); }
+
+		TGenome_Partition( void ) :
+			genome  ( NULL ),
+			segments( NUM_GENOME_SEGMENT_TYPES ),
+			num_nt	( NUM_GENOME_SEGMENT_TYPES, 0 )
+		{ }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__GENOME_PARTITION_H_
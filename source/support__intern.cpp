@@ -0,0 +1,265 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__intern.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code for the symbol table which interns names (gene
+//				 names, GO terms, data sources, ...) shared by many records
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstring>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+
+// Header file for this file
+#include "support__intern.h"
+
+
+
+#define SYMBOL_INIT_NUM_HASH_SLOTS			4096						// Must be a power of 2
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Returns the slot holding 'str', or the empty slot where it would be inserted
+size_t TSymbol_Table::find_slot( const string & str, const size_t str_hash ) const
+{
+	const size_t slot_mask = hash_slots.size() - 1;
+	size_t slot_it = str_hash & slot_mask;
+
+	while( hash_slots[slot_it] != NO_SYMBOL && get_string( hash_slots[slot_it] ) != str )
+	{
+		slot_it = ( slot_it + 1 ) & slot_mask;
+	}
+
+	return slot_it;
+}
+//------------------------------------------------------------------------------
+
+
+void TSymbol_Table::grow_hash_slots( void )
+{
+	vector <TSymbol_ID> old_hash_slots( hash_slots.size() * 2, NO_SYMBOL );
+	old_hash_slots.swap( hash_slots );
+
+	const size_t slot_mask = hash_slots.size() - 1;
+	hash <string> string_hash;
+
+	for( size_t i = 0; i < old_hash_slots.size(); i++ )
+	{
+		if( old_hash_slots[i] == NO_SYMBOL ) { continue; }
+
+		size_t slot_it = string_hash( get_string( old_hash_slots[i] ) ) & slot_mask;
+
+		while( hash_slots[slot_it] != NO_SYMBOL ) { slot_it = ( slot_it + 1 ) & slot_mask; }
+
+		hash_slots[slot_it] = old_hash_slots[i];
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+TSymbol_ID TSymbol_Table::intern( const string & str )
+{
+	const size_t str_hash = hash <string>()( str );
+
+	lock_guard <mutex> table_lock( table_mutex );
+
+	size_t slot_it = find_slot( str, str_hash );
+	if( hash_slots[slot_it] != NO_SYMBOL ) { return hash_slots[slot_it]; }
+
+
+	// Not yet interned:  store the string in the next free place in the current block (starting a new block if needed)
+	const TSymbol_ID new_symbol = num_symbols;
+	const TSymbol_ID block_it   = new_symbol >> SYMBOL_BLOCK_SIZE_LOG2;
+
+	if( block_it >= SYMBOL_MAX_NUM_BLOCKS )
+	{
+		Errors.handle_error( FATAL, "Error in 'TSymbol_Table::intern()': Symbol table full. ", __FILE__, __LINE__ );
+	}
+
+	if( ( new_symbol & ( SYMBOL_BLOCK_SIZE - 1 ) ) == 0 ) { blocks[block_it] = new string[ SYMBOL_BLOCK_SIZE ]; }
+
+	blocks[block_it][ new_symbol & ( SYMBOL_BLOCK_SIZE - 1 ) ] = str;
+	num_symbols++;
+
+	hash_slots[slot_it] = new_symbol;
+
+	// Keep the load factor at or below 1/2, so probe sequences stay short
+	if( (size_t)num_symbols * 2 > hash_slots.size() ) { grow_hash_slots(); }
+
+	return new_symbol;
+}
+//------------------------------------------------------------------------------
+
+
+// Unlike 'intern()', never adds 'str' to the table
+TSymbol_ID TSymbol_Table::find( const string & str )
+{
+	const size_t str_hash = hash <string>()( str );
+
+	lock_guard <mutex> table_lock( table_mutex );
+
+	return hash_slots[ find_slot( str, str_hash ) ];
+}
+//------------------------------------------------------------------------------
+
+
+TSymbol_Table::TSymbol_Table( void ) : num_symbols( 0 ), hash_slots( SYMBOL_INIT_NUM_HASH_SLOTS, NO_SYMBOL )
+{
+	memset( blocks, 0, sizeof( blocks ) );
+
+	intern( "" );  // 'EMPTY_SYMBOL'
+}
+//------------------------------------------------------------------------------
+
+
+TSymbol_Table::~TSymbol_Table( void )
+{
+	for( unsigned int i = 0; i < SYMBOL_MAX_NUM_BLOCKS && blocks[i] != NULL; i++ )
+	{
+		delete [] blocks[i];
+	}
+}
+//------------------------------------------------------------------------------
+
+//==============================================================================
+
+
+const string & TInterned_String::str( void ) const
+{
+	return get_symbol_table().get_string( symbol );
+}
+//------------------------------------------------------------------------------
+
+
+TInterned_String::TInterned_String( const string & str ) : symbol( get_symbol_table().intern( str ) )
+{ }
+//------------------------------------------------------------------------------
+
+
+TInterned_String::TInterned_String( const char * const str ) : symbol( get_symbol_table().intern( str ) )
+{ }
+//------------------------------------------------------------------------------
+
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Constructed on first use, so names may be interned during static initialization
+TSymbol_Table & get_symbol_table( void )
+{
+	static TSymbol_Table symbol_table;
+
+	return symbol_table;
+}
+//==============================================================================
+
+
+
+// Compares against the stored string, which takes no lock and doesn't add 'rhs' to the table
+bool operator==( const TInterned_String & lhs, const string & rhs )
+{
+	return lhs.str() == rhs;
+}
+//------------------------------------------------------------------------------
+
+
+bool operator==( const TInterned_String & lhs, const char * const rhs )
+{
+	return lhs.str() == rhs;
+}
+//==============================================================================
+
+
+
+ostream & operator<<( ostream & out_stream, const TInterned_String & interned )
+{
+	return out_stream << interned.str();
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,204 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__intern.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the symbol table which interns names
+//				 (gene names, GO terms, data sources, ...) shared by many records
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//      F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__INTERN_H_
+#define _SUPPORT__INTERN_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+#include <ostream>
+#include <mutex>
+#include <stdint.h>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+
+
+#define SYMBOL_BLOCK_SIZE_LOG2				12							// Symbols' strings are allocated 4096 at a time
+#define SYMBOL_BLOCK_SIZE					( 1 << SYMBOL_BLOCK_SIZE_LOG2 )
+#define SYMBOL_MAX_NUM_BLOCKS				16384						// Up to 2^26 distinct symbols
+
+#define EMPTY_SYMBOL						0							// The empty string is always interned first
+#define NO_SYMBOL							0xFFFFFFFF					// Returned by 'TSymbol_Table::find()' for strings never interned
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+typedef uint32_t TSymbol_ID;
+//==============================================================================
+
+
+
+// Each distinct string is stored once, in blocks of 'SYMBOL_BLOCK_SIZE' strings which are never moved or freed, and
+//   identified by a 32-bit ID.  Interning is serialized; looking up a symbol's string takes no lock, since a block is
+//   filled in before any ID within it is handed out
+class TSymbol_Table
+{
+	private:
+		std::mutex table_mutex;
+		std::string * blocks[SYMBOL_MAX_NUM_BLOCKS];
+		TSymbol_ID num_symbols;
+		std::vector <TSymbol_ID> hash_slots;		// Open addressing (linear probing); 'NO_SYMBOL' marks an empty slot
+
+		size_t find_slot( const std::string & str, const size_t str_hash ) const;
+		void   grow_hash_slots( void );
+
+		// Not copyable (holds a mutex, and owns the blocks)
+		TSymbol_Table( const TSymbol_Table & );
+		TSymbol_Table & operator=( const TSymbol_Table & );
+
+	public:
+		TSymbol_ID intern( const std::string & str );
+		TSymbol_ID find  ( const std::string & str );
+
+		const std::string & get_string( const TSymbol_ID symbol ) const
+		{
+			return blocks[ symbol >> SYMBOL_BLOCK_SIZE_LOG2 ][ symbol & ( SYMBOL_BLOCK_SIZE - 1 ) ];
+		}
+
+		TSymbol_Table( void );
+		~TSymbol_Table( void );
+};
+//==============================================================================
+
+
+
+// A name stored as its symbol ID.  Two interned strings are equal exactly when their IDs are, so comparing them is an
+//   integer compare; otherwise, an interned string reads like the 'std::string' it stands for (ordering included)
+class TInterned_String
+{
+	private:
+		TSymbol_ID symbol;
+
+	public:
+		TSymbol_ID get_symbol( void ) const { return symbol; }
+
+		const std::string & str( void ) const;
+		operator const std::string & ( void ) const { return str(); }
+
+		const char * c_str ( void ) const { return str().c_str();  }
+		size_t 		 size  ( void ) const { return str().size();   }
+		size_t 		 length( void ) const { return str().length(); }
+		bool   		 empty ( void ) const { return symbol == EMPTY_SYMBOL; }
+
+		int compare( const std::string & other ) const { return str().compare( other ); }
+
+		TInterned_String( void ) : symbol( EMPTY_SYMBOL ) { }
+		TInterned_String( const std::string & str );
+		TInterned_String( const char * const str );
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+TSymbol_Table & get_symbol_table( void );
+
+bool operator==( const TInterned_String & lhs, const std::string & rhs );
+bool operator==( const TInterned_String & lhs, const char * const rhs );
+
+std::ostream & operator<<( std::ostream & out_stream, const TInterned_String & interned );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// F. Inline (Non-Member) Function Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+inline bool operator==( const TInterned_String & lhs, const TInterned_String & rhs ) { return lhs.get_symbol() == rhs.get_symbol(); }
+inline bool operator!=( const TInterned_String & lhs, const TInterned_String & rhs ) { return lhs.get_symbol() != rhs.get_symbol(); }
+
+inline bool operator==( const std::string & lhs, const TInterned_String & rhs ) { return rhs == lhs; }
+inline bool operator!=( const TInterned_String & lhs, const std::string & rhs ) { return !( lhs == rhs ); }
+inline bool operator!=( const std::string & lhs, const TInterned_String & rhs ) { return !( rhs == lhs ); }
+
+inline bool operator==( const char * const lhs, const TInterned_String & rhs ) { return rhs == lhs; }
+inline bool operator!=( const TInterned_String & lhs, const char * const rhs ) { return !( lhs == rhs ); }
+inline bool operator!=( const char * const lhs, const TInterned_String & rhs ) { return !( rhs == lhs ); }
+
+// Ordered by the strings themselves (not their IDs, which depend on the order the strings were first seen)
+inline bool operator< ( const TInterned_String & lhs, const TInterned_String & rhs ) { return lhs.str() < rhs.str(); }
+
+inline std::string operator+( const std::string & lhs, const TInterned_String & rhs ) { return lhs + rhs.str(); }
+inline std::string operator+( const TInterned_String & lhs, const std::string & rhs ) { return lhs.str() + rhs; }
+inline std::string operator+( const char * const lhs,  const TInterned_String & rhs ) { return lhs + rhs.str(); }
+inline std::string operator+( const TInterned_String & lhs, const char * const rhs  ) { return lhs.str() + rhs; }
+inline std::string operator+( const char lhs, 		   const TInterned_String & rhs ) { return lhs + rhs.str(); }
+inline std::string operator+( const TInterned_String & lhs, const char rhs 		  ) { return lhs.str() + rhs; }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__INTERN_H_
@@ -0,0 +1,520 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__logging.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code for the buffered logging backend, which moves
+//				 console and log file output off of the calling threads
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//     *D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>   	// For find()
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+#include <atomic>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__file_io.h"
+#include "support__filesystem.h"
+#include "support__general.h"
+
+// Header file for this file
+#include "support__logging.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+TLog_Backend Log_Backend;					// Buffers and writes all console and program log output
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+TLog_Thread_Buffer::~TLog_Thread_Buffer( )
+{
+	// Hand off anything still buffered when the thread exits
+	if( registered == TRUE )
+	{
+		Log_Backend.hand_off( this );
+		Log_Backend.unregister_buffer( this );
+	}
+}
+//==============================================================================
+
+
+
+TLog_Backend::TLog_Backend( ) :
+	queued_bytes( 0 ),
+	spool_file( tmpfile() ),
+	flusher_running( FALSE ),
+	stop_requested( FALSE ),
+	flush_requested_gen( 0 ),
+	flush_completed_gen( 0 ),
+	min_log_level( MIN_LOG_LEVEL )
+{ }
+//------------------------------------------------------------------------------
+
+
+TLog_Backend::~TLog_Backend( )
+{
+	stop();
+
+	if( spool_file != NULL ) { fclose( spool_file ); }		// Temporary file is deleted on closing
+}
+//------------------------------------------------------------------------------
+
+
+TLog_Thread_Buffer & TLog_Backend::get_thread_buffer( void )
+{
+	static thread_local TLog_Thread_Buffer thread_buffer;
+
+	if( thread_buffer.registered == FALSE ) { register_buffer( &thread_buffer ); }
+
+	return thread_buffer;
+}
+//------------------------------------------------------------------------------
+
+
+// Register a thread's buffer so the flusher can sweep it, starting the flusher thread on first use
+void TLog_Backend::register_buffer( TLog_Thread_Buffer * const buffer )
+{
+	lock_guard <mutex> registry_lock( registry_mutex );
+
+	registered_buffers.push_back( buffer );
+	buffer->registered = TRUE;
+
+	lock_guard <mutex> queue_lock( queue_mutex );
+
+	if( flusher_running == FALSE && stop_requested == FALSE )
+	{
+		try
+		{
+			flusher = thread( &TLog_Backend::flusher_loop, this );
+			flusher_running = TRUE;
+		}
+		catch( const system_error & )
+		{
+			// If a thread can't be created, chunks are written synchronously as they're handed off (see 'hand_off()')
+		}
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TLog_Backend::unregister_buffer( TLog_Thread_Buffer * const buffer )
+{
+	lock_guard <mutex> registry_lock( registry_mutex );
+
+	registered_buffers.erase( remove( registered_buffers.begin(), registered_buffers.end(), buffer ), registered_buffers.end() );
+	buffer->registered = FALSE;
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Move a thread's buffered text to the flusher queue.  Chunks from one thread are queued while holding that thread's
+//   buffer mutex, and the flusher sweeps under the same mutex, so each thread's output stays in order
+void TLog_Backend::hand_off( TLog_Thread_Buffer * const buffer )
+{
+	lock_guard <mutex> buffer_lock( buffer->buffer_mutex );
+
+	if( buffer->pending.size() == 0 ) { return; }
+
+
+	unique_lock <mutex> queue_lock( queue_mutex );
+
+	if( flusher_running == FALSE )
+	{
+		// No flusher (not yet started, stopped, or couldn't be created), so write synchronously
+		write_chunk( buffer->pending );
+	}
+	else
+	{
+		queued_bytes += buffer->pending.size();
+		queue.push_back( TLog_Chunk() );
+		queue.back().console_text.swap( buffer->pending.console_text );
+		queue.back().log_text.swap	  ( buffer->pending.log_text 	 );
+
+		queue_not_empty.notify_one();
+	}
+
+	buffer->pending.console_text.clear();
+	buffer->pending.log_text.clear();
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TLog_Backend::write( const string & text, const unsigned int destination, const bool append_newline )
+{
+	TLog_Thread_Buffer & buffer = get_thread_buffer();
+
+
+	// If the flusher has fallen far behind, wait for it rather than letting the queue grow without bound
+	//   (done before taking the buffer mutex, which the flusher may need in order to sweep)
+	if( queued_bytes.load( memory_order_relaxed ) > LOG_MAX_QUEUED_BYTES )
+	{
+		unique_lock <mutex> queue_lock( queue_mutex );
+
+		while( flusher_running == TRUE && queued_bytes > LOG_MAX_QUEUED_BYTES )
+		{
+			queue_not_full.wait( queue_lock );
+		}
+	}
+
+
+	bool buffer_full;
+
+	{
+		lock_guard <mutex> buffer_lock( buffer.buffer_mutex );
+
+		if( destination != LOG_TO_FILE_ONLY )
+		{
+			buffer.pending.console_text += text;
+			if( append_newline == TRUE ) { buffer.pending.console_text += '\n'; }
+		}
+
+		if( destination != LOG_TO_CONSOLE_ONLY )
+		{
+			buffer.pending.log_text += text;
+			if( append_newline == TRUE ) { buffer.pending.log_text += '\n'; }
+		}
+
+		buffer_full = ( buffer.pending.size() >= LOG_THREAD_BUFFER_SIZE );
+	}
+
+
+	if( buffer_full == TRUE ) { hand_off( &buffer ); }
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Block until all text logged so far (by every thread) has been written to the console and the spool file
+void TLog_Backend::flush( void )
+{
+	hand_off( &get_thread_buffer() );
+
+
+	unique_lock <mutex> queue_lock( queue_mutex );
+
+	if( flusher_running == FALSE )
+	{
+		lock_guard <mutex> spool_lock( spool_mutex );
+
+		fflush( stdout );
+		if( spool_file != NULL ) { fflush( spool_file ); }
+
+		return;
+	}
+
+	unsigned long target_gen = ++flush_requested_gen;
+	queue_not_empty.notify_one();
+
+	while( flusher_running == TRUE && flush_completed_gen < target_gen )
+	{
+		flush_completed.wait( queue_lock );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TLog_Backend::stop( void )
+{
+	{
+		unique_lock <mutex> queue_lock( queue_mutex );
+
+		if( flusher_running == FALSE ) { return; }
+
+		stop_requested = TRUE;
+		queue_not_empty.notify_one();
+	}
+
+	flusher.join();
+
+
+	// Write anything queued during the flusher's final pass.  Anything logged after this point is written synchronously
+	{
+		lock_guard <mutex> queue_lock( queue_mutex );
+		flusher_running = FALSE;
+
+		for( unsigned int i = 0; i < queue.size(); i++ )
+		{
+			write_chunk( queue[i] );
+		}
+
+		queue.clear();
+		queued_bytes = 0;
+
+		fflush( stdout );
+	}
+
+	flush_completed.notify_all();
+	queue_not_full.notify_all();
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TLog_Backend::flusher_loop( void )
+{
+	deque <TLog_Chunk> chunks_to_write;
+
+	while( TRUE )
+	{
+		unsigned long target_gen;
+		bool stopping;
+
+
+		// ------------------------------
+		// Wait until there's something to write, a flush is requested, or the maximum latency has elapsed
+		{
+			unique_lock <mutex> queue_lock( queue_mutex );
+
+			if( queue.empty() && stop_requested == FALSE && flush_requested_gen == flush_completed_gen )
+			{
+				queue_not_empty.wait_for( queue_lock, chrono::milliseconds( LOG_MAX_LATENCY_MS ) );
+			}
+
+			target_gen = flush_requested_gen;
+			stopping   = stop_requested;
+		}
+		// ------------------------------
+
+
+
+		// ------------------------------
+		// Sweep the text still sitting in each thread's buffer onto the back of the queue, then take the whole queue
+		{
+			lock_guard <mutex> registry_lock( registry_mutex );
+
+			for( unsigned int i = 0; i < registered_buffers.size(); i++ )
+			{
+				lock_guard <mutex> buffer_lock( registered_buffers[i]->buffer_mutex );
+
+				if( registered_buffers[i]->pending.size() != 0 )
+				{
+					lock_guard <mutex> queue_lock( queue_mutex );
+
+					queued_bytes += registered_buffers[i]->pending.size();
+					queue.push_back( TLog_Chunk() );
+					queue.back().console_text.swap( registered_buffers[i]->pending.console_text );
+					queue.back().log_text.swap	  ( registered_buffers[i]->pending.log_text 	);
+				}
+			}
+		}
+
+		{
+			lock_guard <mutex> queue_lock( queue_mutex );
+
+			chunks_to_write.swap( queue );
+			queued_bytes = 0;
+		}
+
+		queue_not_full.notify_all();
+		// ------------------------------
+
+
+
+		// ------------------------------
+		// Write the chunks in the order they were queued, flushing the console once per batch rather than per line
+		for( unsigned int i = 0; i < chunks_to_write.size(); i++ )
+		{
+			write_chunk( chunks_to_write[i] );
+		}
+
+		chunks_to_write.clear();
+		fflush( stdout );
+
+		{
+			lock_guard <mutex> spool_lock( spool_mutex );
+			if( spool_file != NULL ) { fflush( spool_file ); }
+		}
+
+		{
+			lock_guard <mutex> queue_lock( queue_mutex );
+			flush_completed_gen = target_gen;
+		}
+
+		flush_completed.notify_all();
+		// ------------------------------
+
+
+		if( stopping == TRUE ) { break; }
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TLog_Backend::write_chunk( const TLog_Chunk & chunk )
+{
+	if( chunk.console_text.size() != 0 )
+	{
+		fwrite( chunk.console_text.data(), 1, chunk.console_text.size(), stdout );
+	}
+
+	if( chunk.log_text.size() != 0 )
+	{
+		lock_guard <mutex> spool_lock( spool_mutex );
+
+		if( spool_file != NULL ) { fwrite( chunk.log_text.data(), 1, chunk.log_text.size(), spool_file ); }
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Copy the spooled log to the specified file in bounded chunks (of 'LOG_FILE_CHUNK_SIZE' bytes).  As in
+//   'write_file_contents()', the copy is written to a partial file that replaces the specified file once complete
+int TLog_Backend::copy_log_to_file( const string & file_folder_path, const string & file_name )
+{
+	flush();
+
+
+	if( create_folder( file_folder_path ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TLog_Backend::copy_log_to_file()': Unable to create/verify path for file '" + file_name + "'. ", __FILE__, __LINE__ );
+	}
+
+	const string full_file_path    = get_file_path( file_folder_path, file_name );
+	const string partial_file_path = get_partial_file_path( full_file_path );
+
+	FILE * log_file = fopen( partial_file_path.c_str(), "wb" );
+	if( log_file == NULL )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TLog_Backend::copy_log_to_file()': Unable to open file '" + partial_file_path + "'. ", __FILE__, __LINE__ );
+	}
+
+
+	bool copy_failed = FALSE;
+
+	{
+		lock_guard <mutex> spool_lock( spool_mutex );		// Released before any error is reported (which logs)
+
+		if( spool_file != NULL )
+		{
+			vector <char> chunk( LOG_FILE_CHUNK_SIZE );
+
+			fflush( spool_file );
+			rewind( spool_file );
+
+			size_t num_read;
+			while( ( num_read = fread( &chunk[0], 1, chunk.size(), spool_file ) ) != 0 )
+			{
+				if( fwrite( &chunk[0], 1, num_read, log_file ) != num_read ) { copy_failed = TRUE; break; }
+			}
+
+			fseek( spool_file, 0, SEEK_END );	// Further log text continues to be appended
+		}
+	}
+
+	if( fclose( log_file ) != 0 ) { copy_failed = TRUE; }
+
+	if( copy_failed == TRUE )
+	{
+		remove( partial_file_path.c_str() );
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TLog_Backend::copy_log_to_file()': Unable to write file '" + partial_file_path + "'. ", __FILE__, __LINE__ );
+	}
+
+	// Replace the specified file with the now-complete partial file
+	if( replace_file( partial_file_path, full_file_path ) )
+	{
+		remove( partial_file_path.c_str() );
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TLog_Backend::copy_log_to_file()': ", __FILE__, __LINE__ );
+	}
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Raise (or restore) the level below which output is discarded, e.g. to quiet the informational output of functions
+//   that are called repeatedly.  A level below 'MIN_LOG_LEVEL' has no effect, since the output functions also
+//   discard anything below 'MIN_LOG_LEVEL' at compile time
+void TLog_Backend::set_min_log_level( const unsigned int log_level )
+{
+	min_log_level.store( log_level, memory_order_relaxed );
+
+	return;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,180 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__logging.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the buffered logging backend used by
+//				 'output_text_line()' and 'TProgram_Log'
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//      C. Global Variable Declarations (including those in other files)
+//     *D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__LOGGING_H_
+#define _SUPPORT__LOGGING_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Text handed from a thread's buffer to the flusher thread.  Console and log text are kept separate since some
+//   messages go to only one of the two
+class TLog_Chunk
+{
+	public:
+		std::string console_text;
+		std::string log_text;
+
+		size_t size( void ) const { return console_text.size() + log_text.size(); }
+};
+//==============================================================================
+
+
+
+// Per-thread buffer that messages are formatted into.  The owning thread is the only writer; the flusher thread
+//   periodically sweeps it so that text isn't held back indefinitely
+class TLog_Thread_Buffer
+{
+	friend class TLog_Backend;
+
+	private:
+		std::mutex buffer_mutex;	// Only contended while the flusher sweeps this buffer
+		TLog_Chunk pending;
+		bool registered;
+
+	public:
+		TLog_Thread_Buffer( ) : registered( FALSE ) { }
+		~TLog_Thread_Buffer( );
+};
+//==============================================================================
+
+
+
+// Buffered, non-blocking logging backend.  Each thread formats into its own 'TLog_Thread_Buffer'; full buffers are
+//   queued for a background flusher thread, which writes the console text to stdout and spools the log text to a
+//   temporary file, so the log is never held in memory in its entirety.  Text from any one thread is always written
+//   in order; text from different threads is interleaved in the order the chunks were handed off
+class TLog_Backend
+{
+	friend class TLog_Thread_Buffer;
+
+	private:
+		std::mutex queue_mutex;
+		std::condition_variable queue_not_empty;
+		std::condition_variable queue_not_full;
+		std::condition_variable flush_completed;
+		std::deque <TLog_Chunk> queue;
+		std::atomic <size_t> queued_bytes;		// Read without the queue mutex to check for backpressure
+
+		std::mutex registry_mutex;
+		std::vector <TLog_Thread_Buffer *> registered_buffers;
+
+		std::mutex spool_mutex;
+		std::FILE * spool_file;
+
+		std::thread flusher;
+		bool flusher_running;
+		bool stop_requested;
+		unsigned long flush_requested_gen;
+		unsigned long flush_completed_gen;
+
+		std::atomic <unsigned int> min_log_level;	// Runtime threshold; 'MIN_LOG_LEVEL' is applied separately, at compile time
+
+		TLog_Thread_Buffer & get_thread_buffer( void );
+		void register_buffer  ( TLog_Thread_Buffer * const buffer );
+		void unregister_buffer( TLog_Thread_Buffer * const buffer );
+		void hand_off( TLog_Thread_Buffer * const buffer );
+		void flusher_loop( void );
+		void write_chunk( const TLog_Chunk & chunk );
+
+	public:
+		void write( const std::string & text, const unsigned int destination, const bool append_newline = FALSE );
+		void flush( void );
+		void stop( void );
+		int copy_log_to_file( const std::string & file_folder_path, const std::string & file_name );
+
+		void set_min_log_level( const unsigned int log_level );
+		unsigned int get_min_log_level( void ) const { return min_log_level.load( std::memory_order_relaxed ); }
+
+		TLog_Backend( );
+		~TLog_Backend( );
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TLog_Backend Log_Backend;
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__LOGGING_H_
@@ -0,0 +1,252 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__packed_genome.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to store chromosome sequences at 2 bits per
+//				 nucleotide and read either strand
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//     *D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+#include "support__bioinformatics.h"
+
+// Header file for this file
+#include "support__packed_genome.h"
+
+
+
+#define NOT_A_PACKED_NT				NUM_DIFF_NT	// 'get_packed_nt_code()' value of any character stored as an exception
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// The 2-bit codes are the 'Tenum_nucleotides' values (as 'PACKED_NT_CHARS' is ordered)
+static unsigned int get_packed_nt_code( const char nt )
+{
+	return Nt_Code_Table[ (unsigned char)nt ];
+}
+//------------------------------------------------------------------------------
+
+
+TPacked_Chrom::TPacked_Chrom( const string & chrom_seq ) :
+	packed_nt( ( chrom_seq.size() + PACKED_NT_PER_WORD - 1 ) / PACKED_NT_PER_WORD, 0 ),
+	exceptions( 0 ),
+	length( chrom_seq.size() )
+{
+	for( size_t pos = 0; pos < chrom_seq.size(); pos++ )
+	{
+		unsigned int code = get_packed_nt_code( chrom_seq[pos] );
+
+		// Exceptions are stored as 'A' (code 0) in 'packed_nt'
+		if( code == NOT_A_PACKED_NT )
+		{
+			exceptions.push_back( make_pair( (unsigned int)pos, chrom_seq[pos] ) );
+			continue;
+		}
+
+		packed_nt[ pos / PACKED_NT_PER_WORD ] |= (unsigned long long)code << ( 2 * ( pos % PACKED_NT_PER_WORD ) );
+	}
+}
+//------------------------------------------------------------------------------
+
+
+// Index in 'exceptions' of the first exception at or after 'pos' ('exceptions.size()' if there are none)
+unsigned int TPacked_Chrom::get_first_exception_it( const size_t pos ) const
+{
+	unsigned int low_it  = 0;
+	unsigned int high_it = exceptions.size();
+
+	while( low_it < high_it )
+	{
+		unsigned int mid_it = low_it + ( high_it - low_it ) / 2;
+
+		if	  ( exceptions[mid_it].first < pos )  { low_it  = mid_it + 1; }
+		else/*( exceptions[mid_it].first >= pos )*/{ high_it = mid_it; 	  }
+	}
+
+	return low_it;
+}
+//------------------------------------------------------------------------------
+
+
+// Index in 'exceptions' of the exception at 'pos', or -1 if the nucleotide there is packed
+int TPacked_Chrom::find_exception( const size_t pos ) const
+{
+	unsigned int exception_it = get_first_exception_it( pos );
+
+	if( exception_it < exceptions.size() && exceptions[exception_it].first == pos ) { return exception_it; }
+
+	return -1;
+}
+//------------------------------------------------------------------------------
+
+
+char TPacked_Chrom::operator[]( const size_t pos ) const
+{
+	if( exceptions.empty() == FALSE )
+	{
+		int exception_it = find_exception( pos );
+		if( exception_it != -1 ) { return exceptions[exception_it].second; }
+	}
+
+	return PACKED_NT_CHARS[ get_code( pos ) ];
+}
+//------------------------------------------------------------------------------
+
+
+// Complement of the nucleotide at 'pos'.  As in 'get_opposite_strand()', exceptions are returned unchanged
+char TPacked_Chrom::get_complement( const size_t pos ) const
+{
+	if( exceptions.empty() == FALSE )
+	{
+		int exception_it = find_exception( pos );
+		if( exception_it != -1 ) { return exceptions[exception_it].second; }
+	}
+
+	return PACKED_NT_COMPLEMENT_CHARS[ get_code( pos ) ];
+}
+//------------------------------------------------------------------------------
+
+
+// As 'std::string::substr()' (0-indexed; 'len' is limited to the end of the chromosome)
+string TPacked_Chrom::substr( const size_t pos, const size_t len ) const
+{
+	return get_seq( pos, len, FALSE );
+}
+//------------------------------------------------------------------------------
+
+
+// The 'len' nucleotides starting at 'pos' (0-indexed, on the Watson strand).  If 'opposite_strand' is TRUE, the reverse
+//   complement is returned (the same sequence read 5' to 3' on the Crick strand), decoded directly rather than through a
+//   copy of the Watson sequence
+string TPacked_Chrom::get_seq( const size_t pos, const size_t len, const bool opposite_strand ) const
+{
+	if( pos > length )
+	{
+		Errors.handle_error( FATAL, "Error in 'TPacked_Chrom::get_seq()': Sequence specified was out of range. ", __FILE__, __LINE__ );
+	}
+
+	string sequence( ( len > length - pos ? length - pos : len ), 'A' );
+
+	if( sequence.empty() == FALSE ) { copy_seq( pos, sequence.size(), opposite_strand, &sequence[0] ); }
+
+	return sequence;
+}
+//------------------------------------------------------------------------------
+
+
+// As 'get_seq()', but decoded into the caller's buffer (which must hold 'len' characters).  Returns the number of
+//   nucleotides written, which is less than 'len' only if the sequence runs past the end of the chromosome
+size_t TPacked_Chrom::copy_seq( const size_t pos, const size_t len, const bool opposite_strand, char * const dest ) const
+{
+	if( pos > length )
+	{
+		Errors.handle_error( FATAL, "Error in 'TPacked_Chrom::copy_seq()': Sequence specified was out of range. ", __FILE__, __LINE__ );
+	}
+
+	const size_t seq_len = ( len > length - pos ? length - pos : len );
+
+	if( opposite_strand == FALSE )
+	{
+		for( size_t i = 0; i < seq_len; i++ ) { dest[i] = PACKED_NT_CHARS[ get_code( pos + i ) ]; }
+	}
+	else/*( opposite_strand == TRUE )*/
+	{
+		for( size_t i = 0; i < seq_len; i++ ) { dest[ seq_len - 1 - i ] = PACKED_NT_COMPLEMENT_CHARS[ get_code( pos + i ) ]; }
+	}
+
+
+	// Overwrite any exceptions in the range (unchanged on either strand)
+	if( exceptions.empty() == FALSE )
+	{
+		for( unsigned int exception_it = get_first_exception_it( pos ); exception_it < exceptions.size() && exceptions[exception_it].first < pos + seq_len; exception_it++ )
+		{
+			size_t seq_it = exceptions[exception_it].first - pos;
+			if( opposite_strand == TRUE ) { seq_it = seq_len - 1 - seq_it; }
+
+			dest[seq_it] = exceptions[exception_it].second;
+		}
+	}
+
+	return seq_len;
+}
+//------------------------------------------------------------------------------
+
+
+TStrand_View TPacked_Chrom::get_strand( const bool opposite_strand ) const
+{
+	return TStrand_View( *this, opposite_strand );
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
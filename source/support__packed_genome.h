@@ -0,0 +1,142 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__packed_genome.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the classes used to store chromosome
+//				 sequences at 2 bits per nucleotide and read either strand
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//     *D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__PACKED_GENOME_H_
+#define _SUPPORT__PACKED_GENOME_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+#include <utility>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+
+
+#define PACKED_NT_PER_WORD			32			// 2 bits per nucleotide in a 64-bit word
+#define PACKED_NT_CHARS				"ACGT"		// Indexed by the 2-bit code of each nucleotide
+#define PACKED_NT_COMPLEMENT_CHARS	"TGCA"		// Complement of each 2-bit code (always '3 - code')
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+class TStrand_View;
+
+
+
+// A chromosome stored at 2 bits per nucleotide.  The few characters that aren't 'A', 'C', 'G', or 'T' (e.g. 'N', or
+//   lowercase nucleotides) are kept, in order, as exceptions, so every character reads back exactly as it was stored.
+//   'size()', 'operator[]', and 'substr()' match those of the std::string the chromosome was packed from
+class TPacked_Chrom
+{
+	private:
+		std::vector <unsigned long long> packed_nt;
+		std::vector <std::pair <unsigned int, char> > exceptions;	// (Position, character), sorted by position
+		size_t length;
+
+		unsigned int get_code( const size_t pos ) const { return ( packed_nt[ pos / PACKED_NT_PER_WORD ] >> ( 2 * ( pos % PACKED_NT_PER_WORD ) ) ) & 0x3; }
+		unsigned int get_first_exception_it( const size_t pos ) const;
+		int find_exception( const size_t pos ) const;
+
+	public:
+		size_t size( void ) const { return length; }
+		char operator[]( const size_t pos ) const;
+		char get_complement( const size_t pos ) const;
+
+		std::string substr( const size_t pos, const size_t len = std::string::npos ) const;
+		std::string get_seq( const size_t pos, const size_t len, const bool opposite_strand ) const;
+		size_t 		copy_seq( const size_t pos, const size_t len, const bool opposite_strand, char * const dest ) const;
+
+		TStrand_View get_strand( const bool opposite_strand ) const;
+
+		TPacked_Chrom( const std::string & chrom_seq );
+		TPacked_Chrom( ) : length( 0 ) { }
+};
+//==============================================================================
+
+
+
+// One strand of a packed chromosome, read 5' to 3' (so position 0 of the Crick strand is the complement of the last
+//   nucleotide of the chromosome).  Nothing is copied; the opposite strand is complemented as it's read
+class TStrand_View
+{
+	private:
+		const TPacked_Chrom * chrom;
+		bool opposite_strand;
+
+	public:
+		size_t size( void ) const { return chrom->size(); }
+
+		char operator[]( const size_t pos ) const
+		{
+			if	  ( opposite_strand == FALSE )  { return (*chrom)[pos]; }
+			else/*( opposite_strand == TRUE )*/ { return chrom->get_complement( chrom->size() - 1 - pos ); }
+		}
+
+		TStrand_View( const TPacked_Chrom & strand_chrom, const bool strand_opposite ) :
+			chrom( &strand_chrom ),
+			opposite_strand( strand_opposite )
+		{ }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__PACKED_GENOME_H_
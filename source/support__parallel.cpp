@@ -0,0 +1,383 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__parallel.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code to spread independent per-item work across worker
+//				 threads
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+
+// Header file for this file
+#include "support__parallel.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+static thread_local unsigned int parallel_task_depth = 0;		// Number of 'parallel_for()' loops this thread is running tasks for
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+void TWork_Range::assign( const unsigned int first_it, const unsigned int last_it )
+{
+	lock_guard <mutex> range_lock( range_mutex );
+
+	next_it = first_it;
+	end_it  = last_it;
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Claim up to 'grain_size' items from the front of the range, as [*first_it, *last_it)
+bool TWork_Range::take_front( const unsigned int grain_size, unsigned int * const first_it, unsigned int * const last_it )
+{
+	lock_guard <mutex> range_lock( range_mutex );
+
+	if( next_it >= end_it ) { return FALSE; }
+
+	*first_it = next_it;
+	*last_it  = ( end_it - next_it > grain_size ? next_it + grain_size : end_it );
+	next_it   = *last_it;
+
+	return TRUE;
+}
+//------------------------------------------------------------------------------
+
+
+// Claim the back half of the range (rounded up, so a single remaining item can also be stolen)
+bool TWork_Range::steal_back( unsigned int * const first_it, unsigned int * const last_it )
+{
+	lock_guard <mutex> range_lock( range_mutex );
+
+	if( next_it >= end_it ) { return FALSE; }
+
+	*last_it  = end_it;
+	*first_it = end_it - ( end_it - next_it + 1 ) / 2;
+	end_it 	  = *first_it;
+
+	return TRUE;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Number of threads (including the calling thread) that 'parallel_for()' spreads work across
+unsigned int get_num_worker_threads( void )
+{
+	unsigned int num_threads = NUM_WORKER_THREADS;
+
+	if( num_threads == 0 ) { num_threads = thread::hardware_concurrency(); }
+
+	// 'hardware_concurrency()' returns 0 if the number can't be determined
+	return ( num_threads > 0 ? num_threads : 1 );
+}
+//------------------------------------------------------------------------------
+
+
+// Whether this thread is running a task for a 'parallel_for()' that was spread across threads (and so shares the worker
+//   threads with that loop's other tasks).  Work started from such a task shouldn't start threads of its own
+bool is_within_parallel_task( void )
+{
+	return ( parallel_task_depth > 0 );
+}
+//------------------------------------------------------------------------------
+
+
+// Process all of the items owned by 'ranges[worker_it]', then steal from the other workers until no items remain.  An
+//   exception thrown by a task is kept in '*worker_exception' (for the calling thread to rethrow once every worker has
+//   been joined), and empties all of the ranges, so the other workers stop once their current chunk is done
+static void run_parallel_worker( const unsigned int worker_it,
+								 vector <TWork_Range> & ranges,
+								 const TParallel_Task & task,
+								 const unsigned int grain_size,
+								 exception_ptr * const worker_exception )
+{
+	unsigned int first_it = 0;
+	unsigned int last_it  = 0;
+
+	parallel_task_depth++;
+
+	try
+	{
+		while( TRUE )
+		{
+			while( ranges[worker_it].take_front( grain_size, &first_it, &last_it ) )
+			{
+				for( unsigned int item_it = first_it; item_it < last_it; item_it++ ) { task( item_it ); }
+			}
+
+
+			// Own range is empty:  steal half of the next non-empty range (starting with the neighbour, to spread the victims)
+			bool stolen = FALSE;
+
+			for( unsigned int i = 1; i < ranges.size() && stolen == FALSE; i++ )
+			{
+				stolen = ranges[ ( worker_it + i ) % ranges.size() ].steal_back( &first_it, &last_it );
+			}
+
+			// Items are never added to a range, so once every range has been found empty, all items have been claimed
+			if( stolen == FALSE ) { break; }
+
+			ranges[worker_it].assign( first_it, last_it );
+		}
+	}
+	catch( ... )
+	{
+		*worker_exception = current_exception();
+
+		for( unsigned int i = 0; i < ranges.size(); i++ ) { ranges[i].assign( 0, 0 ); }
+	}
+
+	parallel_task_depth--;
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Entry point of the threads started here.  If the loop was called from within a task run by a 'TError_Collector',
+//   'work' runs within that task as well, so an error raised on this thread is collected (and a fatal one abandons the
+//   task) rather than ending the program
+static void run_within_caller_task( const TTask_Error_Scope * const caller_scope, const function <void( void )> & work )
+{
+	if( caller_scope == NULL )
+	{
+		work();
+	}
+	else/*( caller_scope != NULL )*/
+	{
+		TTask_Error_Scope thread_scope( caller_scope->collector, caller_scope->task_it );
+
+		work();
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Call 'task( item_it )' once for each item_it in [0, num_items), spread across 'get_num_worker_threads()' threads.
+//   Each thread starts with an equal, contiguous share of the items and takes them 'grain_size' at a time; a thread that
+//   runs out steals half of another thread's remaining share, so uneven per-item costs don't leave threads idle.
+//   Returns once every task has completed; the order in which tasks run is unspecified.  If a task throws, no further
+//   chunks are started, and the exception is rethrown from the calling thread once all of the threads have been joined
+void parallel_for( const unsigned int num_items, const TParallel_Task & task, const unsigned int grain_size )
+{
+	const unsigned int chunk_size = ( grain_size > 0 ? grain_size : 1 );
+	unsigned int num_threads = get_num_worker_threads();
+
+	if( num_threads > ( num_items + chunk_size - 1 ) / chunk_size ) { num_threads = ( num_items + chunk_size - 1 ) / chunk_size; }
+
+
+	// Not worth starting threads
+	if( num_threads <= 1 )
+	{
+		for( unsigned int item_it = 0; item_it < num_items; item_it++ ) { task( item_it ); }
+
+		return;
+	}
+
+
+	vector <TWork_Range> ranges( num_threads );
+
+	for( unsigned int worker_it = 0; worker_it < num_threads; worker_it++ )
+	{
+		ranges[worker_it].assign( (unsigned long)num_items * worker_it / num_threads, (unsigned long)num_items * ( worker_it + 1 ) / num_threads );
+	}
+
+
+	// The calling thread works as well (as worker 0)
+	const TTask_Error_Scope * const caller_scope = TTask_Error_Scope::get_current();
+	vector <exception_ptr> worker_exceptions( num_threads );
+	vector <thread> workers;
+
+	for( unsigned int worker_it = 1; worker_it < num_threads; worker_it++ )
+	{
+		workers.push_back( thread( run_within_caller_task, caller_scope, [&, worker_it]( )
+		{
+			run_parallel_worker( worker_it, ranges, task, chunk_size, &worker_exceptions[worker_it] );
+		} ) );
+	}
+
+	run_parallel_worker( 0, ranges, task, chunk_size, &worker_exceptions[0] );
+
+	for( unsigned int i = 0; i < workers.size(); i++ ) { workers[i].join(); }
+
+	for( unsigned int i = 0; i < worker_exceptions.size(); i++ )
+	{
+		if( worker_exceptions[i] != NULL ) { rethrow_exception( worker_exceptions[i] ); }
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Run a two-step task graph over the items:  'parse_task( item_it )' has no dependencies, so all of the parse steps are
+//   spread across the worker threads (see 'parallel_for()'), while 'apply_task( item_it )' depends on that item's parse
+//   step and on the previous item's apply step.  The apply steps therefore run on the calling thread, in item order,
+//   each as soon as its item has been parsed.  Parse steps may only write to state owned by their own item; apply
+//   steps may update shared state.  If a step throws, the parse thread is joined before the exception is rethrown
+void parallel_pipeline( const unsigned int num_items, const TParallel_Task & parse_task, const TParallel_Task & apply_task )
+{
+	if( get_num_worker_threads() <= 1 || num_items <= 1 )
+	{
+		for( unsigned int item_it = 0; item_it < num_items; item_it++ )
+		{
+			parse_task( item_it );
+			apply_task( item_it );
+		}
+
+		return;
+	}
+
+
+	mutex parsed_mutex;
+	condition_variable parsed_cond;
+	vector <bool> parsed( num_items, FALSE );
+	bool parsing_finished = FALSE;
+
+	const TParallel_Task parse_and_signal = [&]( const unsigned int item_it )
+	{
+		parse_task( item_it );
+
+		lock_guard <mutex> parsed_lock( parsed_mutex );
+		parsed[item_it] = TRUE;
+		parsed_cond.notify_all();
+	};
+
+	// The parse steps are run from a thread of their own, so that the calling thread is free to apply the results
+	exception_ptr parse_exception;
+
+	thread parser( run_within_caller_task, TTask_Error_Scope::get_current(), [&]( )
+	{
+		try
+		{
+			parallel_for( num_items, parse_and_signal );
+		}
+		catch( ... )
+		{
+			parse_exception = current_exception();
+		}
+
+		// Wakes the calling thread if an item it is waiting on will never be parsed
+		lock_guard <mutex> parsed_lock( parsed_mutex );
+		parsing_finished = TRUE;
+		parsed_cond.notify_all();
+	} );
+
+	exception_ptr apply_exception;
+
+	try
+	{
+		for( unsigned int item_it = 0; item_it < num_items; item_it++ )
+		{
+			{
+				unique_lock <mutex> parsed_lock( parsed_mutex );
+				while( parsed[item_it] == FALSE && parsing_finished == FALSE ) { parsed_cond.wait( parsed_lock ); }
+
+				if( parsed[item_it] == FALSE ) { break; }
+			}
+
+			apply_task( item_it );
+		}
+	}
+	catch( ... )
+	{
+		apply_exception = current_exception();
+	}
+
+	parser.join();
+
+	if( apply_exception != NULL ) { rethrow_exception( apply_exception ); }
+	if( parse_exception != NULL ) { rethrow_exception( parse_exception ); }
+
+	return;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
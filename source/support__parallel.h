@@ -0,0 +1,210 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__parallel.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the classes and functions used to spread
+//				 independent per-item work across worker threads
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//      E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__PARALLEL_H_
+#define _SUPPORT__PARALLEL_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <algorithm>	// For stable_sort(), merge()
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Processes a single item (identified by its index).  Tasks run concurrently, so each may only write to state owned by
+//   its own item, and may only report errors through 'Errors' from within 'TError_Collector::run_task()' (which
+//   collects them, to be reported after 'parallel_for()' returns).  A loop started from within such a task runs each
+//   of its threads within that task too
+typedef std::function <void( const unsigned int item_it )> TParallel_Task;
+//==============================================================================
+
+
+
+// The items not yet claimed from one worker's share of a 'parallel_for()'.  The owner takes chunks from the front;
+//   idle workers steal the back half
+class TWork_Range
+{
+	private:
+		std::mutex range_mutex;
+		unsigned int next_it;
+		unsigned int end_it;
+
+		// Not copyable (holds a mutex)
+		TWork_Range( const TWork_Range & );
+		TWork_Range & operator=( const TWork_Range & );
+
+	public:
+		void assign( const unsigned int first_it, const unsigned int last_it );
+		bool take_front( const unsigned int grain_size, unsigned int * const first_it, unsigned int * const last_it );
+		bool steal_back( unsigned int * const first_it, unsigned int * const last_it );
+
+		TWork_Range( ) : next_it( 0 ), end_it( 0 ) { }
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+unsigned int get_num_worker_threads( void );
+bool is_within_parallel_task( void );
+
+void parallel_for( const unsigned int num_items, const TParallel_Task & task, const unsigned int grain_size = 1 );
+void parallel_pipeline( const unsigned int num_items, const TParallel_Task & parse_task, const TParallel_Task & apply_task );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// E. Templated (Non-Member) Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// As 'std::stable_sort( items->begin(), items->end(), compare )', spread across the worker threads:  the items are
+//   split into one contiguous run per thread (of at least PARALLEL_SORT_MIN_RUN_SIZE items), each run is sorted with
+//   'std::stable_sort()', and adjacent runs are then merged in pairs (each pass's merges in parallel) until one remains.
+//   'std::merge()' takes equal items from the earlier run first, so the result is stable.  Meant for small items, e.g.
+//   (key, index) pairs, which are copied to a buffer of the same size once
+template <class T_item, class T_compare>
+void parallel_stable_sort( std::vector <T_item> * const items, const T_compare & compare )
+{
+	unsigned int num_runs = items->size() / PARALLEL_SORT_MIN_RUN_SIZE;
+	
+	if( num_runs > get_num_worker_threads() ) { num_runs = get_num_worker_threads(); }
+	
+	if( num_runs <= 1 )
+	{
+		std::stable_sort( items->begin(), items->end(), compare );
+		
+		return;
+	}
+	
+	
+	// Run 'i' is [ run_bounds[i], run_bounds[i + 1] )
+	std::vector <size_t> run_bounds( num_runs + 1 );
+	
+	for( unsigned int run_it = 0; run_it <= num_runs; run_it++ ) { run_bounds[run_it] = (unsigned long long)items->size() * run_it / num_runs; }
+	
+	parallel_for( num_runs, [&]( const unsigned int run_it )
+	{
+		std::stable_sort( items->begin() + run_bounds[run_it], items->begin() + run_bounds[ run_it + 1 ], compare );
+	} );
+	
+	
+	// Each pass merges runs '2 * i' and '2 * i + 1' of 'source' into run 'i' of 'dest' (an odd run out is copied over)
+	std::vector <T_item> buffer( *items );
+	
+	std::vector <T_item> * source = items;
+	std::vector <T_item> * dest   = &buffer;
+	
+	while( run_bounds.size() > 2 )
+	{
+		const unsigned int num_source_runs = run_bounds.size() - 1;
+		const unsigned int num_dest_runs   = ( num_source_runs + 1 ) / 2;
+		
+		parallel_for( num_dest_runs, [&]( const unsigned int dest_run_it )
+		{
+			const size_t first_pos = run_bounds[ 2 * dest_run_it ];
+			const size_t mid_pos   = run_bounds[ 2 * dest_run_it + 1 ];
+			const size_t end_pos   = ( 2 * dest_run_it + 2 <= num_source_runs ) ? run_bounds[ 2 * dest_run_it + 2 ] : mid_pos;
+			
+			std::merge( source->begin() + first_pos, source->begin() + mid_pos,
+						source->begin() + mid_pos, 	 source->begin() + end_pos,
+						dest->begin()   + first_pos, compare );
+		} );
+		
+		
+		std::vector <size_t> dest_run_bounds( num_dest_runs + 1 );
+		
+		for( unsigned int run_it = 0; run_it < num_dest_runs; run_it++ ) { dest_run_bounds[run_it] = run_bounds[ 2 * run_it ]; }
+		dest_run_bounds[num_dest_runs] = run_bounds[num_source_runs];
+		
+		run_bounds.swap( dest_run_bounds );
+		std::swap( source, dest );
+	}
+	
+	if( source != items ) { items->swap( *source ); }
+	
+	return;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__PARALLEL_H_
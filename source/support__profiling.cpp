@@ -0,0 +1,357 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__profiling.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code for timing the stages of the program (wall time, CPU
+//				 time, peak memory, and item counts) and writing the results to a
+//				 trace file
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iomanip>      // For "setprecision()" and "fixed"
+#include <time.h>
+
+#ifdef _WIN32
+	#define PSAPI_VERSION 2		// Resolve 'GetProcessMemoryInfo()' to kernel32 so that psapi needn't be linked
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <sys/time.h>
+	#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__file_io.h"
+#include "support__general.h"
+
+// Header file for this file
+#include "support__profiling.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+TStage_Trace_Log Stage_Trace_Log;			// Stores the timing records of each traced stage of the program
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+TStage_Trace_Log::TStage_Trace_Log( ) :
+	records( 0, TStage_Record( "", "", 0 ) ),
+	trace_start_wall_us( get_wall_time_us() ),
+	curr_depth( 0 )
+{ }
+//------------------------------------------------------------------------------
+
+
+// Called when a stage begins.  Returns the nesting depth of the new stage
+unsigned int TStage_Trace_Log::open_stage( void )
+{
+	return curr_depth++;
+}
+//------------------------------------------------------------------------------
+
+
+void TStage_Trace_Log::close_stage( const TStage_Record & record )
+{
+	if( curr_depth > 0 ) { curr_depth--; }
+
+	records.push_back( record );
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+double TStage_Trace_Log::get_trace_start_wall_us( void ) const
+{
+	return trace_start_wall_us;
+}
+//------------------------------------------------------------------------------
+
+
+int TStage_Trace_Log::write_trace_to_file( const string & path_trace ) const
+{
+	if( records.size() == 0 ) { return SUCCESSFUL; }
+
+
+	// ------------------------------
+	// Assemble the Chrome trace (viewable in 'chrome://tracing' or Perfetto) and the .csv equivalent
+	ostringstream json_oss;
+	ostringstream csv_oss;
+
+	json_oss << fixed << setprecision( 3 );
+	csv_oss  << fixed << setprecision( 3 );
+
+	json_oss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	csv_oss  << "Stage,Category,Depth,Start (ms),Wall Time (ms),CPU Time (ms),Peak RSS (kB),Items\n";
+
+	for( unsigned int i = 0; i < records.size(); i++ )
+	{
+		json_oss << "{\"name\":\"" 		<< format_json_string( records[i].name 	   ) << "\","
+				 << "\"cat\":\"" 		<< format_json_string( records[i].category ) << "\","
+				 << "\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+				 << "\"ts\":" 			<< records[i].start_wall_us 	  << ","
+				 << "\"dur\":" 			<< records[i].wall_ms * 1000.0 	  << ","
+				 << "\"args\":{\"cpu_ms\":" << records[i].cpu_ms 		  << ","
+				 << "\"peak_rss_kb\":" 	<< records[i].peak_rss_kb 		  << ","
+				 << "\"items\":" 		<< records[i].item_count 		  << "}}"
+				 << ( i != records.size() - 1 ? ",\n" : "\n" );
+
+		string csv_name = records[i].name;
+		format_csv_field_with_quotes( &csv_name );
+
+		csv_oss << csv_name 					 << ","
+				<< records[i].category 			 << ","
+				<< records[i].depth 			 << ","
+				<< records[i].start_wall_us / 1000.0 << ","
+				<< records[i].wall_ms 			 << ","
+				<< records[i].cpu_ms 			 << ","
+				<< records[i].peak_rss_kb 		 << ","
+				<< records[i].item_count 		 << "\n";
+	}
+
+	json_oss << "]}\n";
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Write both files, named by the time the program concluded
+	string file_name = format_system_date_time_filesystem_safe( time( NULL ) ) + STAGE_TRACE_FILE_NAME_SUFFIX;
+
+	if( write_file_contents( path_trace, file_name + JSON_FILE_EXTENSION, json_oss.str(), TRUE ) )
+	{
+		return Errors.handle_error( NONFATAL, (string)"Error in 'TStage_Trace_Log::write_trace_to_file()': Trace file could not be written. ", __FILE__, __LINE__ );
+	}
+
+	if( write_file_contents( path_trace, file_name + CSV_FILE_EXTENSION, csv_oss.str(), TRUE ) )
+	{
+		return Errors.handle_error( NONFATAL, (string)"Error in 'TStage_Trace_Log::write_trace_to_file()': Trace .csv could not be written. ", __FILE__, __LINE__ );
+	}
+	// ------------------------------
+
+
+	return SUCCESSFUL;
+}
+//==============================================================================
+
+
+
+TStage_Timer::TStage_Timer( const string & stage_name, const string & category ) :
+	record( stage_name, category, Stage_Trace_Log.open_stage() ),
+	start_cpu_ms( get_process_cpu_time_ms() ),
+	stopped( FALSE )
+{
+	record.start_wall_us = get_wall_time_us() - Stage_Trace_Log.get_trace_start_wall_us();
+}
+//------------------------------------------------------------------------------
+
+
+TStage_Timer::~TStage_Timer( )
+{
+	// Stages left through an early return are still recorded
+	if( stopped == FALSE ) { stop( record.item_count ); }
+}
+//------------------------------------------------------------------------------
+
+
+void TStage_Timer::stop( const unsigned long item_count )
+{
+	if( stopped == TRUE ) { return; }
+
+	double end_wall_us = get_wall_time_us() - Stage_Trace_Log.get_trace_start_wall_us();
+
+	record.wall_ms 	   = ( end_wall_us - record.start_wall_us ) / 1000.0;
+	record.cpu_ms 	   = get_process_cpu_time_ms() - start_cpu_ms;
+	record.peak_rss_kb = get_peak_rss_kb();
+	record.item_count  = item_count;
+
+	Stage_Trace_Log.close_stage( record );
+	stopped = TRUE;
+
+	return;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Monotonic wall clock time, in microseconds from an arbitrary origin
+double get_wall_time_us( void )
+{
+	#ifdef _WIN32
+		LARGE_INTEGER counts;
+		LARGE_INTEGER counts_per_sec;
+
+		QueryPerformanceCounter  ( &counts 		   );
+		QueryPerformanceFrequency( &counts_per_sec );
+
+		return (double)counts.QuadPart * 1000000.0 / (double)counts_per_sec.QuadPart;
+	#else
+		timespec curr_time;
+		clock_gettime( CLOCK_MONOTONIC, &curr_time );
+
+		return (double)curr_time.tv_sec * 1000000.0 + (double)curr_time.tv_nsec / 1000.0;
+	#endif
+}
+//------------------------------------------------------------------------------
+
+
+// CPU time (user + system) consumed by the process so far, in milliseconds
+double get_process_cpu_time_ms( void )
+{
+	#ifdef _WIN32
+		FILETIME creation_time, exit_time, kernel_time, user_time;
+
+		if( GetProcessTimes( GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time ) == 0 ) { return 0; }
+
+		// FILETIME values are in units of 100 ns
+		unsigned long long kernel_100ns = ( (unsigned long long)kernel_time.dwHighDateTime << 32 ) | kernel_time.dwLowDateTime;
+		unsigned long long user_100ns   = ( (unsigned long long)user_time.dwHighDateTime   << 32 ) | user_time.dwLowDateTime;
+
+		return (double)( kernel_100ns + user_100ns ) / 10000.0;
+	#else
+		rusage usage;
+
+		if( getrusage( RUSAGE_SELF, &usage ) != 0 ) { return 0; }
+
+		return ( usage.ru_utime.tv_sec + usage.ru_stime.tv_sec ) * 1000.0 +
+			   ( usage.ru_utime.tv_usec + usage.ru_stime.tv_usec ) / 1000.0;
+	#endif
+}
+//------------------------------------------------------------------------------
+
+
+// Peak resident set size (peak working set on Windows) of the process, in kB
+unsigned long get_peak_rss_kb( void )
+{
+	#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS mem_counters;
+
+		if( GetProcessMemoryInfo( GetCurrentProcess(), &mem_counters, sizeof( mem_counters ) ) == 0 ) { return 0; }
+
+		return mem_counters.PeakWorkingSetSize / 1024;
+	#else
+		rusage usage;
+
+		if( getrusage( RUSAGE_SELF, &usage ) != 0 ) { return 0; }
+
+		#ifdef __APPLE__
+			return usage.ru_maxrss / 1024;		// Reported in bytes on OS X
+		#else
+			return usage.ru_maxrss;				// Reported in kB on Linux
+		#endif
+	#endif
+}
+//==============================================================================
+
+
+
+// Escape the characters that can't appear unescaped within a JSON string
+string format_json_string( const string & str_to_format )
+{
+	string formatted_str = "";
+	formatted_str.reserve( str_to_format.size() );
+
+	for( unsigned int i = 0; i < str_to_format.size(); i++ )
+	{
+		switch( str_to_format[i] )
+		{
+			case '"'  : formatted_str += "\\\"";
+						break;
+
+			case '\\' : formatted_str += "\\\\";
+						break;
+
+			case '\n' : formatted_str += "\\n";
+						break;
+
+			case '\t' : formatted_str += "\\t";
+						break;
+
+			default   : formatted_str += str_to_format[i];
+						break;
+		}
+	}
+
+	return formatted_str;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
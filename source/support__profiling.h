@@ -0,0 +1,192 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : support__profiling.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring classes and functions used to time the
+//				 stages of the program and write the results to a trace file
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//      C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef _SUPPORT__PROFILING_H_
+#define _SUPPORT__PROFILING_H_
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+
+
+// Stage tracing macros.  When 'ENABLE_STAGE_TRACING' is not defined (see "defs__appl_parameters.h"), these expand to
+//   nothing, so neither the timer nor its arguments are evaluated
+#ifdef ENABLE_STAGE_TRACING
+	#define TRACE_STAGE_BEGIN( timer, stage_name, category ) 	TStage_Timer timer( stage_name, category )
+	#define TRACE_STAGE_END( timer, item_count )  				timer.stop( item_count )
+	#define WRITE_STAGE_TRACE( path_trace ) 					Stage_Trace_Log.write_trace_to_file( path_trace )
+#else
+	#define TRACE_STAGE_BEGIN( timer, stage_name, category )
+	#define TRACE_STAGE_END( timer, item_count )
+	#define WRITE_STAGE_TRACE( path_trace )
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Holds the measurements taken for a single timed stage
+class TStage_Record
+{
+	public:
+		std::string name;
+		std::string category;
+		unsigned int depth;			// Nesting level of the stage (0 for stages not enclosed by another timed stage)
+		double start_wall_us;		// Start time relative to the start of the trace
+		double wall_ms;
+		double cpu_ms;
+		unsigned long peak_rss_kb;	// Peak resident set size of the process at the end of the stage
+		unsigned long item_count;	// Number of items (e.g. ORFs, rows) produced or processed by the stage
+
+		TStage_Record( const std::string & stage_name, const std::string & stage_category, const unsigned int stage_depth ) :
+			name( stage_name ),
+			category( stage_category ),
+			depth( stage_depth ),
+			start_wall_us( 0 ),
+			wall_ms( 0 ),
+			cpu_ms( 0 ),
+			peak_rss_kb( 0 ),
+			item_count( 0 )
+		{ }
+};
+//==============================================================================
+
+
+
+// Stores the records of every timed stage and writes them to Chrome trace (.json) and .csv files
+class TStage_Trace_Log
+{
+	private:
+		std::vector <TStage_Record> records;
+		double trace_start_wall_us;
+		unsigned int curr_depth;
+
+	public:
+		unsigned int open_stage( void );
+		void close_stage( const TStage_Record & record );
+		double get_trace_start_wall_us( void ) const;
+
+		int write_trace_to_file( const std::string & path_trace ) const;
+
+		TStage_Trace_Log( );
+};
+//==============================================================================
+
+
+
+// Scoped timer.  Timing begins at construction and ends at 'stop()' or when the timer goes out of scope,
+//   whichever comes first
+class TStage_Timer
+{
+	private:
+		TStage_Record record;
+		double start_cpu_ms;
+		bool stopped;
+
+		// Not copyable (a copy would record the stage twice)
+		TStage_Timer( const TStage_Timer & );
+		TStage_Timer & operator=( const TStage_Timer & );
+
+	public:
+		void stop( const unsigned long item_count = 0 );
+
+		TStage_Timer( const std::string & stage_name, const std::string & category );
+		~TStage_Timer( );
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TStage_Trace_Log Stage_Trace_Log;
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+double get_wall_time_us( void );
+double get_process_cpu_time_ms( void );
+unsigned long get_peak_rss_kb( void );
+
+std::string format_json_string( const std::string & str_to_format );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // _SUPPORT__PROFILING_H_
@@ -41,7 +41,6 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <windows.h>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -59,6 +58,9 @@ using namespace std;
 #include "support__general.h"
 #include "support__bioinformatics.h"
 #include "uORF__process.h"
+#include "support__profiling.h"
+#include "support__parallel.h"
+#include "support__compressed_io.h"
 
 // Header file for this file
 #include "uORF__compile.h"
@@ -83,9 +85,6 @@ bool 					  TCalculate_AUGCAI::AUGCAI_weight_matrix_init = FALSE;
 
 // vector <string> GO_terms_not_found( 0, "" );
 
-int max_upstream = 5080;
-int min_downstream = -2323;
-
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -100,14 +99,14 @@ int min_downstream = -2323;
 
 //==============================================================================
 
-string TData_Source::get_author( void ) const
+TInterned_String TData_Source::get_author( void ) const
 {
 	return author;
 }
 //------------------------------------------------------------------------------
 
 
-string TData_Source::get_evidence( void ) const
+TInterned_String TData_Source::get_evidence( void ) const
 {
 	return evidence_type;
 }
@@ -116,15 +115,15 @@ string TData_Source::get_evidence( void ) const
 		
 TData_Source::TData_Source( const string & paper_author ) : author( paper_author )
 {
-	if	   ( author == DATA_SOURCE_MIURA			  ) { evidence_type = EVIDENCE_TYPE_MIURA; 				}
-	else if( author == DATA_SOURCE_INGOLIA			  ) { evidence_type = EVIDENCE_TYPE_INGOLIA; 			}
-	else if( author == DATA_SOURCE_ZHANG_DIETRICH_NAR ) { evidence_type = EVIDENCE_TYPE_ZHANG_DIETRICH_NAR; }
-	else if( author == DATA_SOURCE_ZHANG_DIETRICH_CG  ) { evidence_type = EVIDENCE_TYPE_ZHANG_DIETRICH_CG;  }
-	else if( author == DATA_SOURCE_NAGALAKSHMI		  ) { evidence_type = EVIDENCE_TYPE_NAGALAKSHMI; 		}
-	else if( author == DATA_SOURCE_CVIJOVIC			  ) { evidence_type = EVIDENCE_TYPE_CVIJOVIC; 			}
-	else if( author == DATA_SOURCE_GUAN				  ) { evidence_type = EVIDENCE_TYPE_GUAN;			 	}
-	else if( author == DATA_SOURCE_LAWLESS			  ) { evidence_type = EVIDENCE_TYPE_LAWLESS; 			}
-	else if( author == DATA_SOURCE_SELPI			  ) { evidence_type = EVIDENCE_TYPE_SELPI; 				}
+	if	   ( paper_author == DATA_SOURCE_MIURA			  ) { evidence_type = EVIDENCE_TYPE_MIURA; 				}
+	else if( paper_author == DATA_SOURCE_INGOLIA			  ) { evidence_type = EVIDENCE_TYPE_INGOLIA; 			}
+	else if( paper_author == DATA_SOURCE_ZHANG_DIETRICH_NAR ) { evidence_type = EVIDENCE_TYPE_ZHANG_DIETRICH_NAR; }
+	else if( paper_author == DATA_SOURCE_ZHANG_DIETRICH_CG  ) { evidence_type = EVIDENCE_TYPE_ZHANG_DIETRICH_CG;  }
+	else if( paper_author == DATA_SOURCE_NAGALAKSHMI		  ) { evidence_type = EVIDENCE_TYPE_NAGALAKSHMI; 		}
+	else if( paper_author == DATA_SOURCE_CVIJOVIC			  ) { evidence_type = EVIDENCE_TYPE_CVIJOVIC; 			}
+	else if( paper_author == DATA_SOURCE_GUAN				  ) { evidence_type = EVIDENCE_TYPE_GUAN;			 	}
+	else if( paper_author == DATA_SOURCE_LAWLESS			  ) { evidence_type = EVIDENCE_TYPE_LAWLESS; 			}
+	else if( paper_author == DATA_SOURCE_SELPI			  ) { evidence_type = EVIDENCE_TYPE_SELPI; 				}
 	else 
 	{
 		Errors.handle_error( FATAL, "Error in 'TData_Source::TData_Source()': Paper author not recognized. ", __FILE__, __LINE__ );
@@ -207,7 +206,7 @@ TuORF_Data::TuORF_Data( const string uORF_content,
 	content( uORF_content ),
 	start_context( uORF_start_context ),
 	ext_start_context( uORF_ext_start_context ),
-	context_profile( vector<unsigned int>( 0 ) ),
+	context_profile_row( -1 ),
 	rel_uORF_pos( relative_uORF_pos ),
 	start_pos( uORF_start_pos ),
 	len( uORF_len ),
@@ -251,7 +250,7 @@ TuORF_Data::TuORF_Data( const unsigned int uORF_start_pos ) :
 		
 		
 				
-vector <TuORF_Data> TORF_Data::get_uORFs( void ) const
+const vector <TuORF_Data> & TORF_Data::get_uORFs( void ) const
 {
 	return uORFs;
 }
@@ -296,7 +295,7 @@ void TORF_Data::add_uORF( const TuORF_Data uORF )
 int TORF_Data::extract_uORF( const int exp_rel_uORF_pos,
 							 const unsigned int exp_uORF_len,
 							 const string & exp_start_codon,
-							 const string & chrom_seq,
+							 const TPacked_Chrom & chrom_seq,
 							 const string & data_source,
 							 unsigned int * const num_realigned_uORFs,
 							 unsigned int * const num_misaligned_uORFs,
@@ -353,7 +352,8 @@ int TORF_Data::extract_uORF( const int exp_rel_uORF_pos,
 	if	  ( opposite_strand == FALSE )  { uORF_start_pos = uORF_first_coord_in_chrom_it + 1; }
 	else/*( opposite_strand == TRUE )*/ { uORF_start_pos = uORF_last_coord_in_chrom_it  + 1; }
 	
-	uORF_content = extract_DNA_seq( chrom_seq, uORF_start_pos, uORF_len,  opposite_strand, untransl_reg );
+	uORF_content.resize( uORF_len );
+	uORF_content.resize( exon_map.extract( chrom_seq, uORF_start_pos, uORF_len, &uORF_content[0] ) );
 
 	if( exp_start_codon.size() != 3 )
 	{
@@ -389,9 +389,6 @@ int TORF_Data::extract_uORF( const int exp_rel_uORF_pos,
 	
 	// ------------------------------
 	// Extract the start codon context, find the stop codon, get uORF characteristics
-	vector <TFeature> untransl_reg_all = untransl_reg;
-	if( fpUTR_intron.start_coord != string::npos ) { untransl_reg_all.insert( untransl_reg_all.begin(), fpUTR_intron ); }
-	
 	if( uORF_analysis( chrom_seq,
 					   gene_name,
 					   gene_CDS.start_coord,
@@ -399,7 +396,7 @@ int TORF_Data::extract_uORF( const int exp_rel_uORF_pos,
 					   start_codon_found,
 					   rel_uORF_pos,
 					   uORF_first_coord_in_chrom_it,
-					   untransl_reg_all,
+					   exon_map_w_fpUTR_intron,
 					   &uORF_content,
 					   &uORF_start_context,
 					   &ext_uORF_start_context,
@@ -464,7 +461,7 @@ int TORF_Data::extract_uORF( const int exp_rel_uORF_pos,
 //------------------------------------------------------------------------------
 
 
-void TORF_Data::add_GO_Annotation( const string & name_space, const string & term, const string & evidence, const vector <TGO_Annotation > & All_GO_Annotations )
+void TORF_Data::add_GO_Annotation( const string & name_space, const TInterned_String & term, const TInterned_String & evidence, const vector <TGO_Annotation > & All_GO_Annotations )
 {
 	unsigned int GO_namespace_it = 0;
 	
@@ -537,6 +534,17 @@ void TORF_Data::add_GO_Annotation( const string & name_space, const string & ter
 			}
 			
 			
+			// Look up the term's parents before changing anything, so an error in the hierarchy leaves this ORF's
+			//   annotations as they were (and, with 'TASK_ERROR_SKIP', only the row is skipped)
+			const bool add_parent_terms = ( parent_term_already_added == FALSE && All_GO_Annotations[ GO_namespace_it ].GO_Terms[GO_term_it].level != 1 );
+			vector <TGO_Term> all_parent_terms;
+			
+			if( add_parent_terms == TRUE )
+			{
+				all_parent_terms = get_all_parents_of( term, All_GO_Annotations[ GO_namespace_it ] );
+			}
+			
+			
 			vector <TGO_Term>::iterator new_GO_it = 
 			GO_Annotations[GO_namespace_it].GO_Terms.insert( curr_GO_it, TGO_Term( term, 
 																				   evidence, 
@@ -551,9 +559,8 @@ void TORF_Data::add_GO_Annotation( const string & name_space, const string & ter
 			}
 			
 			
-			if( parent_term_already_added == FALSE && All_GO_Annotations[ GO_namespace_it ].GO_Terms[GO_term_it].level != 1 )
+			if( add_parent_terms == TRUE )
 			{
-				vector <TGO_Term> all_parent_terms = get_all_parents_of( term, All_GO_Annotations[ GO_namespace_it ] );
 				unsigned int parent_term_it = 0;
 				
 				do
@@ -706,14 +713,14 @@ void TORF_Data::update_source( const unsigned int uORF_it, vector <TData_Source>
 //------------------------------------------------------------------------------
 
 
-void TORF_Data::update_context_profile( const unsigned int uORF_it, vector<unsigned int> new_context_profile )
+void TORF_Data::update_context_profile_row( const unsigned int uORF_it, const int new_context_profile_row )
 {
 	if (uORF_it >= uORFs.size())
 	{
-		Errors.handle_error( FATAL, "Error in 'TORF_Data::update_context_profile()': The uORF that was attempted to be modified does not exist. ", __FILE__, __LINE__ );
+		Errors.handle_error( FATAL, "Error in 'TORF_Data::update_context_profile_row()': The uORF that was attempted to be modified does not exist. ", __FILE__, __LINE__ );
 	}
 
-	uORFs[uORF_it].context_profile = new_context_profile;
+	uORFs[uORF_it].context_profile_row = new_context_profile_row;
 
 	return;
 }
@@ -863,7 +870,7 @@ void TORF_Data::check_uORF_upstream_of_tss( void )
 //------------------------------------------------------------------------------
 
 
-void TORF_Data::get_CDI( const std::vector <unsigned int> TL_read_positions, const std::vector <double> TL_read_densities )
+void TORF_Data::get_CDI( const std::vector <unsigned int> & TL_read_positions, const std::vector <double> & TL_read_densities )
 {
 	unsigned int intergen_start_it = 0;
 
@@ -949,66 +956,60 @@ void TORF_Data::get_CDI( const std::vector <unsigned int> TL_read_positions, con
 	
 	
 	
+	// The TL reads and TSS's, as weighted events.  Reads are placed by genome coordinate (negated on the Crick strand) and
+	//   TSS's by position relative to the ORF, so the distance from either to a uORF's cap is 'uORF coord - event coord'
+	vector <pair <int, double> > TL_read_events( 0 );
+	vector <pair <int, double> > TSS_events( 0 );
+
+	if( abs( total_intergenic_reads ) >= 30 )
+	{
+		for( unsigned int i = intergen_start_it; i <= intergen_end_it; i++ )
+		{
+			if( ( opposite_strand == FALSE && TL_read_densities[i] > 0 ) || ( opposite_strand == TRUE && TL_read_densities[i] < 0 ) )
+			{
+				int read_coord = ( opposite_strand == FALSE ) ? (int)TL_read_positions[i] : (-1) * (int)TL_read_positions[i];
+				TL_read_events.push_back( make_pair( read_coord, TL_read_densities[i] / total_intergenic_reads ) );
+			}
+		}
+	}
+
+	for( unsigned int i = 0; i < tss_rel_pos.size(); i++ )
+	{
+		TSS_events.push_back( make_pair( tss_rel_pos[i], 1.0 / tss_rel_pos.size() ) );
+	}
+
+	const TTSS_Profile TL_read_profile( TL_read_events );
+	const TTSS_Profile TSS_profile	  ( TSS_events 	   );
+
+
+
 	// Add a dummy uORF in order to easily calculate the average TSS position relative to the ORF
 	uORFs.push_back( TuORF_Data( gene_CDS.start_coord ) );
 	
+	const TInterned_String ingolia_author( "Ingolia" );
+	
 	for( unsigned int uORF_it = 0; uORF_it < uORFs.size(); uORF_it++ )
 	{
 		bool ingolia_uORF = FALSE;
-		vector <double> TSS_distribution( max_upstream - min_downstream + 1, 0 );
-		uORFs[uORF_it].prop_transcripts_incl = 0;
 
 		for( unsigned int i = 0; i < uORFs[uORF_it].source.size(); i++ )
 		{
-			if( uORFs[uORF_it].source[i].get_author() == "Ingolia" ) { ingolia_uORF = TRUE; }
+			if( uORFs[uORF_it].source[i].get_author() == ingolia_author ) { ingolia_uORF = TRUE; }
 		}
 
 
-		uORFs[uORF_it].cap_distance_index = 0;
+		const int uORF_read_coord = ( opposite_strand == FALSE ) ? (int)uORFs[uORF_it].start_pos : (-1) * (int)uORFs[uORF_it].start_pos;
+		const int uORF_TSS_coord  = uORFs[uORF_it].rel_uORF_pos;
 		
-		double TL_reads_component = 0;
-		double TSS_pos_component  = 0;
 		
+		// Calculate the TL reads and TSS position components for the CDI:  transcripts capped more than 19 nt upstream of
+		//   the uORF count fully, and those capped 12-19 nt upstream count partially
+		double TL_reads_component = TL_read_profile.get_weight( uORF_read_coord, 20 ) + 
+									( TL_read_profile.get_weighted_distance( uORF_read_coord, 12, 19 ) - 11 * TL_read_profile.get_weight( uORF_read_coord, 12, 19 ) ) / 9.0;
 		
-		// Calculate the TL reads component for the CDI
-		if( abs( total_intergenic_reads ) >= 30 )
-		{
-			for( unsigned int i = intergen_start_it; i <= intergen_end_it; i++ )
-			{
-				if( ( opposite_strand == FALSE && TL_read_densities[i] > 0 ) || ( opposite_strand == TRUE && TL_read_densities[i] < 0 ) )
-				{
-					int distance_to_cap = uORFs[uORF_it].start_pos - TL_read_positions[i];
-					if( opposite_strand == TRUE ) { distance_to_cap *= (-1); }
-					
-					if     ( distance_to_cap > 19 						   ) { TL_reads_component += 							      ( TL_read_densities[i] / total_intergenic_reads ); }
-					else if( distance_to_cap > 11 && distance_to_cap <= 19 ) { TL_reads_component += ( distance_to_cap - 11 ) / 9.0 * ( TL_read_densities[i] / total_intergenic_reads ); }
-					
-					//if( distance_to_cap > max_upstream   ) { max_upstream   = distance_to_cap; }
-					//if( distance_to_cap < min_downstream ) { min_downstream = distance_to_cap; }
-					
-					TSS_distribution[max_upstream - distance_to_cap]     			  += TL_read_densities[i] / total_intergenic_reads * TL_reads_weight;
-					if( distance_to_cap >= 0 ) { uORFs[uORF_it].prop_transcripts_incl += TL_read_densities[i] / total_intergenic_reads * TL_reads_weight; }
-				}
-			}
-		}
-		
-
-		// Calculate the TSS position component for the CDI
-		for( unsigned int i = 0; i < tss_rel_pos.size(); i++ )
-		{
-			int distance_to_cap = uORFs[uORF_it].rel_uORF_pos - tss_rel_pos[i];
-
-			if     ( distance_to_cap > 19 						   ) { TSS_pos_component += 							     ( 1.0 / tss_rel_pos.size() ); }
-			else if( distance_to_cap > 11 && distance_to_cap <= 19 ) { TSS_pos_component += ( distance_to_cap - 11 ) / 9.0 * ( 1.0 / tss_rel_pos.size() ); }
-			
-			//if( distance_to_cap > max_upstream   ) { max_upstream   = distance_to_cap; }
-			//if( distance_to_cap < min_downstream ) { min_downstream = distance_to_cap; }
-			
-			TSS_distribution[max_upstream - distance_to_cap]      			  += 1.0 / tss_rel_pos.size() * ( 1 - TL_reads_weight );
-			if( distance_to_cap >= 0 ) { uORFs[uORF_it].prop_transcripts_incl += 1.0 / tss_rel_pos.size() * ( 1 - TL_reads_weight ); }
-		} 
+		double TSS_pos_component  = TSS_profile.get_weight( uORF_TSS_coord, 20 ) + 
+									( TSS_profile.get_weighted_distance( uORF_TSS_coord, 12, 19 ) - 11 * TSS_profile.get_weight( uORF_TSS_coord, 12, 19 ) ) / 9.0;
 		
-
 		
 		// Note: better correlation between CDI and Translation likelihood if these are included (presumably because of TSS's still contributing,
 		// even if less than 3
@@ -1025,12 +1026,12 @@ void TORF_Data::get_CDI( const std::vector <unsigned int> TL_read_positions, con
 		if( TL_reads_weight == 0 && tss_rel_pos.size() < 3 ) { uORFs[uORF_it].cap_distance_index = -1; }
 		
 		
-		// Also calculate the average TL length 
-		uORFs[uORF_it].avg_cap_dist = 0;
-		for( unsigned int i = 0; i < max_upstream /*TSS_distribution.size()*/; i++ )
-		{
-			uORFs[uORF_it].avg_cap_dist += TSS_distribution[i] * (max_upstream - i) / uORFs[uORF_it].prop_transcripts_incl;
-		}
+		// Also calculate the proportion of transcripts that include the uORF, and their average TL length
+		uORFs[uORF_it].prop_transcripts_incl = TL_read_profile.get_weight( uORF_read_coord, 0 ) * TL_reads_weight + 
+											   TSS_profile	  .get_weight( uORF_TSS_coord,  0 ) * ( 1 - TL_reads_weight );
+		
+		uORFs[uORF_it].avg_cap_dist = ( TL_read_profile.get_weighted_distance( uORF_read_coord, 1 ) * TL_reads_weight + 
+										TSS_profile	   .get_weighted_distance( uORF_TSS_coord,  1 ) * ( 1 - TL_reads_weight ) ) / uORFs[uORF_it].prop_transcripts_incl;
 
 		
 		if( /*abs( total_intergenic_reads ) < 30*/ TL_reads_weight == 0 && tss_rel_pos.size() < 3 ) 
@@ -1045,23 +1046,12 @@ void TORF_Data::get_CDI( const std::vector <unsigned int> TL_read_positions, con
 		}
 		
 
-		if( /*gene_name == "YGR148C"*/ingolia_uORF == TRUE ) { cout /*<< "gene: " */<< gene_name << /*"	uORF " */"	" << uORFs[uORF_it].start_pos  << "	" << TL_reads_component << "	" << TSS_pos_component/*<< "	CDI: " << uORFs[uORF_it].cap_distance_index*/ << /*"	total_intergenic_reads: " */"	" << (double)abs( total_intergenic_reads ) << "	" << tss_rel_pos.size() << /*"	TL reads weight: " */"	"  << uORFs[uORF_it].avg_cap_dist << "	" << uORFs[uORF_it].prop_transcripts_incl << endl; }
-		
-		// Output all TSS/TL weights
-		// if( /*gene_name == "YGR148C"*/ingolia_uORF == TRUE && uORFs[uORF_it].cap_distance_index != -1 /*abs( total_intergenic_reads ) >= 30*/ && proportion_TSS_downstream < .2 ) 
-		// { 
-			// ostringstream temp_oss;
-			// temp_oss /*<< "gene: " */<< gene_name << /*"	uORF " */"	" << uORFs[uORF_it].start_pos  << "	";
-			
-			// for( int i = 3606; i >= -931; i-- )
-			// {
-				// temp_oss << TSS_distribution[max_upstream - i] << "	"; 
-			// }
-			
-			// output_text_line( temp_oss.str() );
-		// }
-		
-		//cout << "max: " << max_upstream << "	min: " << min_downstream << endl;
+		if( /*gene_name == "YGR148C"*/ingolia_uORF == TRUE )
+		{
+			ostringstream CDI_oss;
+			CDI_oss /*<< "gene: " */<< gene_name << /*"	uORF " */"	" << uORFs[uORF_it].start_pos  << "	" << TL_reads_component << "	" << TSS_pos_component/*<< "	CDI: " << uORFs[uORF_it].cap_distance_index*/ << /*"	total_intergenic_reads: " */"	" << (double)abs( total_intergenic_reads ) << "	" << tss_rel_pos.size() << /*"	TL reads weight: " */"	"  << uORFs[uORF_it].avg_cap_dist << "	" << uORFs[uORF_it].prop_transcripts_incl;
+			output_text_line( CDI_oss.str(), LOG_LEVEL_DEBUG );
+		}
 	} 
 
 	avg_TSS_rel_pos = ( uORFs.back().avg_cap_dist != DEFAULT_DISTANCE_TO_TSS ) ? (-1) * uORFs.back().avg_cap_dist : DEFAULT_TSS_REL_POS;
@@ -1120,7 +1110,7 @@ unsigned int TORF_Data::find_uORF( const int uORF_rel_pos ) const
 //------------------------------------------------------------------------------
 
 
-unsigned int TORF_Data::find_GO_term( const int GO_namespace_it, const string & term, const bool search_parent_terms ) const
+unsigned int TORF_Data::find_GO_term( const int GO_namespace_it, const TInterned_String & term, const bool search_parent_terms ) const
 {
 	unsigned int r_GO_term_it = 0;
 	bool GO_term_found = FALSE;
@@ -1129,7 +1119,7 @@ unsigned int TORF_Data::find_GO_term( const int GO_namespace_it, const string &
 	{
 		if( GO_Annotations[GO_namespace_it].GO_Terms[r_GO_term_it].name == term )
 		{
-			if( search_parent_terms == TRUE || GO_Annotations[GO_namespace_it].GO_Terms[r_GO_term_it].evidence != "" )
+			if( search_parent_terms == TRUE || GO_Annotations[GO_namespace_it].GO_Terms[r_GO_term_it].evidence.empty() == FALSE )
 			{
 				GO_term_found = TRUE;
 			}
@@ -1150,19 +1140,9 @@ unsigned int TORF_Data::find_GO_term( const int GO_namespace_it, const string &
 //------------------------------------------------------------------------------
 
 
-bool TORF_Data::is_GO_term_present( const int GO_namespace_it, const string & term, const bool search_parent_terms ) const
+bool TORF_Data::is_GO_term_present( const int GO_namespace_it, const TInterned_String & term, const bool search_parent_terms ) const
 {
-	vector <string> GO_terms_to_search( 0 );
-	
-	for( unsigned int i = 0; i < GO_Annotations[GO_namespace_it].GO_Terms.size(); i++ )
-	{
-		if( search_parent_terms == TRUE || GO_Annotations[GO_namespace_it].GO_Terms[i].evidence != "" )
-		{
-			GO_terms_to_search.push_back( GO_Annotations[GO_namespace_it].GO_Terms[i].name );
-		}
-	}
-	
-	return ( ( find( GO_terms_to_search.begin(), GO_terms_to_search.end(), term ) == GO_terms_to_search.end() ) ? FALSE : TRUE );
+	return ( ( find_GO_term( GO_namespace_it, term, search_parent_terms ) == GO_Annotations[GO_namespace_it].GO_Terms.size() ) ? FALSE : TRUE );
 }
 //------------------------------------------------------------------------------
 
@@ -1571,7 +1551,7 @@ vector <vector <string> > TORF_Data::form_vector_for_csv_rows( const vector <Ten
 			// ------------------------------
 			if( curr_col_it < col_to_write.size() && col_to_write[curr_col_it] == uORF_CSV_COL_NUM_NUM_uORFs )
 			{
-				csv_rows.back()[curr_col_it] = get_str( uORFs.size() );
+				csv_rows.back()[curr_col_it] = get_str( (unsigned int)uORFs.size() );
 				curr_col_it++;
 			}
 			// ------------------------------
@@ -1882,7 +1862,7 @@ bool TORF_Data::compare_uORFs::operator()( const TuORF_Data & uORF_1, const TuOR
 //------------------------------------------------------------------------------
 
 
-int TORF_Data::get_gene_start_context( const string & chrom_seq )
+int TORF_Data::get_gene_start_context( const TPacked_Chrom & chrom_seq )
 {
 	if( gene_CDS.start_coord > chrom_seq.size() )
 	{ 
@@ -1992,20 +1972,18 @@ int TORF_Data::get_gene_start_context( const string & chrom_seq )
 		ext_start_context_start_it = gene_start_it - EXT_START_CONTEXT_NT_AFTER_AUG;	
 	}
 	
-	ext_gene_start_context = chrom_seq.substr( ext_start_context_start_it, EXT_START_CONTEXT_LENGTH_NT );
+	ext_gene_start_context = chrom_seq.get_seq( ext_start_context_start_it, EXT_START_CONTEXT_LENGTH_NT, opposite_strand );
 	// ------------------------------
 	
 	
 	
 	// ------------------------------
-	// If on the Crick strand, obtain that strand from the known corresponding Watson strand
+	// If on the Crick strand, obtain that strand from the known corresponding Watson strand (the extended context was
+	//   read from the Crick strand directly)
 	if( opposite_strand == TRUE )
 	{
 		gene_start_context	   = get_inverted_sequence( gene_start_context 	   );
 		gene_start_context	   = get_opposite_strand  ( gene_start_context 	   );
-		
-		ext_gene_start_context = get_inverted_sequence( ext_gene_start_context );
-		ext_gene_start_context = get_opposite_strand  ( ext_gene_start_context );
 	}
 	// ------------------------------
 	
@@ -2056,6 +2034,7 @@ TORF_Data::TORF_Data( const unsigned int chr_num,
 	TL_shape_index( DEFAULT_SHAPE_INDEX ),
 	untransl_reg( untrans ),
 	fpUTR_intron( fpUTR_in ),
+	exon_map( untrans, strand ),
 	CDS_rib_rpkM( CDS_rib ),
 	CDS_mRNA_rpkM( DEFAULT_CDS_mRNA_RPKM ),
 	transl_corr( DEFAULT_CORRELATION ),
@@ -2082,14 +2061,176 @@ TORF_Data::TORF_Data( const unsigned int chr_num,
 	matches_GO_term( FALSE )
 	
 { 
+	vector <TFeature> untransl_reg_all = untransl_reg;
+	if( fpUTR_intron.start_coord != (unsigned int)string::npos ) { untransl_reg_all.insert( untransl_reg_all.begin(), fpUTR_intron ); }
+	
+	exon_map_w_fpUTR_intron = TExon_Map( untransl_reg_all, opposite_strand );
+	
+	
 	GO_Annotations.resize( NUM_GO_NAMESPACES, TGO_Annotation( "" ) );
 
 	GO_Annotations[GO_BIO_PROC_IT]  = TGO_Annotation( GO_BIO_PROC_ID  );
 	GO_Annotations[GO_CELL_COMP_IT] = TGO_Annotation( GO_CELL_COMP_ID );
 	GO_Annotations[GO_MOL_FUNC_IT]  = TGO_Annotation( GO_MOL_FUNC_ID  );
 }
+//==============================================================================
+
+
+
+TDataset_Loader::TDataset_Loader( const string & loader_name, const string & data_file_name, const TCSV_Loader loader ) :
+	name		 ( loader_name    ),
+	file_name	 ( data_file_name ),
+	csv_contents ( PATH_DATA_FOLDER, data_file_name ),
+	text_contents( "" 			  ),
+	num_records  ( 0 				  ),
+	csv_loader	 ( loader 		  ),
+	text_loader	 ( NULL 		  ),
+	stream_loader( NULL 		  )
+{ }
+//------------------------------------------------------------------------------
+
+
+TDataset_Loader::TDataset_Loader( const string & loader_name, const string & data_file_name, const TText_Loader loader ) :
+	name		 ( loader_name    ),
+	file_name	 ( data_file_name ),
+	csv_contents ( PATH_DATA_FOLDER, data_file_name ),
+	text_contents( "" 			  ),
+	num_records  ( 0 				  ),
+	csv_loader	 ( NULL 		  ),
+	text_loader	 ( loader 		  ),
+	stream_loader( NULL 		  )
+{ }
+//------------------------------------------------------------------------------
+
+
+TDataset_Loader::TDataset_Loader( const string & loader_name, const string & data_file_name, const TStream_Loader loader ) :
+	name		 ( loader_name    ),
+	file_name	 ( data_file_name ),
+	csv_contents ( PATH_DATA_FOLDER, data_file_name ),
+	text_contents( "" 			  ),
+	num_records  ( 0 				  ),
+	csv_loader	 ( NULL 		  ),
+	text_loader	 ( NULL 		  ),
+	stream_loader( loader 		  )
+{ }
+//------------------------------------------------------------------------------
+
+
+// Read in (and, for CSV files, parse) the dataset's file.  Safe to call concurrently for different loaders.  Streamed
+//   datasets are read by 'apply()' instead
+void TDataset_Loader::parse( void )
+{
+	if( csv_loader != NULL )
+	{
+		csv_contents.parse_csv();
+	}
+	else if( text_loader != NULL )
+	{
+		if( read_entire_file_contents( PATH_DATA_FOLDER, file_name, &text_contents ) )
+		{
+			Errors.handle_error( FATAL, (string)"Error in 'TDataset_Loader::parse()': Error reading '" + file_name + "' contents. ", __FILE__, __LINE__ );
+		}
+	}
+
+	return;
+}
 //------------------------------------------------------------------------------
 
+
+// Add the parsed dataset to the ORFs ('parse()' must have been called first), then release the parsed contents
+//   (keeping only the number of records, i.e. rows or lines, that the dataset had)
+void TDataset_Loader::apply( vector <TORF_Data> * const ORF_Data )
+{
+	if	  ( csv_loader  != NULL )
+	{
+		csv_loader( csv_contents, ORF_Data );
+		
+		num_records = csv_contents.get_num_rows();
+		csv_contents.clear();
+	}
+	else if( text_loader != NULL )
+	{
+		text_loader( text_contents, ORF_Data );
+		
+		num_records = (unsigned int)count( text_contents.begin(), text_contents.end(), '\n' );
+		string().swap( text_contents );
+	}
+	else/*( stream_loader != NULL )*/
+	{
+		num_records = stream_loader( PATH_DATA_FOLDER, file_name, ORF_Data );
+	}
+
+	return;
+}
+//==============================================================================
+
+
+
+TTSS_Profile::TTSS_Profile( vector <pair <int, double> > events ) :
+	coord	  ( events.size(), 0 ),
+	weight_sum( events.size() + 1, 0 ),
+	coord_sum ( events.size() + 1, 0 ),
+	base_coord( 0 )
+{
+	sort( events.begin(), events.end() );
+
+	// Coordinates are stored relative to the first event, so the running sums stay small and precise
+	if( events.empty() == FALSE ) { base_coord = events[0].first; }
+
+	for( unsigned int i = 0; i < events.size(); i++ )
+	{
+		coord[i] = events[i].first - base_coord;
+
+		weight_sum[i + 1] = weight_sum[i] + events[i].second;
+		coord_sum [i + 1] = coord_sum [i] + events[i].second * coord[i];
+	}
+}
+//------------------------------------------------------------------------------
+
+
+// Events [*first_it, *last_it) are those between 'min_dist' and 'max_dist' (inclusive) from 'pos'
+void TTSS_Profile::get_event_range( const int pos, const int min_dist, const int max_dist, unsigned int * const first_it, unsigned int * const last_it ) const
+{
+	// Distances shrink as coordinates grow, so the nearest allowed event has the largest coordinate
+	long long first_coord = (long long)pos - base_coord - max_dist;
+	long long last_coord  = (long long)pos - base_coord - min_dist;
+
+	if( first_coord < INT_MIN ) { first_coord = INT_MIN; }
+	if( last_coord  > INT_MAX ) { last_coord  = INT_MAX; }
+
+	*first_it = lower_bound( coord.begin(), coord.end(), (int)first_coord ) - coord.begin();
+	*last_it  = ( last_coord < INT_MIN ) ? 0 : upper_bound( coord.begin(), coord.end(), (int)last_coord ) - coord.begin();
+
+	if( *last_it < *first_it ) { *last_it = *first_it; }
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Total weight of the events between 'min_dist' and 'max_dist' (inclusive) from 'pos'
+double TTSS_Profile::get_weight( const int pos, const int min_dist, const int max_dist ) const
+{
+	unsigned int first_it = 0;
+	unsigned int last_it  = 0;
+
+	get_event_range( pos, min_dist, max_dist, &first_it, &last_it );
+
+	return weight_sum[last_it] - weight_sum[first_it];
+}
+//------------------------------------------------------------------------------
+
+
+// Total weight * distance from 'pos' of the events between 'min_dist' and 'max_dist' (inclusive) from 'pos'
+double TTSS_Profile::get_weighted_distance( const int pos, const int min_dist, const int max_dist ) const
+{
+	unsigned int first_it = 0;
+	unsigned int last_it  = 0;
+
+	get_event_range( pos, min_dist, max_dist, &first_it, &last_it );
+
+	return (double)( (long long)pos - base_coord ) * ( weight_sum[last_it] - weight_sum[first_it] ) - ( coord_sum[last_it] - coord_sum[first_it] );
+}
 //==============================================================================
 	
 ////////////////////////////////////////////////////////////////////////////////
@@ -2131,6 +2272,7 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 
 	// ------------------------------
 	// Extract the uORF list from the Miura data
+	TRACE_STAGE_BEGIN( trace_Miura, "Miura", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Miura = extract_uORF_rows_from_Miura_table();
 
 	if( extract_gene_coord_Miura( *uORF_table_Miura, S_Cerevisiae_Chrom.get_gff_annotations(), ORF_Data, &uORF_data_start_it ) )
@@ -2144,12 +2286,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Miura;
+	TRACE_STAGE_END( trace_Miura, ORF_Data->size() );
 	// ------------------------------
 
 	
 
 	// ------------------------------
 	// Extract the uORF list from the Ingolia data
+	TRACE_STAGE_BEGIN( trace_Ingolia, "Ingolia", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Ingolia = new TCSV_Contents( PATH_DATA_FOLDER, uORF_ALL_FILE_NAME_INGOLIA );
 	uORF_table_Ingolia->parse_csv();
 
@@ -2164,12 +2308,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Ingolia;
+	TRACE_STAGE_END( trace_Ingolia, ORF_Data->size() );
 	// ------------------------------
 	
 
 
 	// ------------------------------
 	// Extract the uORF list from the Zhang & Dietrich Current Genetics data
+	TRACE_STAGE_BEGIN( trace_Zhang_Dietrich_NAR, "Zhang_Dietrich_NAR", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Zhang_Dietrich_NAR = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_ZHANG_DIETRICH_NAR  );
 	uORF_table_Zhang_Dietrich_NAR->parse_csv();
 
@@ -2184,12 +2330,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Zhang_Dietrich_NAR;
+	TRACE_STAGE_END( trace_Zhang_Dietrich_NAR, ORF_Data->size() );
 	// ------------------------------
 
 
 
 	// ------------------------------
 	// Extract the uORF list from the Zhang & Dietrich Nucleic Acids Research data
+	TRACE_STAGE_BEGIN( trace_Zhang_Dietrich_CG, "Zhang_Dietrich_CG", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Zhang_Dietrich_CG = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_ZHANG_DIETRICH_CG );
 	uORF_table_Zhang_Dietrich_CG->parse_csv();
 
@@ -2204,12 +2352,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Zhang_Dietrich_CG;
+	TRACE_STAGE_END( trace_Zhang_Dietrich_CG, ORF_Data->size() );
 	// ------------------------------
 
 
 
 	// ------------------------------
 	// Extract the uORF list from the Nagalakshmi data
+	TRACE_STAGE_BEGIN( trace_Nagalakshmi, "Nagalakshmi", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Nagalakshmi = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_NAGALAKSHMI );
 	uORF_table_Nagalakshmi->parse_csv();
 
@@ -2224,12 +2374,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Nagalakshmi;
+	TRACE_STAGE_END( trace_Nagalakshmi, ORF_Data->size() );
 	// ------------------------------
 
 
 
 	// ------------------------------
 	// Extract the uORF list from the Cjijovic data
+	TRACE_STAGE_BEGIN( trace_Cvijovic, "Cvijovic", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Cvijovic = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_CVIJOVIC );
 	uORF_table_Cvijovic->parse_csv();
 
@@ -2244,12 +2396,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Cvijovic;
+	TRACE_STAGE_END( trace_Cvijovic, ORF_Data->size() );
 	// ------------------------------
 
 
 
 	// ------------------------------
 	// Extract the uORF list from the Guan data
+	TRACE_STAGE_BEGIN( trace_Guan, "Guan", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Guan = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_GUAN );
 	uORF_table_Guan->parse_csv();
 
@@ -2264,12 +2418,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Guan;
+	TRACE_STAGE_END( trace_Guan, ORF_Data->size() );
 	// ------------------------------
 
 	
 	
 	// ------------------------------
 	// Extract the uORF list from the Lawless data
+	TRACE_STAGE_BEGIN( trace_Lawless, "Lawless", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Lawless = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_LAWLESS );
 	uORF_table_Lawless->parse_csv();
 
@@ -2284,12 +2440,14 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Lawless;
+	TRACE_STAGE_END( trace_Lawless, ORF_Data->size() );
 	// ------------------------------
 	
 	
 	
 	// ------------------------------
 	// Extract the uORF list from the Selpi data
+	TRACE_STAGE_BEGIN( trace_Selpi, "Selpi", "compile_uORF_list_from_data" );
 	TCSV_Contents * uORF_table_Selpi = new TCSV_Contents( PATH_DATA_FOLDER, uORF_FILE_NAME_SELPI );
 	uORF_table_Selpi->parse_csv();
 
@@ -2304,6 +2462,7 @@ void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, vec
 	}
 
 	delete uORF_table_Selpi;
+	TRACE_STAGE_END( trace_Selpi, ORF_Data->size() );
 	// ------------------------------
 	
 
@@ -2322,17 +2481,24 @@ void add_GO_info_to_ORFs( vector <TORF_Data> * const ORF_Data, const vector <TGO
 	vector <string> GO_namespace = GO_Info_Table.get_csv_column<string> ( GENE_INFO_GO_NAMESPACE_HEADER );
 	vector <string> GO_name    	 = GO_Info_Table.get_csv_column<string> ( GENE_INFO_GO_NAME_HEADER      );
 	vector <string> GO_evidence  = GO_Info_Table.get_csv_column<string> ( GENE_INFO_GO_EVIDENCE_HEADER 	);
-	vector <string> GO_gene_name = GO_Info_Table.get_csv_column<string> ( GENE_INFO_SYST_NAME_HEADER 	);
+	vector <string> GO_gene_name_str = GO_Info_Table.get_csv_column<string> ( GENE_INFO_SYST_NAME_HEADER 	);
+	
+	// Interned, so that comparing each with an ORF's gene name is an integer compare
+	const vector <TInterned_String> GO_gene_name( GO_gene_name_str.begin(), GO_gene_name_str.end() );
 	
-	unsigned int prev_gene_end_pos = -1;
+	size_t prev_gene_end_pos = -1;
 	unsigned int num_genes_wo_GO_annotations  = 0;
-	unsigned int num_genes_not_in_correct_pos = 0;
+	size_t num_genes_not_in_correct_pos = 0;
+	
+	// Each row of the table is added as a task, so that (if 'GO_ANNOTATION_ERROR_POLICY' allows it) a row naming an
+	//   unknown GO term can be skipped without ending the program
+	TError_Collector GO_errors( "'add_GO_info_to_ORFs()' (row of \"" + (string)GENE_INFO_FILE_NAME + "\")", GO_ANNOTATION_ERROR_POLICY );
 
 	for( unsigned int i = 0; i < ORF_Data->size(); i++ )
 	{
 		// First, attempt to locate the gene in the table
 		int curr_gene_start_pos = -1;
-		unsigned int search_pos = prev_gene_end_pos + 1;
+		size_t search_pos = prev_gene_end_pos + 1;
 		bool rollover_occurred = FALSE;
 		
 		
@@ -2374,7 +2540,7 @@ void add_GO_info_to_ORFs( vector <TORF_Data> * const ORF_Data, const vector <TGO
 				num_genes_not_in_correct_pos++;
 			}
 			
-			unsigned int curr_gene_end_pos;
+			size_t curr_gene_end_pos;
 			
 			do 
 			{ 
@@ -2387,12 +2553,21 @@ void add_GO_info_to_ORFs( vector <TORF_Data> * const ORF_Data, const vector <TGO
 			
 			for( unsigned int GO_it = curr_gene_start_pos; GO_it <= curr_gene_end_pos; GO_it++ )
 			{
-				ORF_Data->at( i ).add_GO_Annotation( GO_namespace[GO_it], GO_name[GO_it], GO_evidence[GO_it], All_GO_Annotations );
+				const bool continue_annotating = GO_errors.run_task( GO_it, [&]( )
+				{
+					ORF_Data->at( i ).add_GO_Annotation( GO_namespace[GO_it], GO_name[GO_it], GO_evidence[GO_it], All_GO_Annotations );
+				} );
+				
+				if( continue_annotating == FALSE ) { break; }
 			}
 			
+			if( GO_errors.is_stop_requested() == TRUE ) { break; }
+			
 			prev_gene_end_pos = curr_gene_end_pos;
 		}
 	}
+	
+	GO_errors.report();
 
 	
 	ostringstream output_oss;
@@ -2425,7 +2600,10 @@ void add_GO_info_to_ORFs( vector <TORF_Data> * const ORF_Data, const vector <TGO
 
 
 
-void determine_ORF_and_uORF_characteristics( const TFasta_Content & S_Cerevisiae_Chrom, vector <TORF_Data> * const ORF_Data )
+// Annotate the ORFs and uORFs with their characteristics and the published datasets.  The uORF context profiles are also
+//   written to the output folder unless 'write_outputs' is FALSE (e.g. when loading a query snapshot, which shouldn't
+//   overwrite a batch run's results)
+void determine_ORF_and_uORF_characteristics( const TFasta_Content & S_Cerevisiae_Chrom, vector <TORF_Data> * const ORF_Data, const bool write_outputs )
 {
 	if( LIST_COMPILE_SOURCE == FROM_DATA_SOURCES )
 	{
@@ -2449,39 +2627,63 @@ void determine_ORF_and_uORF_characteristics( const TFasta_Content & S_Cerevisiae
 			Errors.handle_error( FATAL, "", __FILE__, __LINE__ );
 		}
 		
-		get_Brar_translation_data( ORF_Data );
-		
+		// The datasets, in the order they're added to the ORFs.  The order matters where datasets update the same fields
+		//   (e.g. TSS's are added by several datasets, and 'get_Arribere_Cap_Distance_index()' uses the TSS's)
+		vector <TDataset_Loader> loaders;
+
+		loaders.push_back( TDataset_Loader( "get_Brar_translation_data",                BRAR_TRANSL_DATA_FILE_NAME,         get_Brar_translation_data                ) );
 		#ifndef ADD_COL_TO_MCMANUS_TRANSL_DATA
-			get_McManus_translation_data( ORF_Data );
+			loaders.push_back( TDataset_Loader( "get_McManus_translation_data",             McMANUS_TRANSL_DATA_FILE_NAME,      get_McManus_translation_data             ) );
 		#endif
+
+		loaders.push_back( TDataset_Loader( "get_Miura_TSS_data",                       MIURA_TSS_DATA_FILE_NAME,           get_Miura_TSS_data                       ) );
+		loaders.push_back( TDataset_Loader( "get_Zhang_Dietrich_TSS_data",              ZHANG_DIETRICH_TSS_DATA_FILE_NAME,  get_Zhang_Dietrich_TSS_data              ) );
+		loaders.push_back( TDataset_Loader( "get_Xu_TSS_data",                          XU_TSS_DATA_FILE_NAME,              get_Xu_TSS_data                          ) );
+		loaders.push_back( TDataset_Loader( "get_Yassour_TSS_data",                     YASSOUR_TSS_DATA_FILE_NAME,         get_Yassour_TSS_data                     ) );
+		loaders.push_back( TDataset_Loader( "get_Nagalakshmi_TSS_data",                 NAGALAKSHMI_TSS_DATA_FILE_NAME,     get_Nagalakshmi_TSS_data                 ) );
+		loaders.push_back( TDataset_Loader( "get_David_TSS_data",                       DAVID_TSS_DATA_FILE_NAME,           get_David_TSS_data                       ) );
+
+		loaders.push_back( TDataset_Loader( "get_Arribere_TL_data",                     ARRIBERE_TL_LENGTHS_FILE_NAME,      get_Arribere_TL_data                     ) );
+		loaders.push_back( TDataset_Loader( "get_Arribere_SI_data",                     ARRIBERE_SI_SCORES_FILE_NAME,       get_Arribere_SI_data                     ) );
+
+		loaders.push_back( TDataset_Loader( "get_He_mRNA_change_data",                  HE_mRNA_ABUNDANCE_FILE_NAME,        get_He_mRNA_change_data                  ) );
+		loaders.push_back( TDataset_Loader( "get_Lelivelt_mRNA_change_data",            LELIVELT_mRNA_ABUNDANCE_FILE_NAME,  get_Lelivelt_mRNA_change_data            ) );
+
+		loaders.push_back( TDataset_Loader( "get_Duttagupta_PUB1_binding_data",         DUTTAGUPTA_PUB1_BINDING_FILE_NAME,  get_Duttagupta_PUB1_binding_data         ) );
+		loaders.push_back( TDataset_Loader( "get_Duttagupta_PUB1_effects_data",         DUTTAGUPTA_PUB1_EFFECTS_FILE_NAME,  get_Duttagupta_PUB1_effects_data         ) );
+		loaders.push_back( TDataset_Loader( "get_Duttagupta_PUB1_mRNA_half_lives_data", DUTTAGUPTA_PUB1_mRNA_HL_FILE_NAME,  get_Duttagupta_PUB1_mRNA_half_lives_data ) );
+		loaders.push_back( TDataset_Loader( "get_Guan_NMD_sensitive_transcripts_data",  GUAN_NMD_TRANSCRIPTS_FILE_NAME,     get_Guan_NMD_sensitive_transcripts_data  ) );
+	  //get_Guan_uORFs_in_NMD_path_data( ORF_Data );
+		loaders.push_back( TDataset_Loader( "get_Hogan_PUB1_data",                      HOGAN_PUB1_DATA_FILE_NAME,          get_Hogan_PUB1_data                      ) );
+		loaders.push_back( TDataset_Loader( "get_Hogan_UPF1_data",                      HOGAN_UPF1_DATA_FILE_NAME,          get_Hogan_UPF1_data                      ) );
+		loaders.push_back( TDataset_Loader( "get_Johansson_mRNA_binding_data",          JOHANSSON_mRNA_UPF1_BIND_FILE_NAME, get_Johansson_mRNA_binding_data          ) );
+		loaders.push_back( TDataset_Loader( "get_Johansson_mRNA_decay_data",            JOHANSSON_mRNA_DECAY_FILE_NAME,     get_Johansson_mRNA_decay_data            ) );
+
+		loaders.push_back( TDataset_Loader( "get_Arribere_Cap_Distance_index",          ARRIBERE_TATL_SEQ_FILE_NAME,        get_Arribere_Cap_Distance_index          ) );
+
+
+		// All of the files are read and parsed concurrently; each dataset is added to the ORFs (in order) as soon as it
+		//   and all of the datasets before it have been parsed.  A dataset that fails to parse is left out (and, unless
+		//   'DATASET_PARSE_ERROR_POLICY' allows skipping it, the program ends once the parsing has stopped)
+		TError_Collector dataset_errors( "'determine_ORF_and_uORF_characteristics()' (reading datasets)", DATASET_PARSE_ERROR_POLICY );
 		
+		const TParallel_Task parse_dataset = [&]( const unsigned int loader_it )
+		{
+			dataset_errors.run_task( loader_it, [&]( ) { loaders[loader_it].parse(); } );
+		};
+
+		const TParallel_Task apply_dataset = [&]( const unsigned int loader_it )
+		{
+			if( dataset_errors.is_stop_requested() == TRUE || dataset_errors.did_task_fail( loader_it ) == TRUE ) { return; }
+			
+			TRACE_STAGE_BEGIN( trace_apply_dataset, loaders[loader_it].get_name(), "determine_ORF_and_uORF_characteristics" );
+			loaders[loader_it].apply( ORF_Data );
+			TRACE_STAGE_END( trace_apply_dataset, loaders[loader_it].get_num_records() );
+		};
+
+		parallel_pipeline( loaders.size(), parse_dataset, apply_dataset );
 		
-		get_Miura_TSS_data		     ( ORF_Data );
-		get_Zhang_Dietrich_TSS_data  ( ORF_Data );
-		get_Xu_TSS_data			     ( ORF_Data );
-		get_Yassour_TSS_data	     ( ORF_Data );
-		get_Nagalakshmi_TSS_data     ( ORF_Data );
-		get_David_TSS_data   	     ( ORF_Data );
-                                     
-		                             
-		get_Arribere_TL_data   	     ( ORF_Data );
-		get_Arribere_SI_data   	     ( ORF_Data );
-		                             
-		get_He_mRNA_change_data      ( ORF_Data );
-		get_Lelivelt_mRNA_change_data( ORF_Data );
-		
-		get_Duttagupta_PUB1_binding_data		( ORF_Data );
-		get_Duttagupta_PUB1_effects_data		( ORF_Data );
-		get_Duttagupta_PUB1_mRNA_half_lives_data( ORF_Data );
-		get_Guan_NMD_sensitive_transcripts_data	( ORF_Data );
-	  //get_Guan_uORFs_in_NMD_path_data			( ORF_Data );
-		get_Hogan_PUB1_data						( ORF_Data );
-		get_Hogan_UPF1_data						( ORF_Data );
-		get_Johansson_mRNA_binding_data			( ORF_Data );
-		get_Johansson_mRNA_decay_data			( ORF_Data );
-
-		
-		get_Arribere_Cap_Distance_index( ORF_Data );
+		dataset_errors.report();
 		
 		unsigned int tss_sum = 0;
 		unsigned int num_tss = 0;
@@ -2507,8 +2709,20 @@ void determine_ORF_and_uORF_characteristics( const TFasta_Content & S_Cerevisiae
 		
 		
 		// Cluster the uORFs based on kmer vectors for uORF context (-50 to +50 relative to start codon)
-		calc_mod_AMI_uORF_context( S_Cerevisiae_Chrom, ORF_Data );
-		cluster_uORF_context_profiles( ORF_Data );
+		TContext_Profile_Matrix context_profiles;
+		
+		TRACE_STAGE_BEGIN( trace_calc_mod_AMI_uORF_context, "calc_mod_AMI_uORF_context", "determine_ORF_and_uORF_characteristics" );
+		calc_mod_AMI_uORF_context( ORF_Data, &context_profiles );
+		TRACE_STAGE_END( trace_calc_mod_AMI_uORF_context, ORF_Data->size() );
+		
+		TRACE_STAGE_BEGIN( trace_cluster_uORF_context_profiles, "cluster_uORF_context_profiles", "determine_ORF_and_uORF_characteristics" );
+		cluster_uORF_context_profiles( ORF_Data, &context_profiles );
+		TRACE_STAGE_END( trace_cluster_uORF_context_profiles, ORF_Data->size() );
+		
+		if( write_outputs == TRUE && context_profiles.write( PATH_OUTPUT_FOLDER, uORF_CONTEXT_PROFILES_FILE_NAME, CONTEXT_PROFILE_FILE_VALUE_TYPE ) )
+		{
+			Errors.handle_error( FATAL, "Error in 'determine_ORF_and_uORF_characteristics()': ", __FILE__, __LINE__ );
+		}
 	}
 
 	return;
@@ -2549,10 +2763,8 @@ int get_uORF_effects_on_gene_translation( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Miura_TSS_data( vector <TORF_Data> * const ORF_Data )
+void get_Miura_TSS_data( const TCSV_Contents & Miura_TSS_Data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Miura_TSS_Data( PATH_DATA_FOLDER, MIURA_TSS_DATA_FILE_NAME );
-	Miura_TSS_Data.parse_csv();
 	
 	
 	vector <string> 	  gene_name = Miura_TSS_Data.get_csv_column<string>		 ( MIURA_TSS_SYST_NAME_HEADER );
@@ -2579,15 +2791,10 @@ void get_Miura_TSS_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Zhang_Dietrich_TSS_data( vector <TORF_Data> * const ORF_Data )
+void get_Zhang_Dietrich_TSS_data( const string & Zhang_Dietrich_TSS_info, vector <TORF_Data> * const ORF_Data )
 {
 	// ------------------------------
 	// Read in the GFF file containing the Zhang and Dietrich TSS annotations used in SGD's GBrowse
-	string Zhang_Dietrich_TSS_info;
-	if( read_entire_file_contents( PATH_DATA_FOLDER, ZHANG_DIETRICH_TSS_DATA_FILE_NAME, &Zhang_Dietrich_TSS_info ) )
-	{
-		Errors.handle_error( FATAL, "Error reading Zhang and Dietrich TSS file contents. ", __FILE__, __LINE__ );
-	}
 	
 	string Zhang_Dietrich_TSS_info_file_body = Zhang_Dietrich_TSS_info.substr( Zhang_Dietrich_TSS_info.find( "\nchrI" ) );
 	// ------------------------------
@@ -2596,9 +2803,19 @@ void get_Zhang_Dietrich_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	// ------------------------------
 	// Extract the needed information (chromosome number, clone ID, and hit start/end)
-	vector <string> tss_coord_str = extract_fields( Zhang_Dietrich_TSS_info_file_body, "TSS\t", 			 "\t" 			);
-	vector <string> tss_freq_str  = extract_fields( Zhang_Dietrich_TSS_info_file_body, ";frequency=", 	 ";associated_ORF=" );
-	vector <string> gene_name     = extract_fields( Zhang_Dietrich_TSS_info_file_body, ";associated_ORF=", "\n" 			);
+	vector <TField_Spec> field_specs;
+	field_specs.push_back( TField_Spec( "TSS\t", 			 "\t" 			    ) );
+	field_specs.push_back( TField_Spec( ";frequency=", 	 ";associated_ORF=" ) );
+	field_specs.push_back( TField_Spec( ";associated_ORF=", "\n" 			    ) );
+	
+	vector <vector <TField_View> > fields;
+	extract_field_views( Zhang_Dietrich_TSS_info_file_body, field_specs, &fields );
+	
+	const vector <TField_View> & tss_coord_str = fields[0];
+	const vector <TField_View> & tss_freq_str  = fields[1];
+	
+	vector <string> gene_name( 0 );
+	for( unsigned int i = 0; i < fields[2].size(); i++ ) { gene_name.push_back( fields[2][i].get_str( Zhang_Dietrich_TSS_info_file_body ) ); }
 	
 	if( tss_coord_str.size() != gene_name.size() || tss_coord_str.size() != gene_name.size() )
 	{
@@ -2612,8 +2829,8 @@ void get_Zhang_Dietrich_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	for( unsigned int i = 0; i < tss_coord.size(); i++ )
 	{
-		tss_coord[i] = atoi( tss_coord_str[i].c_str() );
-		tss_freq[i]  = atoi( tss_freq_str[i].c_str()  );
+		tss_coord[i] = tss_coord_str[i].to_int( Zhang_Dietrich_TSS_info_file_body );
+		tss_freq[i]  = tss_freq_str[i].to_int ( Zhang_Dietrich_TSS_info_file_body );
 	}
 	// ------------------------------
 	
@@ -2634,15 +2851,10 @@ void get_Zhang_Dietrich_TSS_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Xu_TSS_data( vector <TORF_Data> * const ORF_Data )
+void get_Xu_TSS_data( const string & Xu_TSS_info, vector <TORF_Data> * const ORF_Data )
 {
 	// ------------------------------
 	// Read in the GFF file containing the Zhang and Dietrich TSS annotations used in SGD's GBrowse
-	string Xu_TSS_info;
-	if( read_entire_file_contents( PATH_DATA_FOLDER, XU_TSS_DATA_FILE_NAME, &Xu_TSS_info ) )
-	{
-		Errors.handle_error( FATAL, "Error reading Xu TSS file contents. ", __FILE__, __LINE__ );
-	}
 	
 	string Xu_TSS_info_file_body = Xu_TSS_info.substr( Xu_TSS_info.find( "\nchrI" ) );
 	// ------------------------------
@@ -2651,9 +2863,19 @@ void get_Xu_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	// ------------------------------
 	// Extract the needed information (chromosome number, clone ID, and hit start/end)
-	vector <string> transcr_first_coord_str = extract_fields( Xu_TSS_info_file_body, "Xu_2009_ORFs\ttranscript\t", "\t"  			  );
-	vector <string> transcr_last_coord_str  = extract_fields( Xu_TSS_info_file_body, "Xu_2009_ORFs\ttranscript\t", "\t." 			  );
-	vector <string> gene_name     			= extract_fields( Xu_TSS_info_file_body, ";Name=", 					   ";end_confidence=" );
+	vector <TField_Spec> field_specs;
+	field_specs.push_back( TField_Spec( "Xu_2009_ORFs\ttranscript\t", "\t"  ) );
+	field_specs.push_back( TField_Spec( "Xu_2009_ORFs\ttranscript\t", "\t." ) );
+	field_specs.push_back( TField_Spec( ";Name=", ";end_confidence=" ) );
+	
+	vector <vector <TField_View> > fields;
+	extract_field_views( Xu_TSS_info_file_body, field_specs, &fields );
+	
+	const vector <TField_View> & transcr_first_coord_str = fields[0];
+	const vector <TField_View> & transcr_last_coord_str  = fields[1];
+	
+	vector <string> gene_name( 0 );
+	for( unsigned int i = 0; i < fields[2].size(); i++ ) { gene_name.push_back( fields[2][i].get_str( Xu_TSS_info_file_body ) ); }
 	
 	
 	if( transcr_first_coord_str.size() != gene_name.size() || transcr_last_coord_str.size() != gene_name.size() )
@@ -2667,10 +2889,10 @@ void get_Xu_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	for( unsigned int i = 0; i < gene_name.size(); i++ )
 	{
-		unsigned int transcr_first_coord  = atoi( transcr_first_coord_str[i].c_str() );
+		unsigned int transcr_first_coord  = transcr_first_coord_str[i].to_int( Xu_TSS_info_file_body );
 		
-		unsigned int last_coord_start_pos = transcr_last_coord_str[i].find( '\t' ) + 1; 
-		unsigned int transcr_last_coord   = atoi( transcr_last_coord_str[i].substr( last_coord_start_pos ).c_str() );
+		size_t last_coord_start_pos 	  = transcr_last_coord_str[i].find( Xu_TSS_info_file_body, '\t' ) + 1; 
+		unsigned int transcr_last_coord   = transcr_last_coord_str[i].to_int( Xu_TSS_info_file_body, last_coord_start_pos );
 	
 		tss_coord[i] = ( gene_name[i].find( 'W' ) != string::npos ) ? transcr_first_coord : transcr_last_coord;
 	}
@@ -2693,15 +2915,10 @@ void get_Xu_TSS_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Yassour_TSS_data( vector <TORF_Data> * const ORF_Data )
+void get_Yassour_TSS_data( const string & Yassour_TSS_info, vector <TORF_Data> * const ORF_Data )
 {
 	// ------------------------------
 	// Read in the GFF file containing the Zhang and Dietrich TSS annotations used in SGD's GBrowse
-	string Yassour_TSS_info;
-	if( read_entire_file_contents( PATH_DATA_FOLDER, YASSOUR_TSS_DATA_FILE_NAME, &Yassour_TSS_info ) )
-	{
-		Errors.handle_error( FATAL, "Error reading Yassour TSS file contents. ", __FILE__, __LINE__ );
-	}
 	
 	string Yassour_TSS_info_file_body = Yassour_TSS_info.substr( Yassour_TSS_info.find( "\nchrI" ) );
 	// ------------------------------
@@ -2710,9 +2927,19 @@ void get_Yassour_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	// ------------------------------
 	// Extract the needed information (chromosome number, clone ID, and hit start/end)
-	vector <string> transcr_first_coord_str = extract_fields( Yassour_TSS_info_file_body, "Yassour_2009\tfive_prime_UTR\t", "\t" 		  );
-	vector <string> transcr_last_coord_str  = extract_fields( Yassour_TSS_info_file_body, "Yassour_2009\tfive_prime_UTR\t", "\t." 		  );
-	vector <string> gene_name     			= extract_fields( Yassour_TSS_info_file_body, ";Name=", 					   "_5UTR;Alias=" );
+	vector <TField_Spec> field_specs;
+	field_specs.push_back( TField_Spec( "Yassour_2009\tfive_prime_UTR\t", "\t"  ) );
+	field_specs.push_back( TField_Spec( "Yassour_2009\tfive_prime_UTR\t", "\t." ) );
+	field_specs.push_back( TField_Spec( ";Name=", "_5UTR;Alias=" ) );
+	
+	vector <vector <TField_View> > fields;
+	extract_field_views( Yassour_TSS_info_file_body, field_specs, &fields );
+	
+	const vector <TField_View> & transcr_first_coord_str = fields[0];
+	const vector <TField_View> & transcr_last_coord_str  = fields[1];
+	
+	vector <string> gene_name( 0 );
+	for( unsigned int i = 0; i < fields[2].size(); i++ ) { gene_name.push_back( fields[2][i].get_str( Yassour_TSS_info_file_body ) ); }
 	
 
 	if( transcr_first_coord_str.size() != gene_name.size() || transcr_last_coord_str.size() != gene_name.size() )
@@ -2726,10 +2953,10 @@ void get_Yassour_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	for( unsigned int i = 0; i < gene_name.size(); i++ )
 	{
-		unsigned int transcr_first_coord  = atoi( transcr_first_coord_str[i].c_str() );
+		unsigned int transcr_first_coord  = transcr_first_coord_str[i].to_int( Yassour_TSS_info_file_body );
 		
-		unsigned int last_coord_start_pos = transcr_last_coord_str[i].find( '\t' ) + 1; 
-		unsigned int transcr_last_coord   = atoi( transcr_last_coord_str[i].substr( last_coord_start_pos ).c_str() );
+		size_t last_coord_start_pos 	  = transcr_last_coord_str[i].find( Yassour_TSS_info_file_body, '\t' ) + 1; 
+		unsigned int transcr_last_coord   = transcr_last_coord_str[i].to_int( Yassour_TSS_info_file_body, last_coord_start_pos );
 	
 		tss_coord[i] = ( gene_name[i].find( 'W' ) != string::npos ) ? transcr_first_coord : transcr_last_coord;
 	}
@@ -2752,15 +2979,10 @@ void get_Yassour_TSS_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Nagalakshmi_TSS_data( vector <TORF_Data> * const ORF_Data )
+void get_Nagalakshmi_TSS_data( const string & Nagalakshmi_TSS_info, vector <TORF_Data> * const ORF_Data )
 {
 	// ------------------------------
 	// Read in the GFF file containing the Zhang and Dietrich TSS annotations used in SGD's GBrowse
-	string Nagalakshmi_TSS_info;
-	if( read_entire_file_contents( PATH_DATA_FOLDER, NAGALAKSHMI_TSS_DATA_FILE_NAME, &Nagalakshmi_TSS_info ) )
-	{
-		Errors.handle_error( FATAL, "Error reading Nagalakshmi TSS file contents. ", __FILE__, __LINE__ );
-	}
 	
 	string Nagalakshmi_TSS_info_file_body = Nagalakshmi_TSS_info.substr( Nagalakshmi_TSS_info.find( "\nchrI" ) );
 	// ------------------------------
@@ -2769,9 +2991,19 @@ void get_Nagalakshmi_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	// ------------------------------
 	// Extract the needed information (chromosome number, clone ID, and hit start/end)
-	vector <string> transcr_first_coord_str = extract_fields( Nagalakshmi_TSS_info_file_body, "Nagalakshmi_2008\tfive_prime_UTR\t", "\t" 		  				  	 );
-	vector <string> transcr_last_coord_str  = extract_fields( Nagalakshmi_TSS_info_file_body, "Nagalakshmi_2008\tfive_prime_UTR\t", "\t." 		  				   	 );
-	vector <string> gene_name     			= extract_fields( Nagalakshmi_TSS_info_file_body, ";Name=", 					   	   "_5UTR;log2_transcription_level=" );
+	vector <TField_Spec> field_specs;
+	field_specs.push_back( TField_Spec( "Nagalakshmi_2008\tfive_prime_UTR\t", "\t"  ) );
+	field_specs.push_back( TField_Spec( "Nagalakshmi_2008\tfive_prime_UTR\t", "\t." ) );
+	field_specs.push_back( TField_Spec( ";Name=", "_5UTR;log2_transcription_level=" ) );
+	
+	vector <vector <TField_View> > fields;
+	extract_field_views( Nagalakshmi_TSS_info_file_body, field_specs, &fields );
+	
+	const vector <TField_View> & transcr_first_coord_str = fields[0];
+	const vector <TField_View> & transcr_last_coord_str  = fields[1];
+	
+	vector <string> gene_name( 0 );
+	for( unsigned int i = 0; i < fields[2].size(); i++ ) { gene_name.push_back( fields[2][i].get_str( Nagalakshmi_TSS_info_file_body ) ); }
 	
 	
 	if( transcr_first_coord_str.size() != gene_name.size() || transcr_last_coord_str.size() != gene_name.size() )
@@ -2785,10 +3017,10 @@ void get_Nagalakshmi_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	for( unsigned int i = 0; i < gene_name.size(); i++ )
 	{
-		unsigned int transcr_first_coord  = atoi( transcr_first_coord_str[i].c_str() );
+		unsigned int transcr_first_coord  = transcr_first_coord_str[i].to_int( Nagalakshmi_TSS_info_file_body );
 		
-		unsigned int last_coord_start_pos = transcr_last_coord_str[i].find( '\t' ) + 1; 
-		unsigned int transcr_last_coord   = atoi( transcr_last_coord_str[i].substr( last_coord_start_pos ).c_str() );
+		size_t last_coord_start_pos 	  = transcr_last_coord_str[i].find( Nagalakshmi_TSS_info_file_body, '\t' ) + 1; 
+		unsigned int transcr_last_coord   = transcr_last_coord_str[i].to_int( Nagalakshmi_TSS_info_file_body, last_coord_start_pos );
 	
 		tss_coord[i] = ( gene_name[i].find( 'W' ) != string::npos ) ? transcr_first_coord : transcr_last_coord;
 	}
@@ -2811,15 +3043,10 @@ void get_Nagalakshmi_TSS_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_David_TSS_data( vector <TORF_Data> * const ORF_Data )
+void get_David_TSS_data( const string & David_TSS_info, vector <TORF_Data> * const ORF_Data )
 {
 	// ------------------------------
 	// Read in the GFF file containing the Zhang and Dietrich TSS annotations used in SGD's GBrowse
-	string David_TSS_info;
-	if( read_entire_file_contents( PATH_DATA_FOLDER, DAVID_TSS_DATA_FILE_NAME, &David_TSS_info ) )
-	{
-		Errors.handle_error( FATAL, "Error reading David TSS file contents. ", __FILE__, __LINE__ );
-	}
 	
 	string David_TSS_info_file_body = David_TSS_info.substr( David_TSS_info.find( "\nchrI" ) );
 	// ------------------------------
@@ -2828,11 +3055,20 @@ void get_David_TSS_data( vector <TORF_Data> * const ORF_Data )
 	
 	// ------------------------------
 	// Extract the needed information (chromosome number, clone ID, and hit start/end)
-	vector <string> transcr_first_coord_str = extract_fields( David_TSS_info_file_body, "David_2006_total\ttranscript\t", "\t" 	 										   );
-	vector <string> transcr_last_coord_str  = extract_fields( David_TSS_info_file_body, "David_2006_total\ttranscript\t", "\t.\t" 										   );
-	vector <string> strand_str  			= extract_fields( David_TSS_info_file_body, "David_2006_total\ttranscript\t", "\t.\t" 										   );
-	vector <string> UTR_len_str  			= extract_fields( David_TSS_info_file_body, ";utr5=", 						 ";utr3=", 		   "David_2006_total\ttranscript\t" );
-	vector <string> overlapping_features    = extract_fields( David_TSS_info_file_body, ";overlapFeatAll=", 			 ";oppositeExpr=", "David_2006_total\ttranscript\t" );
+	vector <TField_Spec> field_specs;
+	field_specs.push_back( TField_Spec( "David_2006_total\ttranscript\t", "\t" 	 									 ) );
+	field_specs.push_back( TField_Spec( "David_2006_total\ttranscript\t", "\t.\t" 									 ) );
+	field_specs.push_back( TField_Spec( ";utr5=", 						  ";utr3=", 		"David_2006_total\ttranscript\t" ) );
+	field_specs.push_back( TField_Spec( ";overlapFeatAll=", 			  ";oppositeExpr=", "David_2006_total\ttranscript\t" ) );
+	
+	vector <vector <TField_View> > fields;
+	extract_field_views( David_TSS_info_file_body, field_specs, &fields );
+	
+	const vector <TField_View> & transcr_first_coord_str = fields[0];
+	const vector <TField_View> & transcr_last_coord_str  = fields[1];
+	const vector <TField_View> & strand_str  			 = fields[1];
+	const vector <TField_View> & UTR_len_str  			 = fields[2];
+	const vector <TField_View> & overlapping_features    = fields[3];
 	
 	
 	if( transcr_first_coord_str.size() != overlapping_features.size() || 
@@ -2851,13 +3087,13 @@ void get_David_TSS_data( vector <TORF_Data> * const ORF_Data )
 
 	for( unsigned int i = 0; i < UTR_len_str.size(); i++ )
 	{
-		if( UTR_len_str[i] != "N/A" )
+		if( David_TSS_info_file_body.compare( UTR_len_str[i].start_pos, UTR_len_str[i].length, "N/A" ) != 0 )
 		{	
 			char strand_indicator = 'W';
-			if( strand_str[i][ strand_str[i].size() - 1 ] == '-' ) { strand_indicator = 'C'; }
+			if( David_TSS_info_file_body[ strand_str[i].start_pos + strand_str[i].length - 1 ] == '-' ) { strand_indicator = 'C'; }
 			
 			
-			vector <string> feature_list = parse_delimited_list<string>( overlapping_features[i], DEFAULT_DELIMITER );
+			vector <string> feature_list = parse_delimited_list<string>( overlapping_features[i].get_str( David_TSS_info_file_body ), DEFAULT_DELIMITER );
 			
 			unsigned int assigned_feature_it = feature_list.size();
 			for( unsigned int j = 0; j < feature_list.size(); j++ )
@@ -2867,7 +3103,7 @@ void get_David_TSS_data( vector <TORF_Data> * const ORF_Data )
 					if( assigned_feature_it != feature_list.size() )
 					{
 						Errors.handle_error( FATAL, (string)"Error in 'get_David_TSS_data()': Found multiple overlapping features on the correct strand (overlapping features: " + 
-															overlapping_features[i] + "). ", __FILE__, __LINE__ );
+															overlapping_features[i].get_str( David_TSS_info_file_body ) + "). ", __FILE__, __LINE__ );
 					}
 					
 					assigned_feature_it = j;
@@ -2882,11 +3118,10 @@ void get_David_TSS_data( vector <TORF_Data> * const ORF_Data )
 			gene_name.push_back( feature_list[ assigned_feature_it ] );
 			
 			
-			unsigned int transcr_first_coord  = atoi( transcr_first_coord_str[i].c_str() );
+			unsigned int transcr_first_coord  = transcr_first_coord_str[i].to_int( David_TSS_info_file_body );
 			
-			unsigned int last_coord_start_pos = transcr_last_coord_str[i].find( '\t' ) + 1; 
-			unsigned int last_coord_end_pos   = find_last_digit_or_char( DIGIT, transcr_last_coord_str[i], last_coord_start_pos );
-			unsigned int transcr_last_coord   = atoi( transcr_last_coord_str[i].substr( last_coord_start_pos, ( last_coord_end_pos - last_coord_start_pos + 1 ) ).c_str() );
+			size_t last_coord_start_pos 	  = transcr_last_coord_str[i].find( David_TSS_info_file_body, '\t' ) + 1; 
+			unsigned int transcr_last_coord   = transcr_last_coord_str[i].to_int( David_TSS_info_file_body, last_coord_start_pos );
 		
 			tss_coord.push_back( ( strand_indicator == 'W' ) ? transcr_first_coord : transcr_last_coord );
 		}
@@ -2956,15 +3191,13 @@ int add_TSS_list( const vector <unsigned int> & tss_coord_list, const vector <st
 
 
 
-void get_Brar_translation_data( vector <TORF_Data> * const ORF_Data )
+void get_Brar_translation_data( const TCSV_Contents & Brar_Translation_Info, vector <TORF_Data> * const ORF_Data )
 {
 	unsigned int num_uORFs_found_none_indicated = 0;
 	unsigned int num_no_uORFs_found_some_indicated = 0;
 	
 	// ------------------------------
 	// Read in the CSV file containing the Brar translation data and extract the relevant columns
-	TCSV_Contents Brar_Translation_Info( PATH_DATA_FOLDER, BRAR_TRANSL_DATA_FILE_NAME );
-	Brar_Translation_Info.parse_csv();
 	
 	vector <string> gene_name 	  = Brar_Translation_Info.get_csv_column<string>( BRAR_TRANSL_SYST_NAME_HEADER    );
 	vector <double> correlation   = Brar_Translation_Info.get_csv_column<double>( BRAR_TRANSL_CORRELATION_HEADER  );
@@ -3014,12 +3247,10 @@ void get_Brar_translation_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_McManus_translation_data( vector <TORF_Data> * const ORF_Data )
+void get_McManus_translation_data( const TCSV_Contents & McManus_Translation_Info, vector <TORF_Data> * const ORF_Data )
 {
 	// ------------------------------
 	// Read in the CSV file containing the Brar translation data and extract the relevant columns
-	TCSV_Contents McManus_Translation_Info( PATH_DATA_FOLDER, McMANUS_TRANSL_DATA_FILE_NAME );
-	McManus_Translation_Info.parse_csv();
 	
 	vector <string> gene_name 			 = McManus_Translation_Info.get_csv_column<string>( McMANUS_TRANSL_SYST_NAME_HEADER, 	 McMANUS_TRANSL_HEADER_ROW );
 	vector <string> present_in_uORF_list = McManus_Translation_Info.get_csv_column<string>( McMANUS_TRANSL_IN_uORF_LIST_HEADER,	 McMANUS_TRANSL_HEADER_ROW );
@@ -3116,10 +3347,8 @@ void add_present_in_uORF_list_col_to_McManus_transl_data( const vector <TORF_Dat
 
 
 
-void get_Arribere_TL_data( vector <TORF_Data> * const ORF_Data )
+void get_Arribere_TL_data( const TCSV_Contents & Arribere_TL_Data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Arribere_TL_Data( PATH_DATA_FOLDER, ARRIBERE_TL_LENGTHS_FILE_NAME );
-	Arribere_TL_Data.parse_csv();
 	
 	
 	vector <string> gene_name    		  = Arribere_TL_Data.get_csv_column<string>( ARRIBERE_TL_SYST_NAME_HEADER );
@@ -3146,10 +3375,8 @@ void get_Arribere_TL_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Arribere_SI_data( vector <TORF_Data> * const ORF_Data )  
+void get_Arribere_SI_data( const TCSV_Contents & Arribere_Shape_Index_Data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Arribere_Shape_Index_Data( PATH_DATA_FOLDER, ARRIBERE_SI_SCORES_FILE_NAME );
-	Arribere_Shape_Index_Data.parse_csv();
 	
 	vector <string> gene_name   = Arribere_Shape_Index_Data.get_csv_column<string>( ARRIBERE_SI_SYST_NAME_HEADER );
 	vector <double> shape_index = Arribere_Shape_Index_Data.get_csv_column<double>( ARRIBERE_SI_SCORE_HEADER 	 );    
@@ -3173,45 +3400,133 @@ void get_Arribere_SI_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Arribere_Cap_Distance_index( vector <TORF_Data> * const ORF_Data )  
+// The reads are streamed from the file a row at a time, into a position and a density array per chromosome (each
+//   chromosome is a pair of columns, "ChrN Positions" and "ChrN Read Densities", ending with 'DEFAULT_NAN').  As soon
+//   as a chromosome's columns end, the CDI of each ORF on it is calculated and its reads are released, so neither the
+//   file nor its cells are ever held in memory as text
+// Returns the number of rows read (excluding the header row)
+unsigned int get_Arribere_Cap_Distance_index( const string & file_folder_path, const string & file_name, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Arribere_TATL_seq_reads( PATH_DATA_FOLDER, ARRIBERE_TATL_SEQ_FILE_NAME );
-	Arribere_TATL_seq_reads.parse_csv();
+	TLine_Reader TATL_seq_reads;
+	
+	if( TATL_seq_reads.open( file_folder_path, file_name ) )
+	{
+		Errors.handle_error( FATAL, "Error in 'get_Arribere_Cap_Distance_index()': ", __FILE__, __LINE__ );
+	}
 	
+	string line;
+	bool line_read = FALSE;
+	vector <TField_View> fields;
 	
-	vector <vector <unsigned int> > read_pos	( NUM_S_CEREVISIAE_CHROM, vector <unsigned int>( 0 ) );
-	vector <vector <double	    > > read_density( NUM_S_CEREVISIAE_CHROM, vector <double      >( 0 ) );
 	
-	for( unsigned int chrom_it = 0; chrom_it < read_pos.size(); chrom_it++ )
+	// ------------------------------
+	// Find each chromosome's columns in the header row
+	if( TATL_seq_reads.get_line( &line, &line_read ) || line_read == FALSE )
+	{
+		Errors.handle_error( FATAL, "Error in 'get_Arribere_Cap_Distance_index()': Could not read the header row of '" + file_name + "'. ", __FILE__, __LINE__ );
+	}
+	
+	split_field_views( line, ',', &fields );
+	
+	vector <unsigned int> pos_col	 ( NUM_S_CEREVISIAE_CHROM, 0 );
+	vector <unsigned int> density_col( NUM_S_CEREVISIAE_CHROM, 0 );
+	
+	for( unsigned int chrom_it = 0; chrom_it < NUM_S_CEREVISIAE_CHROM; chrom_it++ )
 	{
-		read_pos[chrom_it] 	   = Arribere_TATL_seq_reads.get_csv_column<unsigned int>( (string)"Chr" + convert_uint_to_roman_numeral( chrom_it + 1 ) + " Positions" 	 );
-		read_density[chrom_it] = Arribere_TATL_seq_reads.get_csv_column<double		>( (string)"Chr" + convert_uint_to_roman_numeral( chrom_it + 1 ) + " Read Densities" );
+		const string pos_header 	= (string)"Chr" + convert_uint_to_roman_numeral( chrom_it + 1 ) + " Positions";
+		const string density_header = (string)"Chr" + convert_uint_to_roman_numeral( chrom_it + 1 ) + " Read Densities";
+		
+		pos_col[chrom_it] 	  = fields.size();
+		density_col[chrom_it] = fields.size();
 		
-		vector <unsigned int>::iterator it = find( read_pos[chrom_it].begin(), read_pos[chrom_it].end(), DEFAULT_NAN );
-		if( it == read_pos[chrom_it].end() ) { Errors.handle_error( FATAL, "Error in 'get_Arribere_Cap_Distance_index()': Could not find end of data for chromosome " + get_str( chrom_it + 1 ), __FILE__, __LINE__ ); }
+		for( unsigned int col_it = 0; col_it < fields.size(); col_it++ )
+		{
+			if( line.compare( fields[col_it].start_pos, fields[col_it].length, pos_header 	  ) == 0 ) { pos_col[chrom_it] 	   = col_it; }
+			if( line.compare( fields[col_it].start_pos, fields[col_it].length, density_header ) == 0 ) { density_col[chrom_it] = col_it; }
+		}
 		
-		read_pos[chrom_it].erase	( it, 												  				    read_pos[chrom_it].end() 	 );
-		read_density[chrom_it].erase( read_density[chrom_it].begin() + ( it - read_pos[chrom_it].begin() ), read_density[chrom_it].end() );
+		if( pos_col[chrom_it] == fields.size() || density_col[chrom_it] == fields.size() )
+		{
+			Errors.handle_error( FATAL, "Error in 'get_Arribere_Cap_Distance_index()': Could not find the columns for chromosome " + get_str( chrom_it + 1 ) + " in '" + file_name + "'. ", __FILE__, __LINE__ );
+		}
 	}
 	
 	
+	vector <vector <unsigned int> > ORF_its_by_chrom( NUM_S_CEREVISIAE_CHROM, vector <unsigned int>( 0 ) );
+	
 	for( unsigned int ORF_it = 0; ORF_it < ORF_Data->size(); ORF_it++ )
 	{
-		unsigned int chrom_it = ORF_Data->at( ORF_it ).chrom_num - 1;
-		ORF_Data->at( ORF_it ).get_CDI( read_pos[chrom_it], read_density[chrom_it] ); 
+		ORF_its_by_chrom[ ORF_Data->at( ORF_it ).chrom_num - 1 ].push_back( ORF_it );
 	}
+	// ------------------------------
+	
+	
+	
+	// ------------------------------
+	// Read the rows, finishing each chromosome once its columns end (cells missing from a row read as 0, as in a
+	//   'TCSV_Contents')
+	vector <vector <unsigned int> > read_pos	( NUM_S_CEREVISIAE_CHROM, vector <unsigned int>( 0 ) );
+	vector <vector <double	    > > read_density( NUM_S_CEREVISIAE_CHROM, vector <double      >( 0 ) );
+	vector <bool> chrom_finished( NUM_S_CEREVISIAE_CHROM, FALSE );
+	unsigned int num_chrom_finished = 0;
+	unsigned int num_rows = 0;
+	
+	while( num_chrom_finished < NUM_S_CEREVISIAE_CHROM )
+	{
+		if( TATL_seq_reads.get_line( &line, &line_read ) )
+		{
+			Errors.handle_error( FATAL, "Error in 'get_Arribere_Cap_Distance_index()': ", __FILE__, __LINE__ );
+		}
+		
+		if( line_read == FALSE ) { break; }
+		
+		num_rows++;
+		
+		split_field_views( line, ',', &fields );
+		
+		for( unsigned int chrom_it = 0; chrom_it < NUM_S_CEREVISIAE_CHROM; chrom_it++ )
+		{
+			if( chrom_finished[chrom_it] == TRUE ) { continue; }
+			
+			const unsigned int pos 	   = ( pos_col[chrom_it] 	 < fields.size() ) ? (unsigned int)atof( line.c_str() + fields[ pos_col[chrom_it] ].start_pos ) : 0;
+			const double 	   density = ( density_col[chrom_it] < fields.size() ) ? 			   atof( line.c_str() + fields[ density_col[chrom_it] ].start_pos ) : 0;
+			
+			if( pos != DEFAULT_NAN )
+			{
+				read_pos[chrom_it].push_back	( pos 	  );
+				read_density[chrom_it].push_back( density );
+				continue;
+			}
+			
+			
+			for( unsigned int i = 0; i < ORF_its_by_chrom[chrom_it].size(); i++ )
+			{
+				ORF_Data->at( ORF_its_by_chrom[chrom_it][i] ).get_CDI( read_pos[chrom_it], read_density[chrom_it] );
+			}
+			
+			vector <unsigned int>().swap( read_pos[chrom_it] 	 );
+			vector <double		>().swap( read_density[chrom_it] );
+			
+			chrom_finished[chrom_it] = TRUE;
+			num_chrom_finished++;
+		}
+	}
+	
+	for( unsigned int chrom_it = 0; chrom_it < NUM_S_CEREVISIAE_CHROM; chrom_it++ )
+	{
+		if( chrom_finished[chrom_it] == FALSE ) { Errors.handle_error( FATAL, "Error in 'get_Arribere_Cap_Distance_index()': Could not find end of data for chromosome " + get_str( chrom_it + 1 ), __FILE__, __LINE__ ); }
+	}
+	// ------------------------------
 	
 
-	return;
+	return num_rows;
 }
 //==============================================================================
 
   
   
-void get_He_mRNA_change_data( vector <TORF_Data> * const ORF_Data )
+void get_He_mRNA_change_data( const TCSV_Contents & He_mRNA_Data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents He_mRNA_Data( PATH_DATA_FOLDER, HE_mRNA_ABUNDANCE_FILE_NAME );
-	He_mRNA_Data.parse_csv();
 
 	vector <string> gene_name  = He_mRNA_Data.get_csv_column<string> ( HE_mRNA_SYST_NAME_HEADER  );
 	vector <double> ratio_UPF1 = He_mRNA_Data.get_csv_column<double> ( HE_mRNA_RATIO_UPF1_HEADER );
@@ -3247,10 +3562,8 @@ void get_He_mRNA_change_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Lelivelt_mRNA_change_data( vector <TORF_Data> * const ORF_Data )
+void get_Lelivelt_mRNA_change_data( const TCSV_Contents & Lelivelt_mRNA_Data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Lelivelt_mRNA_Data( PATH_DATA_FOLDER, LELIVELT_mRNA_ABUNDANCE_FILE_NAME );
-	Lelivelt_mRNA_Data.parse_csv();
 
 	vector <string> gene_name 	 = Lelivelt_mRNA_Data.get_csv_column<string> ( LELIVELT_mRNA_SYST_NAME_HEADER	 );
 	vector <double> ratio_UPF1 	 = Lelivelt_mRNA_Data.get_csv_column<double> ( LELIVELT_mRNA_RATIO_UPF1_HEADER	 );
@@ -3291,10 +3604,8 @@ void get_Lelivelt_mRNA_change_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Duttagupta_PUB1_binding_data( vector <TORF_Data> * const ORF_Data )
+void get_Duttagupta_PUB1_binding_data( const TCSV_Contents & Duttagupta_PUB1_binding, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Duttagupta_PUB1_binding( PATH_DATA_FOLDER, DUTTAGUPTA_PUB1_BINDING_FILE_NAME );
-	Duttagupta_PUB1_binding.parse_csv();
 
 	vector <string> gene_name  = Duttagupta_PUB1_binding.get_csv_column<string> ( DUTTAGUPTA_SYST_NAME_HEADER,  DUTTAGUPTA_PUB1_BINDING_HEADER_ROW );
 	vector <double> med_zscore = Duttagupta_PUB1_binding.get_csv_column<double> ( DUTTAGUPTA_MED_ZSCORE_HEADER, DUTTAGUPTA_PUB1_BINDING_HEADER_ROW );
@@ -3317,10 +3628,8 @@ void get_Duttagupta_PUB1_binding_data( vector <TORF_Data> * const ORF_Data )
 //==============================================================================
 
 
-void get_Duttagupta_PUB1_effects_data( vector <TORF_Data> * const ORF_Data )
+void get_Duttagupta_PUB1_effects_data( const TCSV_Contents & Duttagupta_PUB1_effects, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Duttagupta_PUB1_effects( PATH_DATA_FOLDER, DUTTAGUPTA_PUB1_EFFECTS_FILE_NAME );
-	Duttagupta_PUB1_effects.parse_csv();
 
 	vector <string> genes_stabilized_by_PUB1   = Duttagupta_PUB1_effects.get_csv_column<string> ( DUTTAGUPTA_STABILIZED_HEADER,   DUTTAGUPTA_PUB1_EFFECTS_HEADER_ROW );
 	vector <string> genes_destabilized_by_PUB1 = Duttagupta_PUB1_effects.get_csv_column<string> ( DUTTAGUPTA_DESTABILIZED_HEADER, DUTTAGUPTA_PUB1_EFFECTS_HEADER_ROW );
@@ -3364,10 +3673,8 @@ void get_Duttagupta_PUB1_effects_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Duttagupta_PUB1_mRNA_half_lives_data( vector <TORF_Data> * const ORF_Data )
+void get_Duttagupta_PUB1_mRNA_half_lives_data( const TCSV_Contents & Duttagupta_PUB1_mRNA_half_lives, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Duttagupta_PUB1_mRNA_half_lives( PATH_DATA_FOLDER, DUTTAGUPTA_PUB1_mRNA_HL_FILE_NAME );
-	Duttagupta_PUB1_mRNA_half_lives.parse_csv();
 
 	vector <string> gene_name = Duttagupta_PUB1_mRNA_half_lives.get_csv_column<string> ( DUTTAGUPTA_SYST_NAME_HEADER, DUTTAGUPTA_PUB1_HL_HEADER_ROW );
 	
@@ -3425,10 +3732,8 @@ void get_Duttagupta_PUB1_mRNA_half_lives_data( vector <TORF_Data> * const ORF_Da
 // Each of the transcripts in this file were selected by SAM as having >1.5 fold changes in abundance in the NMD- strain.  As expected, 
 // the vast majority of these transcripts increased in abundance.  Exact abundance changes weren't published
 
-void get_Guan_NMD_sensitive_transcripts_data( vector <TORF_Data> * const ORF_Data )
+void get_Guan_NMD_sensitive_transcripts_data( const TCSV_Contents & Guan_NMD_sensitive_transcripts, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Guan_NMD_sensitive_transcripts( PATH_DATA_FOLDER, GUAN_NMD_TRANSCRIPTS_FILE_NAME );
-	Guan_NMD_sensitive_transcripts.parse_csv();
 	
 	vector <string> gene_name 	  = Guan_NMD_sensitive_transcripts.get_csv_column<string> ( GUAN_NMD_SYST_NAME_HEADER, 		   GUAN_NMD_GENES_HEADER_ROW );
 	vector <string> direct_str    = Guan_NMD_sensitive_transcripts.get_csv_column<string> ( GUAN_NMD_DIRECT_TARGET_HEADER, 	   GUAN_NMD_GENES_HEADER_ROW );
@@ -3496,10 +3801,8 @@ void get_Guan_uORFs_in_NMD_path_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Hogan_PUB1_data( vector <TORF_Data> * const ORF_Data )
+void get_Hogan_PUB1_data( const TCSV_Contents & Hogan_PUB1_data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Hogan_PUB1_data( PATH_DATA_FOLDER, HOGAN_PUB1_DATA_FILE_NAME );
-	Hogan_PUB1_data.parse_csv();
 
 	vector <string> gene_name   = Hogan_PUB1_data.get_csv_column<string> ( HOGAN_SYST_NAME_HEADER   );
 	vector <double> q_value	    = Hogan_PUB1_data.get_csv_column<double> ( HOGAN_QVAL_HEADER 		);
@@ -3523,10 +3826,8 @@ void get_Hogan_PUB1_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Hogan_UPF1_data( vector <TORF_Data> * const ORF_Data )
+void get_Hogan_UPF1_data( const TCSV_Contents & Hogan_UPF1_data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Hogan_UPF1_data( PATH_DATA_FOLDER, HOGAN_UPF1_DATA_FILE_NAME );
-	Hogan_UPF1_data.parse_csv();
 
 	vector <string> gene_name   = Hogan_UPF1_data.get_csv_column<string> ( HOGAN_SYST_NAME_HEADER   );
 	vector <double> q_value	    = Hogan_UPF1_data.get_csv_column<double> ( HOGAN_QVAL_HEADER 		);
@@ -3550,10 +3851,8 @@ void get_Hogan_UPF1_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Johansson_mRNA_binding_data( vector <TORF_Data> * const ORF_Data )
+void get_Johansson_mRNA_binding_data( const TCSV_Contents & Johansson_mRNA_change_data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Johansson_mRNA_change_data( PATH_DATA_FOLDER, JOHANSSON_mRNA_UPF1_BIND_FILE_NAME );
-	Johansson_mRNA_change_data.parse_csv();
 
 	vector <string> gene_name 	= Johansson_mRNA_change_data.get_csv_column<string> ( JOHANSSON_SYST_NAME_HEADER     );
 	vector <double> fold_change = Johansson_mRNA_change_data.get_csv_column<double> ( JOHANSSON_FOLD_INCREASE_HEADER );
@@ -3576,10 +3875,8 @@ void get_Johansson_mRNA_binding_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-void get_Johansson_mRNA_decay_data( vector <TORF_Data> * const ORF_Data )
+void get_Johansson_mRNA_decay_data( const TCSV_Contents & Johansson_mRNA_change_data, vector <TORF_Data> * const ORF_Data )
 {
-	TCSV_Contents Johansson_mRNA_change_data( PATH_DATA_FOLDER, JOHANSSON_mRNA_DECAY_FILE_NAME );
-	Johansson_mRNA_change_data.parse_csv();
 
 	vector <string> gene_name 	 = Johansson_mRNA_change_data.get_csv_column<string> ( JOHANSSON_SYST_NAME_HEADER      );
 	vector <double> NMD_POS_mRNA = Johansson_mRNA_change_data.get_csv_column<double> ( JOHANSSON_60MIN_NMD2_POS_HEADER );
@@ -3603,7 +3900,7 @@ void get_Johansson_mRNA_decay_data( vector <TORF_Data> * const ORF_Data )
 
 
 
-unsigned int find_ORF( const string & gene_name, const vector <TORF_Data> & ORF_Data )
+unsigned int find_ORF( const TInterned_String & gene_name, const vector <TORF_Data> & ORF_Data )
 {
 	unsigned int r_ORF_it = 0;
 	
@@ -3614,6 +3911,27 @@ unsigned int find_ORF( const string & gene_name, const vector <TORF_Data> & ORF_
 	
 	return r_ORF_it;
 }
+//------------------------------------------------------------------------------
+
+
+// Names read from a dataset are looked up without interning them, so genes absent from 'ORF_Data' don't grow the
+//   symbol table
+unsigned int find_ORF( const string & gene_name, const vector <TORF_Data> & ORF_Data )
+{
+	const TSymbol_ID symbol = get_symbol_table().find( gene_name );
+
+	if( symbol == NO_SYMBOL ) { return ORF_Data.size(); }
+
+
+	unsigned int r_ORF_it = 0;
+	
+	while( r_ORF_it < ORF_Data.size() && ORF_Data[r_ORF_it].gene_name.get_symbol() != symbol )
+	{
+		r_ORF_it++;
+	}
+	
+	return r_ORF_it;
+}
 //==============================================================================
 
 
@@ -3710,7 +4028,7 @@ int extract_gene_coord_Miura( const TCSV_Contents & uORF_table, const vector <st
 			unsigned int gene_end_coord;
 			unsigned int gene_intergen_start_coord;
 			vector <TFeature> untransl_reg;
-			TFeature fpUTR_intron( string::npos, string::npos );
+			TFeature fpUTR_intron( (unsigned int)string::npos, (unsigned int)string::npos );
 				
 			if( get_gene_coord_from_gff( gene_name[i], 
 										 gff_annotations[UTR_chrom_num - 1], 
@@ -3778,7 +4096,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 											bool 		 * const opposite_strand,
 											unsigned int * const UTR_length )
 {
-	unsigned int chom_num_start_pos = UTR_coord_raw.find( "chr" ) + 3;
+	size_t chom_num_start_pos = UTR_coord_raw.find( "chr" ) + 3;
 	if( UTR_coord_raw.find( "chr" ) == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_UTR_coord_from_Miura_table_row()': " +
@@ -3786,7 +4104,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 															   gene_name, __FILE__, __LINE__ );
 	}
 	
-	unsigned int chrom_num_end_pos = UTR_coord_raw.find( '(' ) - 1;
+	size_t chrom_num_end_pos = UTR_coord_raw.find( '(' ) - 1;
 	if( UTR_coord_raw.find( '(' ) == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_UTR_coord_from_Miura_table_row()': " +
@@ -3800,7 +4118,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 
 
 	
-	unsigned int first_coord_start_pos = UTR_coord_raw.find( '(' ) + 1;
+	size_t first_coord_start_pos = UTR_coord_raw.find( '(' ) + 1;
 	if( UTR_coord_raw.find( '(' ) == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_UTR_coord_from_Miura_table_row()': " +
@@ -3808,7 +4126,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 															   gene_name, __FILE__, __LINE__ );
 	}
 	
-	unsigned int first_coord_end_pos = UTR_coord_raw.find( '-' ) - 1;
+	size_t first_coord_end_pos = UTR_coord_raw.find( '-' ) - 1;
 	if( UTR_coord_raw.find( '-' ) == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_UTR_coord_from_Miura_table_row()': " +
@@ -3822,7 +4140,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 
 
 	
-	unsigned int second_coord_start_pos = UTR_coord_raw.rfind( '-' ) + 1;
+	size_t second_coord_start_pos = UTR_coord_raw.rfind( '-' ) + 1;
 	if( UTR_coord_raw.rfind( '-' ) == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_UTR_coord_from_Miura_table_row()': " +
@@ -3830,7 +4148,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 															   gene_name, __FILE__, __LINE__ );
 	}
 	
-	unsigned int second_coord_end_pos = UTR_coord_raw.find( ')' ) - 1;
+	size_t second_coord_end_pos = UTR_coord_raw.find( ')' ) - 1;
 	if( UTR_coord_raw.find( ')' ) == string::npos )
 	{
 		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_UTR_coord_from_Miura_table_row()': " +
@@ -3873,7 +4191,7 @@ int extract_UTR_coord_from_Miura_table_row( const string & UTR_coord_raw,
 
 
 
-int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_misaligned_uORFs = 0;
 	unsigned int num_realigned_uORFs  = 0;
@@ -3927,14 +4245,14 @@ int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string>
 	for( unsigned int i = 0; i < uORF_info_all.size(); i++ )
 	{	
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 
 		
 		// ------------------------------
 		// Separate the uORF info field into a vector, with each element corresponding to the info for one uORF
 		vector <string> uORF_info_indiv( 0 );
-		unsigned int uORF_info_start_pos = 0;
-		unsigned int uORF_info_end_pos   = 0;
+		size_t uORF_info_start_pos = 0;
+		size_t uORF_info_end_pos   = 0;
 		
 		bool uORF_info_end_reached = FALSE;		
 
@@ -3982,24 +4300,24 @@ int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string>
 			// Most entries are of the form [relative_position/length/AUGCAI]
 			if( uORF_info_indiv[uORF_it][0] == '-' )
 			{
-				unsigned int rel_pos_start_pos = 0;
-				unsigned int rel_pos_end_pos   = uORF_info_indiv[uORF_it].find( '/', rel_pos_start_pos ) - 1;
-				unsigned int rel_pos_len       = rel_pos_end_pos - rel_pos_start_pos + 1;
+				size_t rel_pos_start_pos = 0;
+				size_t rel_pos_end_pos   = uORF_info_indiv[uORF_it].find( '/', rel_pos_start_pos ) - 1;
+				size_t rel_pos_len       = rel_pos_end_pos - rel_pos_start_pos + 1;
 
 				rel_uORF_pos = atoi( uORF_info_indiv[uORF_it].substr( rel_pos_start_pos, rel_pos_len ).c_str() );	
 
 				
 
-				unsigned int uORF_len_start_pos = uORF_info_indiv[uORF_it].find( '/' ) + 1;
-				unsigned int uORF_len_end_pos   = uORF_info_indiv[uORF_it].find( '/', uORF_len_start_pos ) - 1;
+				size_t uORF_len_start_pos = uORF_info_indiv[uORF_it].find( '/' ) + 1;
+				size_t uORF_len_end_pos   = uORF_info_indiv[uORF_it].find( '/', uORF_len_start_pos ) - 1;
 				unsigned int uORF_len_len       = uORF_len_end_pos - uORF_len_start_pos + 1;
 
 				exp_uORF_len = atoi( uORF_info_indiv[uORF_it].substr( uORF_len_start_pos, uORF_len_len ).c_str() ) * 3;		
 				
 				
 				
-				unsigned int uORF_AUGCAI_start_pos = uORF_info_indiv[uORF_it].find( '/', uORF_len_start_pos ) + 1;
-				unsigned int uORF_AUGCAI_end_pos   = uORF_info_indiv[uORF_it].size() - 1;
+				size_t uORF_AUGCAI_start_pos = uORF_info_indiv[uORF_it].find( '/', uORF_len_start_pos ) + 1;
+				size_t uORF_AUGCAI_end_pos   = uORF_info_indiv[uORF_it].size() - 1;
 				unsigned int uORF_AUGCAI_len       = uORF_AUGCAI_end_pos - uORF_AUGCAI_start_pos + 1;
 
 				AUGCAI_val = atof( uORF_info_indiv[uORF_it].substr( uORF_AUGCAI_start_pos, uORF_AUGCAI_len ).c_str() );
@@ -4008,16 +4326,16 @@ int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string>
 			// A few other entries are of the form [M-AA_sequence-*(length/AUGCAI)]
 			else if( uORF_info_indiv[uORF_it][0] == 'M' )
 			{
-				unsigned int uORF_aa_seq_start_pos = 0;
-				unsigned int uORF_aa_seqn_end_pos  = uORF_info_indiv[uORF_it].find( '(', uORF_aa_seq_start_pos ) - 1;
+				size_t uORF_aa_seq_start_pos = 0;
+				size_t uORF_aa_seqn_end_pos  = uORF_info_indiv[uORF_it].find( '(', uORF_aa_seq_start_pos ) - 1;
 				unsigned int uORF_aa_seq_len       = uORF_aa_seqn_end_pos - uORF_aa_seq_start_pos + 1;
 
 				exp_uORF_len = uORF_aa_seq_len * 3;
 				
 					
 					
-				unsigned int rel_pos_start_pos = uORF_info_indiv[uORF_it].find( '(' ) + 1;
-				unsigned int rel_pos_end_pos;
+				size_t rel_pos_start_pos = uORF_info_indiv[uORF_it].find( '(' ) + 1;
+				size_t rel_pos_end_pos;
 				if( uORF_info_indiv[uORF_it][rel_pos_start_pos] == '-' ) 
 				{ 
 					rel_pos_end_pos = find_last_digit_or_char( DIGIT, uORF_info_indiv[uORF_it], rel_pos_start_pos + 1 );
@@ -4026,14 +4344,14 @@ int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string>
 				{
 					return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'extract_uORFs_Miura()': uORF information not recognized. ", __FILE__, __LINE__ );
 				}
-				unsigned int rel_pos_len = rel_pos_end_pos - rel_pos_start_pos + 1;
+				size_t rel_pos_len = rel_pos_end_pos - rel_pos_start_pos + 1;
 
 				rel_uORF_pos = atoi( uORF_info_indiv[uORF_it].substr( rel_pos_start_pos, rel_pos_len ).c_str() );		
 
 
 				
-				unsigned int uORF_AUGCAI_start_pos = uORF_info_indiv[uORF_it].find( '/', rel_pos_end_pos )       + 1;
-				unsigned int uORF_AUGCAI_end_pos   = uORF_info_indiv[uORF_it].find( ')', uORF_AUGCAI_start_pos ) - 1;
+				size_t uORF_AUGCAI_start_pos = uORF_info_indiv[uORF_it].find( '/', rel_pos_end_pos )       + 1;
+				size_t uORF_AUGCAI_end_pos   = uORF_info_indiv[uORF_it].find( ')', uORF_AUGCAI_start_pos ) - 1;
 				unsigned int uORF_AUGCAI_len       = uORF_AUGCAI_end_pos - uORF_AUGCAI_start_pos + 1;
 
 				AUGCAI_val = atof( uORF_info_indiv[uORF_it].substr( uORF_AUGCAI_start_pos, uORF_AUGCAI_len ).c_str() );
@@ -4047,7 +4365,7 @@ int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string>
 			
 			if( UTR_comments[i].find( MIURA_UTR_INTRON_ID ) != string::npos ) 
 			{ 
-				if( ORF_Data->at( ORF_it ).fpUTR_intron.start_coord == string::npos )
+				if( ORF_Data->at( ORF_it ).fpUTR_intron.start_coord == (unsigned int)string::npos )
 				{
 					return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_uORFs_Miura()': Gene " + ORF_Data->at( ORF_it ).gene_name + 
 																	       " contained uORFs documented to be affected by a 5' UTR intron," +
@@ -4169,7 +4487,7 @@ int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const vector <string>
 	
 int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table, 
 							    const vector <string> & gff_annotations, 
-							    const vector <string> & yeast_chromosomes, 
+							    const vector <TPacked_Chrom> & yeast_chromosomes, 
 							    vector <TORF_Data> * const ORF_Data, 
 							    unsigned int * const uORF_data_start_it )
 {
@@ -4217,7 +4535,7 @@ int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table,
 		{
 			// ------------------------------
 			// Find the uORF's chromosome number
-			unsigned int chom_num_start_pos = uORF_coord[i].find( "chr" ) + 3;
+			size_t chom_num_start_pos = uORF_coord[i].find( "chr" ) + 3;
 			if( uORF_coord[i].find( "chr" ) == string::npos )
 			{
 				return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_gene_start_coord_Ingolia()': " +
@@ -4225,7 +4543,7 @@ int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table,
 																	   gene_name[i], __FILE__, __LINE__ );
 			}
 			
-			unsigned int chrom_num_end_pos = uORF_coord[i].find( '@' ) - 1;
+			size_t chrom_num_end_pos = uORF_coord[i].find( '@' ) - 1;
 			if( uORF_coord[i].find( '@' ) == string::npos )
 			{
 				return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_gene_start_coord_Ingolia()': " +
@@ -4259,7 +4577,7 @@ int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table,
 			unsigned int gene_start_coord_OLD;
 			
 			// Note that regardless of what strand the uORF is on, the second coordinate listed in the Ingolia table entry corresponds to the end of the uORF
-			unsigned int uORF_end_coord_start_pos = uORF_coord[i].find( INGOLIA_uORF_COORD_SEP ) + ( (string)INGOLIA_uORF_COORD_SEP ).size();
+			size_t uORF_end_coord_start_pos = uORF_coord[i].find( INGOLIA_uORF_COORD_SEP ) + ( (string)INGOLIA_uORF_COORD_SEP ).size();
 
 			if( uORF_coord[i].find( INGOLIA_uORF_COORD_SEP ) == string::npos )
 			{
@@ -4268,7 +4586,7 @@ int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table,
 																	   gene_name[i], __FILE__, __LINE__ );
 			}
 
-			unsigned int uORF_end_coord_end_pos   = find_last_digit_or_char( DIGIT, uORF_coord[i], uORF_end_coord_start_pos );
+			size_t uORF_end_coord_end_pos   = find_last_digit_or_char( DIGIT, uORF_coord[i], uORF_end_coord_start_pos );
 			unsigned int uORF_end_coord_len       = uORF_end_coord_end_pos - uORF_end_coord_start_pos + 1;	
 
 			unsigned int uORF_end_coord = atoi( uORF_coord[i].substr( uORF_end_coord_start_pos, uORF_end_coord_len ).c_str() );
@@ -4292,7 +4610,7 @@ int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table,
 			unsigned int gene_end_coord;
 			unsigned int gene_intergen_start_coord;
 			vector <TFeature> untransl_reg;
-			TFeature fpUTR_intron( string::npos, string::npos );
+			TFeature fpUTR_intron( (unsigned int)string::npos, (unsigned int)string::npos );
 				
 			if( get_gene_coord_from_gff( gene_name[i], 
 										 gff_annotations[chrom_num - 1], 
@@ -4347,7 +4665,7 @@ int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table,
 
 
 
-int extract_uORFs_Ingolia( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Ingolia( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -4389,7 +4707,7 @@ int extract_uORFs_Ingolia( const TCSV_Contents & uORF_table, const vector <strin
 	for( unsigned int i = 0; i < exp_uORF_len.size(); i++ )
 	{
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 		
 		// Relative position is found by adding the lenth to he distance from the end of the uORF to the CDS
@@ -4494,7 +4812,7 @@ int extract_gene_coord_Zhang_Dietrich( const TCSV_Contents & uORF_table,
 		unsigned int gene_end_coord;
 		unsigned int gene_intergen_start_coord;
 		vector <TFeature> untransl_reg;
-		TFeature fpUTR_intron( string::npos, string::npos );
+		TFeature fpUTR_intron( (unsigned int)string::npos, (unsigned int)string::npos );
 			
 		if( get_gene_coord_from_gff( gene_name[i], 
 									 gff_annotations[chrom_num[i] - 1], 
@@ -4538,7 +4856,7 @@ int extract_gene_coord_Zhang_Dietrich( const TCSV_Contents & uORF_table,
 
 
 
-int extract_uORFs_Zhang_Dietrich_NAR( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Zhang_Dietrich_NAR( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -4569,7 +4887,7 @@ int extract_uORFs_Zhang_Dietrich_NAR( const TCSV_Contents & uORF_table, const ve
 	for( unsigned int i = 0; i < exp_uORF_len.size(); i++ )
 	{
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 		
 		
@@ -4603,8 +4921,8 @@ int extract_uORFs_Zhang_Dietrich_NAR( const TCSV_Contents & uORF_table, const ve
 		
 		do
 		{
-			unsigned int search_pos_start = 1;
-			unsigned int AA_seq_start_pos = 0;
+			size_t search_pos_start = 1;
+			size_t AA_seq_start_pos = 0;
 			
 			if( poss_uORF_start_pos_in_UTR.size() != 1 )
 			{
@@ -4710,7 +5028,7 @@ int extract_uORFs_Zhang_Dietrich_NAR( const TCSV_Contents & uORF_table, const ve
 
 
 
-int extract_uORFs_Zhang_Dietrich_CG( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Zhang_Dietrich_CG( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -4742,7 +5060,7 @@ int extract_uORFs_Zhang_Dietrich_CG( const TCSV_Contents & uORF_table, const vec
 	for( unsigned int i = 0; i < exp_uORF_len.size(); i++ )
 	{
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 
 		// Extract the uORF and manipulate it as necessary
@@ -4829,7 +5147,7 @@ int extract_gene_coord_Nagalakshmi( const TCSV_Contents & uORF_table, const vect
 	{
 		// ------------------------------
 		// Find the uORF's chromosome number
-		unsigned int chom_num_start_pos = chrom_num_str[i].find( "chr" ) + ( (string)"chr" ).size();
+		size_t chom_num_start_pos = chrom_num_str[i].find( "chr" ) + ( (string)"chr" ).size();
 		if( chrom_num_str[i].find( "chr" ) == string::npos )
 		{
 			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'extract_gene_coord_Nagalakshmi()': " +
@@ -4837,7 +5155,7 @@ int extract_gene_coord_Nagalakshmi( const TCSV_Contents & uORF_table, const vect
 																   gene_name[i], __FILE__, __LINE__ );
 		}
 		
-		unsigned int chrom_num_end_pos = chrom_num_str[i].size() - 1;
+		size_t chrom_num_end_pos = chrom_num_str[i].size() - 1;
 		unsigned int chrom_num_len = chrom_num_end_pos - chom_num_start_pos + 1;
 				
 		unsigned int chrom_num = convert_roman_numeral_to_uint( chrom_num_str[i].substr( chom_num_start_pos, chrom_num_len ) );
@@ -4865,7 +5183,7 @@ int extract_gene_coord_Nagalakshmi( const TCSV_Contents & uORF_table, const vect
 		unsigned int gene_end_coord;
 		unsigned int gene_intergen_start_coord;
 		vector <TFeature> untransl_reg;
-		TFeature fpUTR_intron( string::npos, string::npos );
+		TFeature fpUTR_intron( (unsigned int)string::npos, (unsigned int)string::npos );
 			
 		if( get_gene_coord_from_gff( gene_name[i], 
 									 gff_annotations[chrom_num - 1], 
@@ -4909,7 +5227,7 @@ int extract_gene_coord_Nagalakshmi( const TCSV_Contents & uORF_table, const vect
 
 
 
-int extract_uORFs_Nagalakshmi( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> *  const ORF_Data, const unsigned int   uORF_data_start_it )
+int extract_uORFs_Nagalakshmi( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> *  const ORF_Data, const unsigned int   uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -4982,14 +5300,14 @@ int extract_uORFs_Nagalakshmi( const TCSV_Contents & uORF_table, const vector <s
 		unsigned int uORF_start_pos;
 
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 		
 		
 		// ------------------------------
 		// Extract the current 5' UTR (assuming the same length as when the data was published), extended into the gene
 		//  in order to account for uORFs that extend into the gene
-		unsigned int gene_start_pos_it = ORF_Data->at( ORF_it ).gene_CDS.start_coord - 1;
+		size_t gene_start_pos_it = ORF_Data->at( ORF_it ).gene_CDS.start_coord - 1;
 		
 		unsigned int UTR_first_coord = gene_start_pos_it + TSS_rel_pos[i];
 		if( ORF_Data->at( ORF_it ).opposite_strand == TRUE ) { UTR_first_coord = gene_start_pos_it + 1 /*- NUM_NT_PAST_GENE_START*/; }
@@ -5019,12 +5337,12 @@ int extract_uORFs_Nagalakshmi( const TCSV_Contents & uORF_table, const vector <s
 		// ------------------------------
 		// Find the expected uORF sequence in the 5' UTR by finding all upstream ATG's and checking for the correct length
 		vector <unsigned int> poss_uORF_start_pos_in_UTR( 0 );
-		unsigned int star_pos_to_search = 0;
+		size_t star_pos_to_search = 0;
 		
 		
 		do
 		{
-			unsigned int poss_uORF_start_pos = five_prime_UTR.find( "ATG", star_pos_to_search );
+			size_t poss_uORF_start_pos = five_prime_UTR.find( "ATG", star_pos_to_search );
 			
 			if( poss_uORF_start_pos < five_prime_UTR.size() )
 			{
@@ -5042,7 +5360,7 @@ int extract_uORFs_Nagalakshmi( const TCSV_Contents & uORF_table, const vector <s
 		
 		// Attempt to find the true uORF
 		vector <unsigned int> poss_uORF_len( poss_uORF_start_pos_in_UTR.size(), FALSE );
-		unsigned int num_poss_length_matches = 0;
+		size_t num_poss_length_matches = 0;
 
 		
 		for( unsigned int j = 0; j < poss_uORF_start_pos_in_UTR.size(); j++ )
@@ -5069,7 +5387,7 @@ int extract_uORFs_Nagalakshmi( const TCSV_Contents & uORF_table, const vector <s
 				uORF_start_pos = ORF_Data->at( ORF_it ).gene_CDS.start_coord + ( five_prime_UTR.size() - poss_uORF_start_pos_in_UTR[j] );
 			}
 		
-			unsigned int uORF_end_pos = find_first_stop_codon( chrom_seq, uORF_start_pos, ORF_Data->at( ORF_it ).opposite_strand );
+			size_t uORF_end_pos = find_first_stop_codon( chrom_seq, uORF_start_pos, ORF_Data->at( ORF_it ).opposite_strand );
 			poss_uORF_len[j] = (unsigned int)( abs( (int)uORF_end_pos - (int)uORF_start_pos ) + 1 );
 			
 			if( poss_uORF_len[j] == exp_uORF_len[i] )
@@ -5331,7 +5649,7 @@ int extract_gene_coord_general( const TCSV_Contents & uORF_table,
 			unsigned int gene_end_coord;
 			unsigned int gene_intergen_start_coord;
 			vector <TFeature> untransl_reg;
-			TFeature fpUTR_intron( string::npos, string::npos );
+			TFeature fpUTR_intron( (unsigned int)string::npos, (unsigned int)string::npos );
 				
 			if( get_gene_coord_from_gff( gene_name[i], 
 										 gff_annotations[chrom_num - 1], 
@@ -5379,7 +5697,7 @@ int extract_gene_coord_general( const TCSV_Contents & uORF_table,
 
 
 
-int extract_uORFs_Cvijovic( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Cvijovic( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -5416,7 +5734,7 @@ int extract_uORFs_Cvijovic( const TCSV_Contents & uORF_table, const vector <stri
 		
 		
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 
 		// Extract the uORF and manipulate it as necessary
@@ -5469,7 +5787,7 @@ int extract_uORFs_Cvijovic( const TCSV_Contents & uORF_table, const vector <stri
 
 
 
-int extract_uORFs_Guan( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Guan( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -5501,7 +5819,7 @@ int extract_uORFs_Guan( const TCSV_Contents & uORF_table, const vector <string>
 	for( unsigned int i = 0; i < exp_uORF_len.size(); i++ )
 	{	
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 
 		// Extract the uORF and manipulate it as necessary
@@ -5555,7 +5873,7 @@ int extract_uORFs_Guan( const TCSV_Contents & uORF_table, const vector <string>
 
 
 
-int extract_uORFs_Lawless( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Lawless( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -5586,7 +5904,7 @@ int extract_uORFs_Lawless( const TCSV_Contents & uORF_table, const vector <strin
 	for( unsigned int i = 0; i < exp_uORF_len.size(); i++ )
 	{	
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 
 		// Extract the uORF and manipulate it as necessary
@@ -5663,7 +5981,7 @@ int extract_uORFs_Lawless( const TCSV_Contents & uORF_table, const vector <strin
 
 
 
-int extract_uORFs_Selpi( const TCSV_Contents & uORF_table, const vector <string> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
+int extract_uORFs_Selpi( const TCSV_Contents & uORF_table, const vector <TPacked_Chrom> & yeast_chromosomes, vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it )
 {
 	unsigned int num_uORFs = 0;
 	
@@ -5701,7 +6019,7 @@ int extract_uORFs_Selpi( const TCSV_Contents & uORF_table, const vector <string>
 		
 		
 		unsigned int ORF_it = i + uORF_data_start_it;
-		string chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
+		const TPacked_Chrom & chrom_seq = yeast_chromosomes[ORF_Data->at( ORF_it ).chrom_num - 1];
 		
 
 		// Extract the uORF and manipulate it as necessary
@@ -5754,7 +6072,7 @@ int extract_uORFs_Selpi( const TCSV_Contents & uORF_table, const vector <string>
 
 
 
-void realign_uORF( const string & chrom_seq,
+void realign_uORF( const TPacked_Chrom & chrom_seq,
 				   const string & gene_name,
 				   const bool opposite_strand,
 				   const string & exp_start_codon,
@@ -5788,7 +6106,6 @@ void realign_uORF( const string & chrom_seq,
 
 	string search_window;
 	unsigned int chrom_it_search_window_it_diff;
-	unsigned int search_window_it = 0;
 
 	if( opposite_strand == FALSE )
 	{
@@ -5827,7 +6144,7 @@ void realign_uORF( const string & chrom_seq,
 		chrom_end_pos_to_search = chrom_seq.size() - 1;
 	}
 
-	search_window = chrom_seq.substr( chrom_start_pos_to_search, ( chrom_end_pos_to_search - chrom_start_pos_to_search + 1 ) );
+	search_window = chrom_seq.get_seq( chrom_start_pos_to_search, ( chrom_end_pos_to_search - chrom_start_pos_to_search + 1 ), opposite_strand );
 
 
 	if( opposite_strand == FALSE )
@@ -5837,9 +6154,6 @@ void realign_uORF( const string & chrom_seq,
 	else
 	{
 		chrom_it_search_window_it_diff = ( chrom_start_pos_to_search - uORF_len + 1 ) + NUM_NT_TO_COMPLETE_CODON;
-		
-		search_window = get_inverted_sequence( search_window );
-		search_window = get_opposite_strand  ( search_window );
 	}
 		
 
@@ -5849,23 +6163,16 @@ void realign_uORF( const string & chrom_seq,
 	
 	
 	// ------------------------------	
-	// Find all start codons in the search window
+	// Find all start codons in the search window, in a single pass over it
 	vector <unsigned int> start_codon_pos_in_window( 0 );
-	bool end_of_window_reached = FALSE;
 
-	do
+	for( unsigned int i = 0; i + 3 <= search_window.size(); i++ )
 	{
-		if( search_window.find( exp_start_codon, search_window_it ) != string::npos )
-		{
-			start_codon_pos_in_window.push_back( search_window.find( exp_start_codon, search_window_it ) );
-			search_window_it = start_codon_pos_in_window.back() + 1;
-		}
-		else
+		if( search_window[i] == exp_start_codon[0] && search_window[i + 1] == exp_start_codon[1] && search_window[i + 2] == exp_start_codon[2] )
 		{
-			end_of_window_reached = TRUE;
+			start_codon_pos_in_window.push_back( i );
 		}
-
-	} while( end_of_window_reached == FALSE );
+	}
 	// ------------------------------	
 	
 	
@@ -5874,15 +6181,15 @@ void realign_uORF( const string & chrom_seq,
 	// If any start codons were found, adjust the uORFs start position accordingly.  Otherwise, do nothing
 	if( start_codon_pos_in_window.size() >= 1 )
 	{
-		unsigned int new_uORF_start_pos_it = start_codon_pos_in_window[0] + chrom_it_search_window_it_diff;
+		size_t new_uORF_start_pos_it = start_codon_pos_in_window[0] + chrom_it_search_window_it_diff;
 		
 		
 		if( start_codon_pos_in_window.size() > 1 )
 		{
 			// In case more than one start codons were found in the window, first check to see if any of the start codons produce a uORF
 			//  of the expected length
-			unsigned int num_poss_length_matches = 0;
-			unsigned int temp_new_uORF_start_pos_it = 0;
+			size_t num_poss_length_matches = 0;
+			size_t temp_new_uORF_start_pos_it = 0;
 			
 			for( unsigned int i = 0; i < start_codon_pos_in_window.size(); i++ )
 			{
@@ -5911,13 +6218,24 @@ void realign_uORF( const string & chrom_seq,
 					start_coord = temp_first_coord_in_chrom_it + 1 + ( uORF_len - 1 );
 				}
 		
-				*uORF_content = extract_DNA_seq( chrom_seq, start_coord, uORF_len, opposite_strand );
+				// Only the codon at the end of the expected length matters, so read just it (rather than the whole uORF)
+				const long uORF_first_coord_it = ( opposite_strand == FALSE ) ? (long)start_coord - 1 : (long)start_coord - (long)uORF_len;
+				
+				// Checked for being negative first, so it can then be compared as a 'size_t'
+				if( uORF_len < 3 || uORF_first_coord_it < 0 || (size_t)uORF_first_coord_it + uORF_len > chrom_seq.size() )
+				{
+					Errors.handle_error( FATAL, "Error in 'realign_uORF()': uORF of the expected length starting at a possible start codon was out of range. ", __FILE__, __LINE__ );
+				}
+				
+				char poss_stop_codon[3];
 				
-				string poss_stop_codon = uORF_content->substr( uORF_content->size() - 3, 3 );
+				if	  ( opposite_strand == FALSE )  { chrom_seq.copy_seq( uORF_first_coord_it + uORF_len - 3, 3, FALSE, poss_stop_codon ); }
+				else/*( opposite_strand == TRUE )*/ { chrom_seq.copy_seq( uORF_first_coord_it, 				 3, TRUE,  poss_stop_codon ); }
 				
 				
 				// Check if a stop codon occurs at the end of the expected length
-				if( poss_stop_codon == "TAA" || poss_stop_codon == "TGA" || poss_stop_codon == "TAG" )
+				if( poss_stop_codon[0] == 'T' && ( ( poss_stop_codon[1] == 'A' && ( poss_stop_codon[2] == 'A' || poss_stop_codon[2] == 'G' ) ) ||
+												   ( poss_stop_codon[1] == 'G' &&   poss_stop_codon[2] == 'A' ) ) )
 				{
 					num_poss_length_matches++;
 					
@@ -5999,14 +6317,14 @@ void realign_uORF( const string & chrom_seq,
 
 	
 
-int uORF_analysis( const string & chrom_seq,
+int uORF_analysis( const TPacked_Chrom & chrom_seq,
 				   const string & gene_name,
 				   const unsigned int gene_start_pos,
 				   const bool opposite_strand,
 				   const bool start_codon_found,
 				   const int rel_uORF_pos,
 				   int uORF_first_coord_in_chrom_it,
-				   const vector <TFeature> untransl_reg,
+				   const TExon_Map & exon_map,
 				   string * const uORF_content,
 				   string * const uORF_start_context,
 				   string * const ext_uORF_start_context,
@@ -6015,9 +6333,12 @@ int uORF_analysis( const string & chrom_seq,
 				   bool * const end_past_gene_start,
 				   bool * const uORF_in_frame )
 {
+	const vector <TFeature> & untransl_reg = exon_map.get_introns();
+	
+	
 	// ------------------------------
 	// Calculate the start and end positions of the uORFs (not string iterators, 1-indexed)
-	unsigned int uORF_end_pos;
+	size_t uORF_end_pos;
 	
 	if( opposite_strand == FALSE )
 	{
@@ -6075,7 +6396,7 @@ int uORF_analysis( const string & chrom_seq,
 		
 		
 		// Extract the extended start context (don't remove introns)
-		unsigned int ext_start_context_start_pos = *uORF_start_pos - ( EXT_START_CONTEXT_NT_BEFORE_AUG * ( opposite_strand == FALSE ? 1 : -1 ) );
+		size_t ext_start_context_start_pos = *uORF_start_pos - ( EXT_START_CONTEXT_NT_BEFORE_AUG * ( opposite_strand == FALSE ? 1 : -1 ) );
 		*ext_uORF_start_context = extract_DNA_seq( chrom_seq, ext_start_context_start_pos, EXT_START_CONTEXT_LENGTH_NT, opposite_strand );
 	}
 	// ------------------------------
@@ -6097,7 +6418,7 @@ int uORF_analysis( const string & chrom_seq,
 	if( start_codon_found == TRUE )
 	{
 		// Find the true end position (altering the uORF's length accordingly)
-		unsigned int true_end_pos = find_first_stop_codon( chrom_seq, *uORF_start_pos, opposite_strand, uORF_len, untransl_reg );
+		size_t true_end_pos = find_first_stop_codon( chrom_seq, *uORF_start_pos, opposite_strand, uORF_len, untransl_reg );
 		
 		
 		if( ( opposite_strand == FALSE && true_end_pos < uORF_end_pos && stop_codon_at_end == TRUE ) ||
@@ -6118,7 +6439,8 @@ int uORF_analysis( const string & chrom_seq,
 		if( true_end_pos != uORF_end_pos )
 		{
 			uORF_end_pos = true_end_pos;
-			*uORF_content = extract_DNA_seq( chrom_seq, *uORF_start_pos, *uORF_len, opposite_strand, untransl_reg );
+			uORF_content->resize( *uORF_len );
+			uORF_content->resize( exon_map.extract( chrom_seq, *uORF_start_pos, *uORF_len, &(*uORF_content)[0] ) );
 		}
 	}
 	// ------------------------------
@@ -6480,7 +6802,7 @@ int parse_uORFs_from_list( vector <TORF_Data> * const ORF_Data,
 			unsigned int gene_end_coord;
 			unsigned int gene_intergen_start_coord;
 			vector <TFeature> untransl_reg;
-			TFeature fpUTR_intron( string::npos, string::npos );
+			TFeature fpUTR_intron( (unsigned int)string::npos, (unsigned int)string::npos );
 				
 			if( get_gene_coord_from_gff( gene_names[i], 
 										 gff_annotations[ gene_chrom_nums[i] - 1 ], 
@@ -6688,8 +7010,8 @@ void write_Miura_SGD_annot_info_to_txt( void )
 	
 	if( annotation_lines.size() != clone_IDs.size() )
 	{
-		Errors.handle_error( FATAL, (string)"Error in 'write_Miura_SGD_annot_info_to_txt()': Number of extracted clone ID's (" + get_str( clone_IDs.size() ) + 
-											") didn't match the number of lines (" + get_str( annotation_lines.size() ) + "). ", __FILE__, __LINE__ );
+		Errors.handle_error( FATAL, (string)"Error in 'write_Miura_SGD_annot_info_to_txt()': Number of extracted clone ID's (" + get_str( (unsigned int)clone_IDs.size() ) + 
+											") didn't match the number of lines (" + get_str( (unsigned int)annotation_lines.size() ) + "). ", __FILE__, __LINE__ );
 	}
 	// ------------------------------
 	
@@ -6786,8 +7108,8 @@ void write_Miura_TSS_data_to_csv( void )
 		
 		hit_start[i] = atoi( hit_start_str[i].c_str() );
 		
-		unsigned int hit_end_start_pos = hit_end_str[i].find( "\t" ) + 1;
-		unsigned int hit_end_end_pos   = find_last_digit_or_char( DIGIT, hit_end_str[i], hit_end_start_pos );
+		size_t hit_end_start_pos = hit_end_str[i].find( "\t" ) + 1;
+		size_t hit_end_end_pos   = find_last_digit_or_char( DIGIT, hit_end_str[i], hit_end_start_pos );
 		hit_end[i] = atoi( hit_end_str[i].substr( hit_end_start_pos, ( hit_end_end_pos - hit_end_start_pos + 1 ) ).c_str() );
 	}
 	// ------------------------------
@@ -6815,7 +7137,7 @@ void write_Miura_TSS_data_to_csv( void )
 	
 	for( unsigned int i = 0; i < chrom_num_table_str.size(); i++ )
 	{
-		unsigned int chr_start_pos = find_first_digit_or_char( DIGIT, chrom_num_table_str[i] );
+		size_t chr_start_pos = find_first_digit_or_char( DIGIT, chrom_num_table_str[i] );
 		
 		if( chr_start_pos != string::npos )
 		{
@@ -7005,11 +7327,11 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector <TORF_Data>
 	for( unsigned int i = 0; i < UTR_coord_raw.size(); i++ )
 	{
 		unsigned int UTR_chrom_num;
-		unsigned int UTR_start_pos;
+		size_t UTR_start_pos;
 		unsigned int UTR_end_pos;
-		unsigned int gene_pos_change;
+		size_t gene_pos_change;
 		unsigned int UTR_length;
-		unsigned int gene_start_pos;
+		size_t gene_start_pos;
 		bool opposite_strand;
 		
 		if( extract_UTR_coord_from_Miura_table_row( UTR_coord_raw[i], 
@@ -7025,7 +7347,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector <TORF_Data>
 		}
 		
 		
-		unsigned int gene_pos = yeast_genbank[UTR_chrom_num - 1].find( (string)"/locus_tag=\"" + gene_name[i] );
+		size_t gene_pos = yeast_genbank[UTR_chrom_num - 1].find( (string)"/locus_tag=\"" + gene_name[i] );
 		
 		if( gene_pos == string::npos ) 
 		{
@@ -7037,7 +7359,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector <TORF_Data>
 		}
 		else
 		{
-			unsigned int CDS_id_pos = yeast_genbank[UTR_chrom_num - 1].find( "CDS", gene_pos );
+			size_t CDS_id_pos = yeast_genbank[UTR_chrom_num - 1].find( "CDS", gene_pos );
 			
 			if( CDS_id_pos == string::npos || CDS_id_pos > yeast_genbank[UTR_chrom_num - 1].find( "gene ", gene_pos ) ) 
 			{
@@ -7049,7 +7371,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector <TORF_Data>
 				return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 			}
 			
-			unsigned int gene_first_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], CDS_id_pos );
+			size_t gene_first_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], CDS_id_pos );
 			
 			if( gene_first_coord_start_pos == string::npos || gene_first_coord_start_pos > yeast_genbank[UTR_chrom_num - 1].find( "gene ", gene_pos ) ) 
 			{
@@ -7058,10 +7380,10 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector <TORF_Data>
 				return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 			}
 			
-			unsigned int gene_first_coord_end_pos = find_last_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_first_coord_start_pos );
+			size_t gene_first_coord_end_pos = find_last_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_first_coord_start_pos );
 			
-			unsigned int gene_second_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], ( gene_first_coord_end_pos + 1 ) );
-			unsigned int gene_second_coord_end_pos   = find_last_digit_or_char ( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_second_coord_start_pos );
+			size_t gene_second_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], ( gene_first_coord_end_pos + 1 ) );
+			size_t gene_second_coord_end_pos   = find_last_digit_or_char ( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_second_coord_start_pos );
 			
 			unsigned int gene_first_coord_len = gene_first_coord_end_pos - gene_first_coord_start_pos + 1;
 			unsigned int gene_first_coord = atoi( yeast_genbank[UTR_chrom_num - 1].substr( gene_first_coord_start_pos, gene_first_coord_len ).c_str() );
@@ -7084,7 +7406,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector <TORF_Data>
 			}
 			
 			vector <TFeature> no_untransl_reg;
-			TFeature no_fpUTR_introns( string::npos, string::npos );
+			TFeature no_fpUTR_introns( (unsigned int)string::npos, (unsigned int)string::npos );
 
 			ORF_Data->push_back( TORF_Data( UTR_chrom_num, gene_name[i], gene_start_pos, gene_pos_change, opposite_strand, "Miura", no_untransl_reg, no_fpUTR_introns ) );
 		}
@@ -7122,9 +7444,9 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TORF_Data
 	for( unsigned int i = 0; i < UTR_coord_raw.size(); i++ )
 	{
 		unsigned int UTR_chrom_num;
-		unsigned int UTR_start_pos;
+		size_t UTR_start_pos;
 		unsigned int UTR_end_pos;
-		unsigned int gene_start_pos;
+		size_t gene_start_pos;
 		bool opposite_strand;
 		
 		if( extract_UTR_coord_from_Miura_table_row( UTR_coord_raw[i], 
@@ -7143,7 +7465,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TORF_Data
 		else*//*( opposite_strand == TRUE )*//* { gene_start_pos = UTR_start_pos - 1; }
 		
 		vector <TFeature> no_untransl_reg;
-		TFeature no_fpUTR_introns( string::npos, string::npos );
+		TFeature no_fpUTR_introns( (unsigned int)string::npos, (unsigned int)string::npos );
 
 		ORF_Data->push_back( TORF_Data( UTR_chrom_num, gene_name[i], gene_start_pos, 0, opposite_strand, "Miura", no_untransl_reg, no_fpUTR_introns ) );
 	}
@@ -7172,9 +7494,9 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TuORF_Dat
 	for( unsigned int i = 0; i < UTR_coord_raw.size(); i++ )
 	{
 		unsigned int UTR_chrom_num;
-		unsigned int UTR_start_pos;
+		size_t UTR_start_pos;
 		unsigned int UTR_end_pos;
-		unsigned int UTR_pos_change;
+		size_t UTR_pos_change;
 		unsigned int UTR_length;
 		bool opposite_strand;
 		
@@ -7191,7 +7513,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TuORF_Dat
 		}
 		
 		
-		unsigned int gene_pos = yeast_genbank[UTR_chrom_num - 1].find( (string)"/locus_tag=\"" + gene_name[i] );
+		size_t gene_pos = yeast_genbank[UTR_chrom_num - 1].find( (string)"/locus_tag=\"" + gene_name[i] );
 		
 		if( gene_pos == string::npos ) 
 		{
@@ -7203,7 +7525,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TuORF_Dat
 		}
 		else
 		{
-			unsigned int CDS_id_pos = yeast_genbank[UTR_chrom_num - 1].find( "CDS", gene_pos );
+			size_t CDS_id_pos = yeast_genbank[UTR_chrom_num - 1].find( "CDS", gene_pos );
 			
 			if( CDS_id_pos == string::npos || CDS_id_pos > yeast_genbank[UTR_chrom_num - 1].find( "gene ", gene_pos ) ) 
 			{
@@ -7215,7 +7537,7 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TuORF_Dat
 				return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 			}
 			
-			unsigned int gene_first_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], CDS_id_pos );
+			size_t gene_first_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], CDS_id_pos );
 			
 			if( gene_first_coord_start_pos == string::npos || gene_first_coord_start_pos > yeast_genbank[UTR_chrom_num - 1].find( "gene ", gene_pos ) ) 
 			{
@@ -7224,10 +7546,10 @@ int extract_gene_coord_Miura( const TCSV_Contents uORF_table, vector < TuORF_Dat
 				return Errors.handle_error( PASS_UP_ONE_LEVEL, error_oss.str(), __FILE__, __LINE__ );
 			}
 			
-			unsigned int gene_first_coord_end_pos = find_last_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_first_coord_start_pos );
+			size_t gene_first_coord_end_pos = find_last_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_first_coord_start_pos );
 			
-			unsigned int gene_second_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], ( gene_first_coord_end_pos + 1 ) );
-			unsigned int gene_second_coord_end_pos   = find_last_digit_or_char ( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_second_coord_start_pos );
+			size_t gene_second_coord_start_pos = find_first_digit_or_char( DIGIT, yeast_genbank[UTR_chrom_num - 1], ( gene_first_coord_end_pos + 1 ) );
+			size_t gene_second_coord_end_pos   = find_last_digit_or_char ( DIGIT, yeast_genbank[UTR_chrom_num - 1], gene_second_coord_start_pos );
 			
 			unsigned int gene_first_coord_len = gene_first_coord_end_pos - gene_first_coord_start_pos + 1;
 			unsigned int gene_first_coord = atoi( yeast_genbank[UTR_chrom_num - 1].substr( gene_first_coord_start_pos, gene_first_coord_len ).c_str() );
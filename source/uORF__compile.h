@@ -51,6 +51,8 @@
 // Standard libraries and related
 #include <string>
 #include <vector>
+#include <utility>
+#include <climits>
 
 // Project-specific header files:  definitions and related information
 #include "defs__general.h"
@@ -60,6 +62,10 @@
 #include "support__file_io.h"
 #include "support__bioinformatics.h"
 
+
+
+#define UNLIMITED_DISTANCE_TO_CAP		INT_MAX		// Upper bound for 'TTSS_Profile' distance ranges that have none
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -220,12 +226,12 @@ enum Tenum_NMD_factors
 class TData_Source
 {
 	private:
-		std::string author;
-		std::string evidence_type;
+		TInterned_String author;
+		TInterned_String evidence_type;
 		
 	public:
-		std::string get_author  ( void ) const;
-		std::string get_evidence( void ) const;
+		TInterned_String get_author  ( void ) const;
+		TInterned_String get_evidence( void ) const;
 		
 		TData_Source( const std::string & paper_author );
 };
@@ -285,13 +291,37 @@ class TuORF_Effect
 
 
 
+// The TSS's (or TL read 5' ends) of an ORF, as sparse weighted events sorted by coordinate, along with running sums of
+//   their weights and weighted coordinates.  The distance from an event to a position (e.g. a uORF start) is
+//   'pos - event coordinate'; sums over the events within any range of distances take O(log n) time, so the TSS
+//   distribution seen by each uORF never has to be laid out position by position
+class TTSS_Profile
+{
+	private:
+		std::vector <int> coord;				// Sorted; relative to 'base_coord'
+		std::vector <double> weight_sum;		// 'weight_sum[i]' is the total weight of events [0, i)
+		std::vector <double> coord_sum;			// 'coord_sum[i]' is the total weight * coord of events [0, i)
+		int base_coord;
+
+		void get_event_range( const int pos, const int min_dist, const int max_dist, unsigned int * const first_it, unsigned int * const last_it ) const;
+
+	public:
+		double get_weight			( const int pos, const int min_dist, const int max_dist = UNLIMITED_DISTANCE_TO_CAP ) const;
+		double get_weighted_distance( const int pos, const int min_dist, const int max_dist = UNLIMITED_DISTANCE_TO_CAP ) const;
+
+		TTSS_Profile( std::vector <std::pair <int, double> > events );
+};
+//==============================================================================
+
+
+
 class TuORF_Data
 {
 	public:
 		std::string content;
 		std::string start_context;
 		std::string ext_start_context;
-		std::vector<unsigned int> context_profile;
+		int context_profile_row;					// Row in the 'TContext_Profile_Matrix' (-1 until profiled)
 		int rel_uORF_pos;
 		unsigned int start_pos;
 		unsigned int len;
@@ -346,7 +376,7 @@ class TORF_Data
 	public:
 		std::string UTR_content;
 				
-		std::string gene_name;
+		TInterned_String gene_name;
 		std::string gene_start_context;
 		std::string ext_gene_start_context;
 		double gene_AUGCAI;
@@ -361,6 +391,8 @@ class TORF_Data
 		double TL_shape_index;
 		std::vector <TFeature> untransl_reg;
 		TFeature fpUTR_intron;
+		TExon_Map exon_map;						// Built from 'untransl_reg' (and 'fpUTR_intron', for the second) when constructed
+		TExon_Map exon_map_w_fpUTR_intron;
 		double CDS_rib_rpkM;
 		double CDS_mRNA_rpkM;
 		double transl_corr;
@@ -393,7 +425,7 @@ class TORF_Data
 		bool matches_GO_term;
 
 		
-		std::vector <TuORF_Data> get_uORFs( void ) const;
+		const std::vector <TuORF_Data> & get_uORFs( void ) const;
 		TuORF_Data get_uORF( unsigned int uORF_it ) const;
 		void delete_uORF   ( unsigned int uORF_it );
 		void add_uORF( const TuORF_Data uORF );
@@ -401,7 +433,7 @@ class TORF_Data
 		int extract_uORF( const int exp_rel_uORF_pos,
 						  const unsigned int exp_uORF_len,
 						  const std::string & exp_start_codon,
-						  const std::string & chrom_seq,
+						  const TPacked_Chrom & chrom_seq,
 						  const std::string & data_source,
 						  unsigned int * const num_realigned_uORFs  = NULL,
 						  unsigned int * const num_misaligned_uORFs = NULL,
@@ -409,7 +441,7 @@ class TORF_Data
 						  const unsigned int num_ribosomes = DEFAULT_NUM_RIBOSOMES,
 						  const unsigned int num_mRNA 	   = DEFAULT_NUM_mRNA );
 		
-		void add_GO_Annotation( const std::string & name_space, const std::string & term, const std::string & evidence, const std::vector <TGO_Annotation> & All_GO_Annotations );
+		void add_GO_Annotation( const std::string & name_space, const TInterned_String & term, const TInterned_String & evidence, const std::vector <TGO_Annotation> & All_GO_Annotations );
 		void sort_tss( void );
 		void add_tss( int new_tss );
 		void add_tss( std::vector <int> new_tss );
@@ -419,7 +451,7 @@ class TORF_Data
 		void update_num_rib( const unsigned int uORF_it, const int new_num_rib, const int new_num_mRNA );
 		void add_source	   ( const unsigned int uORF_it, unsigned int pos_to_add, std::string added_source );
 		void update_source ( const unsigned int uORF_it, std::vector <TData_Source> data_source );
-		void update_context_profile( const unsigned int uORF_it, std::vector <unsigned int> new_context_profile );
+		void update_context_profile_row( const unsigned int uORF_it, const int new_context_profile_row );
 		void update_cluster		   ( const unsigned int uORF_it, int new_cluster );
 		void update_distortion	   ( const unsigned int uORF_it, double new_distortion );
 		void clear_start_pos_change( const unsigned int uORF_it );
@@ -428,13 +460,13 @@ class TORF_Data
 		
 		int add_uORF_transl_effect( const std::string & effect, const std::string & source, const bool hypthothesized, const int uORF_rel_pos );
 		void check_uORF_upstream_of_tss( void );
-		void get_CDI( const std::vector <unsigned int> TL_read_positions, const std::vector <double> TL_read_densities ); 
+		void get_CDI( const std::vector <unsigned int> & TL_read_positions, const std::vector <double> & TL_read_densities ); 
 		
 		void calc_uORF_prob_of_transl( void );
 
 		unsigned int find_uORF( const int uORF_rel_pos ) const;
-		unsigned int find_GO_term	   ( const int GO_namespace_it, const std::string & term, const bool search_parent_terms = FALSE ) const;
-		bool   		 is_GO_term_present( const int GO_namespace_it, const std::string & term, const bool search_parent_terms = FALSE ) const;
+		unsigned int find_GO_term	   ( const int GO_namespace_it, const TInterned_String & term, const bool search_parent_terms = FALSE ) const;
+		bool   		 is_GO_term_present( const int GO_namespace_it, const TInterned_String & term, const bool search_parent_terms = FALSE ) const;
 		void sort_uORFs( void );	
 		
 	
@@ -449,7 +481,7 @@ class TORF_Data
 	    };
 		
 		std::vector <std::vector <std::string> > form_vector_for_csv_rows( const std::vector <Tenum_uORF_CSV_columns> & col_to_write, const unsigned int select_uORFs ) const;
-		int get_gene_start_context( const std::string & chrom_seq );
+		int get_gene_start_context( const TPacked_Chrom & chrom_seq );
 
 
 		TORF_Data( const unsigned int chr_num, 
@@ -465,6 +497,44 @@ class TORF_Data
 };
 //==============================================================================
 
+
+
+// One of the published datasets annotated onto the ORFs in 'determine_ORF_and_uORF_characteristics()'.  Reading and
+//   parsing the file ('parse()') touches only this loader, so the datasets can be parsed concurrently; adding the
+//   parsed data to the ORFs ('apply()') must be done one dataset at a time, in a fixed order.  Datasets too large to
+//   hold in memory at once are instead streamed from their files by their loaders, during 'apply()'
+class TDataset_Loader
+{
+	public:
+		typedef void ( *TCSV_Loader    )( const TCSV_Contents & csv_contents, std::vector <TORF_Data> * const ORF_Data );
+		typedef void ( *TText_Loader   )( const std::string & text_contents,  std::vector <TORF_Data> * const ORF_Data );
+		typedef unsigned int ( *TStream_Loader )( const std::string & file_folder_path, const std::string & file_name, std::vector <TORF_Data> * const ORF_Data );
+
+	private:
+		std::string name;
+		std::string file_name;
+
+		TCSV_Contents csv_contents;
+		std::string text_contents;
+		unsigned int num_records;
+
+		TCSV_Loader    csv_loader;
+		TText_Loader   text_loader;
+		TStream_Loader stream_loader;
+
+	public:
+		std::string get_name( void ) const { return name; }
+		unsigned int get_num_records( void ) const { return num_records; }
+
+		void parse( void );
+		void apply( std::vector <TORF_Data> * const ORF_Data );
+
+		TDataset_Loader( const std::string & loader_name, const std::string & data_file_name, const TCSV_Loader loader );
+		TDataset_Loader( const std::string & loader_name, const std::string & data_file_name, const TText_Loader loader );
+		TDataset_Loader( const std::string & loader_name, const std::string & data_file_name, const TStream_Loader loader );
+};
+//==============================================================================
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -480,35 +550,36 @@ class TORF_Data
 void compile_uORF_list( const TFasta_Content & S_Cerevisiae_Chrom, std::vector <TORF_Data> * const ORF_Data );
 void compile_uORF_list_from_data( const TFasta_Content & S_Cerevisiae_Chrom, std::vector <TORF_Data> * const ORF_Data );
 void add_GO_info_to_ORFs( std::vector <TORF_Data> * const ORF_Data, const std::vector <TGO_Annotation> & All_GO_Annotations );
-void determine_ORF_and_uORF_characteristics( const TFasta_Content & S_Cerevisiae_Chrom, std::vector <TORF_Data> * const ORF_Data );
+void determine_ORF_and_uORF_characteristics( const TFasta_Content & S_Cerevisiae_Chrom, std::vector <TORF_Data> * const ORF_Data, const bool write_outputs = TRUE );
 int  get_uORF_effects_on_gene_translation( std::vector <TORF_Data> * const ORF_Data );
-void get_Miura_TSS_data( std::vector <TORF_Data> * const ORF_Data );
-void get_Zhang_Dietrich_TSS_data( std::vector <TORF_Data> * const ORF_Data );
-void get_Xu_TSS_data( std::vector <TORF_Data> * const ORF_Data );
-void get_Yassour_TSS_data( std::vector <TORF_Data> * const ORF_Data );
-void get_Nagalakshmi_TSS_data( std::vector <TORF_Data> * const ORF_Data );
-void get_David_TSS_data( std::vector <TORF_Data> * const ORF_Data );
+void get_Miura_TSS_data( const TCSV_Contents & Miura_TSS_Data, std::vector <TORF_Data> * const ORF_Data );
+void get_Zhang_Dietrich_TSS_data( const std::string & Zhang_Dietrich_TSS_info, std::vector <TORF_Data> * const ORF_Data );
+void get_Xu_TSS_data( const std::string & Xu_TSS_info, std::vector <TORF_Data> * const ORF_Data );
+void get_Yassour_TSS_data( const std::string & Yassour_TSS_info, std::vector <TORF_Data> * const ORF_Data );
+void get_Nagalakshmi_TSS_data( const std::string & Nagalakshmi_TSS_info, std::vector <TORF_Data> * const ORF_Data );
+void get_David_TSS_data( const std::string & David_TSS_info, std::vector <TORF_Data> * const ORF_Data );
 int  add_TSS_list( const std::vector <unsigned int> & tss_coord_list, const std::vector <std::string> & gene_name_list, std::vector <TORF_Data> * const ORF_Data );
-void get_Brar_translation_data							( std::vector <TORF_Data> * const ORF_Data );
-void get_McManus_translation_data						( std::vector <TORF_Data> * const ORF_Data );
+void get_Brar_translation_data							( const TCSV_Contents & Brar_Translation_Info, std::vector <TORF_Data> * const ORF_Data );
+void get_McManus_translation_data						( const TCSV_Contents & McManus_Translation_Info, std::vector <TORF_Data> * const ORF_Data );
 void add_present_in_uORF_list_col_to_McManus_transl_data( const std::vector <TORF_Data> & ORF_Data );
-void get_Arribere_TL_data								( std::vector <TORF_Data> * const ORF_Data );
-void get_Arribere_SI_data								( std::vector <TORF_Data> * const ORF_Data );     
-void get_Arribere_Cap_Distance_index					( std::vector <TORF_Data> * const ORF_Data );                      
-void get_He_mRNA_change_data      						( std::vector <TORF_Data> * const ORF_Data );
-void get_Lelivelt_mRNA_change_data						( std::vector <TORF_Data> * const ORF_Data );
-void get_Duttagupta_PUB1_binding_data					( std::vector <TORF_Data> * const ORF_Data );
-void get_Duttagupta_PUB1_effects_data					( std::vector <TORF_Data> * const ORF_Data );
-void get_Duttagupta_PUB1_mRNA_half_lives_data			( std::vector <TORF_Data> * const ORF_Data );
-void get_Guan_NMD_sensitive_transcripts_data			( std::vector <TORF_Data> * const ORF_Data );
+void get_Arribere_TL_data								( const TCSV_Contents & Arribere_TL_Data, std::vector <TORF_Data> * const ORF_Data );
+void get_Arribere_SI_data								( const TCSV_Contents & Arribere_Shape_Index_Data, std::vector <TORF_Data> * const ORF_Data );     
+unsigned int get_Arribere_Cap_Distance_index			( const std::string & file_folder_path, const std::string & file_name, std::vector <TORF_Data> * const ORF_Data );
+void get_He_mRNA_change_data      						( const TCSV_Contents & He_mRNA_Data, std::vector <TORF_Data> * const ORF_Data );
+void get_Lelivelt_mRNA_change_data						( const TCSV_Contents & Lelivelt_mRNA_Data, std::vector <TORF_Data> * const ORF_Data );
+void get_Duttagupta_PUB1_binding_data					( const TCSV_Contents & Duttagupta_PUB1_binding, std::vector <TORF_Data> * const ORF_Data );
+void get_Duttagupta_PUB1_effects_data					( const TCSV_Contents & Duttagupta_PUB1_effects, std::vector <TORF_Data> * const ORF_Data );
+void get_Duttagupta_PUB1_mRNA_half_lives_data			( const TCSV_Contents & Duttagupta_PUB1_mRNA_half_lives, std::vector <TORF_Data> * const ORF_Data );
+void get_Guan_NMD_sensitive_transcripts_data			( const TCSV_Contents & Guan_NMD_sensitive_transcripts, std::vector <TORF_Data> * const ORF_Data );
 void get_Guan_uORFs_in_NMD_path_data					( std::vector <TORF_Data> * const ORF_Data );
-void get_Hogan_PUB1_data								( std::vector <TORF_Data> * const ORF_Data );
-void get_Hogan_UPF1_data								( std::vector <TORF_Data> * const ORF_Data );
-void get_Johansson_mRNA_binding_data					( std::vector <TORF_Data> * const ORF_Data );
-void get_Johansson_mRNA_decay_data						( std::vector <TORF_Data> * const ORF_Data );
+void get_Hogan_PUB1_data								( const TCSV_Contents & Hogan_PUB1_data, std::vector <TORF_Data> * const ORF_Data );
+void get_Hogan_UPF1_data								( const TCSV_Contents & Hogan_UPF1_data, std::vector <TORF_Data> * const ORF_Data );
+void get_Johansson_mRNA_binding_data					( const TCSV_Contents & Johansson_mRNA_change_data, std::vector <TORF_Data> * const ORF_Data );
+void get_Johansson_mRNA_decay_data						( const TCSV_Contents & Johansson_mRNA_change_data, std::vector <TORF_Data> * const ORF_Data );
 
 
 
+unsigned int find_ORF( const TInterned_String & gene_name, const std::vector <TORF_Data> & ORF_Data );
 unsigned int find_ORF( const std::string & gene_name, const std::vector <TORF_Data> & ORF_Data );
 
 TCSV_Contents * extract_uORF_rows_from_Miura_table( void );
@@ -525,31 +596,31 @@ int extract_UTR_coord_from_Miura_table_row( const std::string & UTR_coord_raw,
 											unsigned int * const UTR_length = NULL );
 									  
 
-int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it );
+int extract_uORFs_Miura( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int uORF_data_start_it );
 
 
 int extract_gene_coord_Ingolia( const TCSV_Contents & uORF_table, 
 							    const std::vector <std::string> & gff_annotations, 
-							    const std::vector <std::string> & yeast_chromosomes, 
+							    const std::vector <TPacked_Chrom> & yeast_chromosomes, 
 							    std::vector <TORF_Data> * const ORF_Data, 
 							    unsigned int * const uORF_data_start_it );
 							   
-int extract_uORFs_Ingolia			 ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );
+int extract_uORFs_Ingolia			 ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );
 int extract_gene_coord_Zhang_Dietrich( const TCSV_Contents & uORF_table, const std::vector <std::string> & gff_annotations,   std::vector <TORF_Data> * const ORF_Data, unsigned int * const uORF_data_start_it );								   
-int extract_uORFs_Zhang_Dietrich_NAR ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );
-int extract_uORFs_Zhang_Dietrich_CG  ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );									   
+int extract_uORFs_Zhang_Dietrich_NAR ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );
+int extract_uORFs_Zhang_Dietrich_CG  ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );									   
 int extract_gene_coord_Nagalakshmi	 ( const TCSV_Contents & uORF_table, const std::vector <std::string> & gff_annotations,   std::vector <TORF_Data> * const ORF_Data, unsigned int * const uORF_data_start_it );
-int extract_uORFs_Nagalakshmi     	 ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );
+int extract_uORFs_Nagalakshmi     	 ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> * const ORF_Data, const unsigned int   uORF_data_start_it );
 int extract_gene_coord_general		 ( const TCSV_Contents & uORF_table, const std::vector <std::string> & gff_annotations,   std::vector <TORF_Data> * const ORF_Data, unsigned int * const uORF_data_start_it );
 								
-int extract_uORFs_Cvijovic( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
-int extract_uORFs_Guan    ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
-int extract_uORFs_Lawless ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
-int extract_uORFs_Selpi   ( const TCSV_Contents & uORF_table, const std::vector <std::string> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
+int extract_uORFs_Cvijovic( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
+int extract_uORFs_Guan    ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
+int extract_uORFs_Lawless ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
+int extract_uORFs_Selpi   ( const TCSV_Contents & uORF_table, const std::vector <TPacked_Chrom> & yeast_chromosomes, std::vector <TORF_Data> *  const ORF_Data, const unsigned int uORF_data_start_it );
 
 								  
 
-void realign_uORF( const std::string & chrom_seq,
+void realign_uORF( const TPacked_Chrom & chrom_seq,
 				   const std::string & gene_name,
 				   const bool opposite_strand,
 				   const std::string & exp_start_codon,
@@ -560,14 +631,14 @@ void realign_uORF( const std::string & chrom_seq,
 				   int * const num_nt_start_moved,
 				   bool * const start_codon_found  );
 
-int uORF_analysis( const std::string & chrom_seq,
+int uORF_analysis( const TPacked_Chrom & chrom_seq,
 				   const std::string & gene_name,
 				   const unsigned int gene_start_pos,
 				   const bool opposite_strand,
 				   const bool start_codon_found,
 				   const int rel_uORF_pos,
 				   int uORF_first_coord_in_chrom_it,
-				   const std::vector <TFeature> untransl_reg,
+				   const TExon_Map & exon_map,
 				   std::string * const uORF_content,
 				   std::string * const uORF_start_context,
 				   std::string * const ext_uORF_start_context,
@@ -41,12 +41,20 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <windows.h>
 #include <sstream>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <algorithm>   	// For find()
+#include <utility>   		// For move()
 #include <cmath>   		// For log2()
+#include <cstdlib>   	// For posix_memalign(), free()
+#include <cstring>   	// For memset()
+#include <stdint.h>
+
+#ifdef _WIN32
+	#include <malloc.h>	// For _aligned_malloc(), _aligned_free()
+#endif
 
 using namespace std;
 
@@ -56,9 +64,12 @@ using namespace std;
 
 // Project-specific header files:  support functions and related
 #include "support__file_io.h"
+#include "support__filesystem.h"
 #include "support__general.h"
 #include "support__bioinformatics.h"
 #include "uORF__compile.h"
+#include "support__parallel.h"
+#include "support__columnar_io.h"
 
 // External header files
 #include "lbg_clustering.h"
@@ -66,6 +77,10 @@ using namespace std;
 // Header file for this file
 #include "uORF__process.h"
 
+
+
+static unsigned int get_context_nt_rank( const char nt );		// Defined below, with the functions that use it
+
 //==============================================================================
 
 
@@ -92,6 +107,244 @@ extern TErrors Errors;						// Stores information about errors and responds to t
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+//==============================================================================
+
+TNt_Pair_Counts::TNt_Pair_Counts( void ) :
+	num_instances_each_pair	   ( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, vector <unsigned long>( NUM_NUCLEOTIDE_PAIRS, 0 ) ),
+	num_instances_each_distance( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, 0 ),
+	num_instances_each_nt	   ( NUM_DIFF_NT, 0 ),
+	num_nt					   ( 0 )
+{ }
+//------------------------------------------------------------------------------
+
+
+// Count the nucleotides 'strand[start_pos]' through 'strand[start_pos + length - 1]', and the pairs among them whose
+//   first nucleotide is one of the first 'num_pair_starts', reading each nucleotide from the packed genome once
+void TNt_Pair_Counts::add_segment( const TStrand_View & strand, const size_t start_pos, const size_t length, const size_t num_pair_starts )
+{
+	// Nucleotides in 'Tenum_nucleotides' order, by their rank from 'get_context_nt_rank()'
+	static const Tenum_nucleotides nt_by_rank[NUM_DIFF_NT] = { NT_A, NT_T, NT_C, NT_G };
+	
+	vector <unsigned char> nt_ranks( length );
+	
+	for( size_t j = 0; j < length; j++ )
+	{
+		nt_ranks[j] = get_context_nt_rank( strand[ start_pos + j ] );
+		
+		if( nt_ranks[j] != NUM_DIFF_NT ) { num_instances_each_nt[ nt_by_rank[ nt_ranks[j] ] ]++; }
+	}
+	
+	num_nt += length;
+	
+	
+	for( size_t k = MIN_NUM_BASES_APART; k <= MAX_NUM_BASES_APART && k < length; k++ )
+	{
+		vector <unsigned long> & num_instances_at_k = num_instances_each_pair[ k - MIN_NUM_BASES_APART ];
+		const size_t num_pairs = ( num_pair_starts < length - k ) ? num_pair_starts : length - k;
+		
+		num_instances_each_distance[ k - MIN_NUM_BASES_APART ] += num_pairs;
+		
+		for( size_t j = 0; j < num_pairs; j++ )
+		{	
+			if( nt_ranks[j] == NUM_DIFF_NT || nt_ranks[j + k] == NUM_DIFF_NT )
+			{
+				Errors.handle_error( FATAL, "Error in 'TNt_Pair_Counts::add_segment()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
+			}
+			
+			num_instances_at_k[ nt_ranks[j] * NUM_DIFF_NT + nt_ranks[j + k] ]++;
+		}
+	}
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+void TNt_Pair_Counts::get_probs( vector <vector <double> > * const joint_prob_nt, vector <double> * const marginal_prob_nt ) const
+{
+	*joint_prob_nt    = vector <vector <double> >( num_instances_each_pair.size(), vector <double>( NUM_NUCLEOTIDE_PAIRS, 0 ) );
+	*marginal_prob_nt = vector <double>			 ( NUM_DIFF_NT, 0 );
+	
+	for( unsigned int i = 0; i < num_instances_each_pair.size(); i++ )
+	{
+		for( unsigned int j = 0; j < num_instances_each_pair[i].size(); j++ )
+		{
+			(*joint_prob_nt)[i][j] = (double)num_instances_each_pair[i][j] / num_instances_each_distance[i];
+		}
+	}
+	
+	for( unsigned int i = 0; i < num_instances_each_nt.size(); i++ )
+	{
+		(*marginal_prob_nt)[i] = (double)num_instances_each_nt[i] / num_nt;
+	}
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+//==============================================================================
+
+
+
+void TContext_Profile_Matrix::free_values( void )
+{
+	#ifdef _WIN32
+		_aligned_free( values );
+	#else
+		free( values );
+	#endif
+	
+	values 	  = NULL;
+	num_rows  = 0;
+	dimension = 0;
+	rows.clear();
+	
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Replace the matrix with one of 'new_num_rows' rows of 'new_dimension' zeros
+int TContext_Profile_Matrix::resize( const unsigned int new_num_rows, const unsigned int new_dimension )
+{
+	free_values();
+	
+	const size_t num_bytes = (size_t)new_num_rows * new_dimension * sizeof( float );
+	
+	if( num_bytes == 0 ) { return SUCCESSFUL; }
+	
+	#ifdef _WIN32
+		values = (float *)_aligned_malloc( num_bytes, CONTEXT_PROFILE_ALIGNMENT );
+	#else
+		void * aligned_values = NULL;
+		if( posix_memalign( &aligned_values, CONTEXT_PROFILE_ALIGNMENT, num_bytes ) == 0 ) { values = (float *)aligned_values; }
+	#endif
+	
+	if( values == NULL )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TContext_Profile_Matrix::resize()': Unable to allocate " + get_str( new_num_rows ) + 
+															   " context profiles of dimension " + get_str( new_dimension ) + ". ", __FILE__, __LINE__ );
+	}
+	
+	memset( values, 0, num_bytes );
+	
+	num_rows  = new_num_rows;
+	dimension = new_dimension;
+	
+	rows.resize( num_rows );
+	for( unsigned int i = 0; i < num_rows; i++ ) { rows[i] = get_row( i ); }
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Write the matrix as "uCTX", the number of rows, the dimension, and the value type (each as an 'unsigned int'), then
+//   every value, row by row.  Context profiles are counts, so PROFILE_VALUE_UINT16 stores them exactly in half the space
+int TContext_Profile_Matrix::write( const string & file_folder_path, const string & file_name, const Tenum_profile_value_types value_type ) const
+{
+	const size_t num_values = (size_t)num_rows * dimension;
+	
+	string file_contents( "uCTX" );
+	append_binary_value( &file_contents, num_rows  );
+	append_binary_value( &file_contents, dimension );
+	append_binary_value( &file_contents, (unsigned int)value_type );
+	
+	if( value_type == PROFILE_VALUE_FLOAT )
+	{
+		file_contents.append( (const char *)values, num_values * sizeof( float ) );
+	}
+	else/*( value_type == PROFILE_VALUE_UINT16 )*/
+	{
+		vector <uint16_t> narrowed_values( num_values, 0 );
+		
+		for( size_t i = 0; i < num_values; i++ )
+		{
+			if( values[i] < 0 || values[i] > UINT16_MAX || values[i] != (float)(uint16_t)values[i] )
+			{
+				return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TContext_Profile_Matrix::write()': Value " + get_str( (double)values[i] ) + 
+																	   " (row " + get_str( (unsigned int)( i / dimension ) ) + ") can't be stored as a 16-bit count. ", __FILE__, __LINE__ );
+			}
+			
+			narrowed_values[i] = (uint16_t)values[i];
+		}
+		
+		if( num_values > 0 ) { file_contents.append( (const char *)&narrowed_values[0], num_values * sizeof( uint16_t ) ); }
+	}
+	
+	if( write_file_contents( file_folder_path, file_name, file_contents, YES, YES ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TContext_Profile_Matrix::write()': ", __FILE__, __LINE__ );
+	}
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Read a matrix written by 'write()' (of either value type), replacing this one
+int TContext_Profile_Matrix::read( const string & file_folder_path, const string & file_name )
+{
+	const string full_file_path = get_file_path( file_folder_path, file_name );
+	
+	ifstream ifstream_file( full_file_path.c_str(), ifstream::in | ifstream::binary );
+	
+	if( ifstream_file.fail() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TContext_Profile_Matrix::read()': Unable to open file \"" + full_file_path + "\". ", __FILE__, __LINE__ );
+	}
+	
+	
+	char magic[4] = { 0, 0, 0, 0 };
+	unsigned int file_num_rows   = 0;
+	unsigned int file_dimension  = 0;
+	unsigned int file_value_type = NUM_PROFILE_VALUE_TYPES;
+	
+	ifstream_file.read( magic, 4 );
+	ifstream_file.read( (char *)&file_num_rows,   sizeof( file_num_rows   ) );
+	ifstream_file.read( (char *)&file_dimension,  sizeof( file_dimension  ) );
+	ifstream_file.read( (char *)&file_value_type, sizeof( file_value_type ) );
+	
+	if( ifstream_file.fail() || string( magic, 4 ) != "uCTX" || file_value_type >= NUM_PROFILE_VALUE_TYPES )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TContext_Profile_Matrix::read()': \"" + full_file_path + "\" is not a context profile file. ", __FILE__, __LINE__ );
+	}
+	
+	if( resize( file_num_rows, file_dimension ) )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TContext_Profile_Matrix::read()': ", __FILE__, __LINE__ );
+	}
+	
+	
+	// The values are read straight into the matrix (or, if stored as 16-bit counts, read as one block and then widened)
+	const size_t num_values = (size_t)num_rows * dimension;
+	
+	if( file_value_type == PROFILE_VALUE_FLOAT )
+	{
+		ifstream_file.read( (char *)values, num_values * sizeof( float ) );
+	}
+	else/*( file_value_type == PROFILE_VALUE_UINT16 )*/
+	{
+		vector <uint16_t> narrowed_values( num_values, 0 );
+		
+		if( num_values > 0 ) { ifstream_file.read( (char *)&narrowed_values[0], num_values * sizeof( uint16_t ) ); }
+		
+		for( size_t i = 0; i < num_values; i++ ) { values[i] = narrowed_values[i]; }
+	}
+	
+	if( ifstream_file.fail() )
+	{
+		free_values();
+		
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TContext_Profile_Matrix::read()': \"" + full_file_path + "\" ends before its last profile. ", __FILE__, __LINE__ );
+	}
+	
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+//==============================================================================
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -110,7 +363,19 @@ void sort_and_consolidate( vector <TORF_Data> * const ORF_Data )
 {
 	if( ORF_SORTING_METHOD != DONT_SORT_ORFS )
 	{
-		sort( ORF_Data->begin(), ORF_Data->end(), compare_ORF_positions );
+		// The ORFs are sorted by (position, index) keys, then moved into place once
+		vector <TORF_Sort_Key> sort_keys;
+		sort_keys.reserve( ORF_Data->size() );
+		
+		for( unsigned int i = 0; i < ORF_Data->size(); i++ ) { sort_keys.push_back( TORF_Sort_Key( ORF_Data->at( i ), i ) ); }
+		
+		parallel_stable_sort( &sort_keys, compare_ORF_sort_keys );
+		
+		vector <unsigned int> ORF_order( sort_keys.size() );
+		for( unsigned int i = 0; i < ORF_order.size(); i++ ) { ORF_order[i] = sort_keys[i].ORF_it; }
+		
+		permute_ORFs( ORF_order, ORF_Data );
+		
 
 		combine_uORFs_by_gene( ORF_Data );
 
@@ -202,7 +467,15 @@ void sort_ORFs_by_GO_terms( const string & GO_namespace_to_sort, vector <TORF_Da
 	}
 	
 	
-	// Perform the sorting
+	// Perform the sorting.  Only the ORFs' order is sorted (as (GO term, position, index) keys), each level's segments
+	//   at once; the ORFs themselves are moved into that order once all of the levels are sorted
+	vector <unsigned int> ORF_order( ORF_Data->size() );
+	for( unsigned int i = 0; i < ORF_order.size(); i++ ) { ORF_order[i] = i; }
+	
+	// Segment 'i' is positions [ segment_begin_pos[i], segment_end_pos[i] ) of 'ORF_order'
+	vector <size_t> segment_begin_pos( 1, 0 				);
+	vector <size_t> segment_end_pos  ( 1, ORF_order.size() );
+	
 	for( unsigned int curr_level = 1; curr_level <= namespace_max_level; curr_level++ )
 	{
 		ostringstream output_oss;
@@ -242,69 +515,89 @@ void sort_ORFs_by_GO_terms( const string & GO_namespace_to_sort, vector <TORF_Da
 		{
 			unsigned int num_segments_to_sort = 0;
 			
-			if( segment_end_it.size() != segment_begin_it.size() )
+			if( segment_end_pos.size() != segment_begin_pos.size() )
 			{ 
 				Errors.handle_error( FATAL, (string)"Error in 'sort_ORFs_by_GO_terms()': Sizes of segment end and segment begin vectors don't match. ", __FILE__, __LINE__ ); 
 			
 			}
-			for( unsigned int i = 0; i < segment_end_it.size(); i++ )
+			
+			// Keyed by segment first, so the keys of each segment sort to the positions that segment covers (in order)
+			vector <TORF_Sort_Key> sort_keys;
+			
+			for( unsigned int i = 0; i < segment_end_pos.size(); i++ )
+			{
+				for( size_t pos = segment_begin_pos[i]; pos < segment_end_pos[i]; pos++ )
+				{
+					sort_keys.push_back( TORF_Sort_Key( ORF_Data->at( ORF_order[pos] ), ORF_order[pos], i, TRUE ) );
+				}
+			}
+			
+			parallel_stable_sort( &sort_keys, compare_ORF_sort_keys );
+			
+			unsigned int key_it = 0;
+			
+			for( unsigned int i = 0; i < segment_end_pos.size(); i++ )
 			{
-				stable_sort( segment_begin_it[i], segment_end_it[i], compare_ORF_GO_terms );
+				for( size_t pos = segment_begin_pos[i]; pos < segment_end_pos[i]; pos++ ) { ORF_order[pos] = sort_keys[ key_it++ ].ORF_it; }
 			}
 		
 		
-			segment_begin_it.clear();
-			segment_end_it.clear();
+			segment_begin_pos.clear();
+			segment_end_pos.clear();
 
 
-			string prev_GO_term = ORF_Data->at( 0 ).GO_term_to_sort_curr_level;
+			string prev_GO_term = ORF_Data->at( ORF_order[0] ).GO_term_to_sort_curr_level;
 			
 			if( prev_GO_term != "" )
 			{
-				segment_begin_it.push_back( ORF_Data->begin() );
+				segment_begin_pos.push_back( 0 );
 			}
 
-			for( unsigned int curr_it = 1; curr_it < ORF_Data->size(); curr_it++ )
+			for( unsigned int curr_it = 1; curr_it < ORF_order.size(); curr_it++ )
 			{
-				if( prev_GO_term != ORF_Data->at( curr_it ).GO_term_to_sort_curr_level )
+				const string & curr_GO_term = ORF_Data->at( ORF_order[curr_it] ).GO_term_to_sort_curr_level;
+				
+				if( prev_GO_term != curr_GO_term )
 				{
 					if( prev_GO_term != "" )
 					{
-						segment_end_it.push_back  ( ORF_Data->begin() + curr_it );
+						segment_end_pos.push_back( curr_it );
 						num_segments_to_sort++;
 						
 						// output_oss.str( "" );
 						// output_oss << "Segment to sort " << num_segments_to_sort << ": " 
-						//			  << "begin it: "  << (int)( segment_begin_it.back() - ORF_Data->begin() ) 
-						//			  << "   end it: " << (int)( segment_end_it.back() - ORF_Data->begin() ) 
+						//			  << "begin pos: "  << segment_begin_pos.back() 
+						//			  << "   end pos: " << segment_end_pos.back() 
 						//			  << "   prev go: " << prev_GO_term;
 						// output_text_line( output_oss.str() );
 					}
 					
 					
-					if( ORF_Data->at( curr_it ).GO_term_to_sort_curr_level != "" )
+					if( curr_GO_term != "" )
 					{
-						segment_begin_it.push_back( ORF_Data->begin() + curr_it );
+						segment_begin_pos.push_back( curr_it );
 					}
 					
-					prev_GO_term = ORF_Data->at( curr_it ).GO_term_to_sort_curr_level;
+					prev_GO_term = curr_GO_term;
 				}
 			}
 			
-			if( ORF_Data->size() > 1 && segment_end_it.size() != segment_begin_it.size() )
+			if( ORF_order.size() > 1 && segment_end_pos.size() != segment_begin_pos.size() )
 			{
 				num_segments_to_sort++;
-				segment_end_it.push_back( ORF_Data->end() );
+				segment_end_pos.push_back( ORF_order.size() );
 				
 				// output_oss.str( "" );
 				// output_oss << "Segment to sort " << num_segments_to_sort << ": " 
-				//			  << "begin it: "  << (int)( segment_begin_it.back() - ORF_Data->begin() ) 
-				//			  << "   end it: " << (int)( segment_end_it.back() - ORF_Data->begin() ) 
+				//			  << "begin pos: "  << segment_begin_pos.back() 
+				//			  << "   end pos: " << segment_end_pos.back() 
 				//			  << "   prev go: " << prev_GO_term;
 				// output_text_line( output_oss.str() );
 			}
 		}
 	}
+	
+	permute_ORFs( ORF_order, ORF_Data );
 
 	return;
 }
@@ -322,7 +615,7 @@ void sort_ORFs_by_GO_terms( const string & GO_namespace_to_sort, vector <TORF_Da
 		
 		output_text_line( (string)"Namespace: " + ORF_Data->at( 0 ).GO_Annotations[i].GO_namespace );
 		
-		vector <string> all_terms;
+		vector <TInterned_String> all_terms;
 		
 		for( unsigned int j = 0; j < ORF_Data->size(); j++ )
 		{
@@ -525,10 +818,10 @@ void check_for_matching_GO_terms( vector <TORF_Data> * const ORF_Data )
 		const string TERM_ID 	  = "\nname: ";
 		const string NAMESPACE_ID = "\nnamespace: ";
 
-		unsigned int term_start_pos = GO_database_contents.find( TERM_ID + searched_GO_terms[i] );
+		size_t term_start_pos = GO_database_contents.find( TERM_ID + searched_GO_terms[i] );
 	
-		unsigned int namespace_start_pos = GO_database_contents.find( NAMESPACE_ID, term_start_pos ) + NAMESPACE_ID.size();
-		unsigned int namespace_end_pos   = GO_database_contents.find( '\n', namespace_start_pos ) -1;
+		size_t namespace_start_pos = GO_database_contents.find( NAMESPACE_ID, term_start_pos ) + NAMESPACE_ID.size();
+		size_t namespace_end_pos   = GO_database_contents.find( '\n', namespace_start_pos ) -1;
 
 		if( namespace_start_pos == string::npos )
 		{
@@ -642,6 +935,52 @@ bool compare_ORF_GO_terms( const TORF_Data & ORF_1, const TORF_Data & ORF_2 )
 
 
 
+// Within a segment, the same order as 'compare_ORF_GO_terms()' (or, if the keys have no GO terms, 'compare_ORF_positions()')
+bool compare_ORF_sort_keys( const TORF_Sort_Key & key_1, const TORF_Sort_Key & key_2 )
+{
+	if( key_1.segment_it != key_2.segment_it ) { return ( key_1.segment_it < key_2.segment_it ); }
+	
+	if( key_1.GO_term != NULL )
+	{
+		const int GO_term_comparison = key_1.GO_term->compare( *key_2.GO_term );
+		
+		// ORFs without a GO term at this level go last
+		if( GO_term_comparison != 0 )
+		{
+			if	   ( key_1.GO_term->empty() == TRUE ) { return ORF_2_BEFORE_ORF_1; 		}
+			else if( key_2.GO_term->empty() == TRUE ) { return ORF_1_BEFORE_ORF_2; 		}
+			else									  { return ( GO_term_comparison < 0 ); }
+		}
+	}
+	
+	return ( key_1.position < key_2.position );
+}
+//==============================================================================
+
+
+
+// Reorder the ORFs so that the 'i'th is the one that was at 'ORF_order[i]' (a permutation of the ORFs' indices).  Each
+//   ORF is moved once, rather than repeatedly as in a sort of the ORFs themselves
+void permute_ORFs( const vector <unsigned int> & ORF_order, vector <TORF_Data> * const ORF_Data )
+{
+	if( ORF_order.size() != ORF_Data->size() )
+	{
+		Errors.handle_error( FATAL, "Error in 'permute_ORFs()': The order doesn't cover every ORF. ", __FILE__, __LINE__ );
+	}
+	
+	vector <TORF_Data> sorted_ORF_Data;
+	sorted_ORF_Data.reserve( ORF_Data->size() );
+	
+	for( unsigned int i = 0; i < ORF_order.size(); i++ ) { sorted_ORF_Data.push_back( std::move( (*ORF_Data)[ ORF_order[i] ] ) ); }
+	
+	ORF_Data->swap( sorted_ORF_Data );
+	
+	return;
+}
+//==============================================================================
+
+
+
 void write_uORFs_to_csv( const vector <TORF_Data> & ORF_Data, const vector <Tenum_uORF_CSV_columns> & col_to_write, const unsigned int select_uORFs, const bool & file_naming_method )
 {
 	vector <vector <string> > vector_to_write( 1, vector <string> ( 0, "" ) );
@@ -743,11 +1082,24 @@ void write_uORFs_to_csv( const vector <TORF_Data> & ORF_Data, const vector <Tenu
 	}
 
 
-	if( write_2d_vector_to_csv( PATH_OUTPUT_FOLDER, get_uORF_list_file_name( file_naming_method, WRITE ), vector_to_write ) )
+	const string uORF_list_file_name = get_uORF_list_file_name( file_naming_method, WRITE );
+	
+	if( write_2d_vector_to_csv( PATH_OUTPUT_FOLDER, uORF_list_file_name, vector_to_write ) )
 	{
 		Errors.handle_error( FATAL, "Error in 'write_uORFs_to_csv()': Failed to write uORF list to CSV file. ", __FILE__, __LINE__ );
 	}
 	
+#ifdef WRITE_COLUMNAR_uORF_LIST
+	// The same table, column by column (under the CSV file's name, with the columnar extension), for analysis tools to
+	//   scan without parsing text
+	const string columnar_file_name = uORF_list_file_name.substr( 0, uORF_list_file_name.rfind( CSV_FILE_EXTENSION ) ) + COLUMNAR_FILE_EXTENSION;
+	
+	if( write_columnar_table( PATH_OUTPUT_FOLDER, columnar_file_name, vector_to_write ) )
+	{
+		Errors.handle_error( FATAL, "Error in 'write_uORFs_to_csv()': Failed to write uORF list to columnar file. ", __FILE__, __LINE__ );
+	}
+#endif
+	
 	
 	return;
 }
@@ -1076,123 +1428,118 @@ void count_nucleotides( const TFasta_Content & S_Cerevisiae_Chrom )
 
 
 
-void calc_joint_prob_nt_genes( const TFasta_Content & S_Cerevisiae_Chrom, const vector <TORF_Data> & ORF_Data, vector <vector <double> > * const joint_prob_nt, vector <double> * const marginal_prob_nt )
+// A gene's CDS, as positions along its strand (as 'TGenome_Segment' counts them)
+static TGenome_Segment get_CDS_strand_pos( const TGenome_Partition & genome_partition, const TORF_Data & gene )
 {
-	vector <vector <unsigned int> > num_instances_each_pair( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, vector <unsigned int>( NUM_NUCLEOTIDE_PAIRS, 0 ) );
-	*joint_prob_nt = vector <vector <double> >   		   ( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, vector <double		>( NUM_NUCLEOTIDE_PAIRS, 0 ) );
-	
-	vector <unsigned int> num_instances_each_distance( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, 0 );
+	const unsigned int chrom_it = gene.chrom_num - 1;
+	unsigned int CDS_start_pos;
 	
+	if	  ( gene.opposite_strand == FALSE )  { CDS_start_pos = gene.gene_CDS.start_coord - 1; }
+	else/*( gene.opposite_strand == TRUE )*/ { CDS_start_pos = genome_partition.get_strand( chrom_it, TRUE ).size() - gene.gene_CDS.start_coord; }
 	
-	vector <unsigned int> num_instances_each_nt( NUM_DIFF_NT, 0 );
-	*marginal_prob_nt = vector <double>		   ( NUM_DIFF_NT, 0 );
+	return TGenome_Segment( chrom_it, gene.opposite_strand, CDS_start_pos, gene.gene_CDS.length );
+}
+//==============================================================================
+
+
+
+// Build the partition of the genome used by the nucleotide statistics below.  The SGD GFF annotates CDS's and introns
+//   but not 5' TL's, so each gene's TL is taken to run from its most upstream TSS to the nucleotide before its CDS
+void build_genome_partition( const TFasta_Content & S_Cerevisiae_Chrom, const vector <TORF_Data> & ORF_Data, TGenome_Partition * const genome_partition )
+{
+	vector <TGenome_Feature> TL_features;
 	
-	unsigned int num_nt= 0;
+	for( unsigned int i = 0; i < ORF_Data.size(); i++ )
+	{
+		if( ORF_Data[i].tss_rel_pos.empty() == TRUE ) { continue; }
+		
+		const unsigned int CDS_start_coord = ORF_Data[i].gene_CDS.start_coord;
+		const unsigned int TL_length	   = (-1) * ORF_Data[i].tss_rel_pos[0];
+		
+		if( ORF_Data[i].opposite_strand == FALSE )  
+		{ 
+			if( TL_length >= CDS_start_coord ) { continue; }
+			
+			TL_features.push_back( TGenome_Feature( ORF_Data[i].chrom_num - 1, FALSE, CDS_start_coord - TL_length, CDS_start_coord - 1, SEGMENT_5_PRIME_TL ) );
+		}
+		else/*( ORF_Data[i].opposite_strand == TRUE )*/ 
+		{ 
+			if( CDS_start_coord + TL_length > S_Cerevisiae_Chrom.sequence[ ORF_Data[i].chrom_num - 1 ].size() ) { continue; }
+			
+			TL_features.push_back( TGenome_Feature( ORF_Data[i].chrom_num - 1, TRUE, CDS_start_coord + 1, CDS_start_coord + TL_length, SEGMENT_5_PRIME_TL ) );
+		}
+	}
 	
+	genome_partition->build( S_Cerevisiae_Chrom, TL_features );
 	
-	vector <vector <string> > chrom_seq( 2, vector <string>( S_Cerevisiae_Chrom.sequence.size(), "" ) );
+	return;
+}
+//==============================================================================
+
+
+
+// Joint probabilities of the nucleotides 'k' bases apart, and marginal probabilities, over every segment of the given types
+void calc_joint_prob_nt_segments( const TGenome_Partition & genome_partition, const vector <Tenum_genome_segment_types> & segment_types, vector <vector <double> > * const joint_prob_nt, vector <double> * const marginal_prob_nt )
+{
+	TNt_Pair_Counts nt_pair_counts;
 	
-	for( unsigned int chrom_it = 0; chrom_it < S_Cerevisiae_Chrom.sequence.size(); chrom_it++ )
+	for( unsigned int i = 0; i < segment_types.size(); i++ )
 	{
-		chrom_seq[STRAND_W][chrom_it] = S_Cerevisiae_Chrom.sequence[ chrom_it ];
+		const vector <TGenome_Segment> & segments = genome_partition.get_segments( segment_types[i] );
 		
-		chrom_seq[STRAND_C][chrom_it] = get_inverted_sequence( chrom_seq[STRAND_W][chrom_it] );
-		chrom_seq[STRAND_C][chrom_it] = get_opposite_strand  ( chrom_seq[STRAND_C][chrom_it] );
+		for( unsigned int j = 0; j < segments.size(); j++ )
+		{
+			nt_pair_counts.add_segment( genome_partition.get_strand( segments[j] ), segments[j].start_pos, segments[j].length );
+		}
 	}
+	
+	nt_pair_counts.get_probs( joint_prob_nt, marginal_prob_nt );
+	
+	return;
+}
+//==============================================================================
 
 
+
+// Joint and marginal probabilities over each gene's CDS.  With NT_PAIR_REGIONS_ORIGINAL, the whole span from the start
+//   to the end of the CDS is counted (introns included); with NT_PAIR_REGIONS_GENOME_PARTITION, only its coding segments
+//   are (so its introns, if any, are left out, and pairs don't span them).  Only the partition's views of the genome are
+//   used by the original method
+void calc_joint_prob_nt_genes( const TGenome_Partition & genome_partition, const vector <TORF_Data> & ORF_Data, vector <vector <double> > * const joint_prob_nt, vector <double> * const marginal_prob_nt )
+{
+	TNt_Pair_Counts nt_pair_counts;
+	vector <TGenome_Segment> CDS_segments;
+	
 	for( unsigned int i = 0; i < ORF_Data.size(); i++ )
 	{
-		for( unsigned int k = MIN_NUM_BASES_APART; k <= MAX_NUM_BASES_APART; k++ )
-		{
-			bool strand;
-			unsigned int gene_CDS_start;
-			unsigned int gene_CDS_end;
-			unsigned int chrom_it = ORF_Data[i].chrom_num - 1;
-
-			if( ORF_Data[i].opposite_strand == FALSE )  
-			{ 
-				strand = STRAND_W;
-				
-				gene_CDS_start = ORF_Data[i].gene_CDS.start_coord;
-				gene_CDS_end   = ORF_Data[i].gene_CDS.start_coord + ORF_Data[i].gene_CDS.length - 1;
-			}
-			else/*( ORF_Data[i].opposite_strand == TRUE )*/ 
-			{ 
-				strand = STRAND_C;
-				
-				gene_CDS_start = chrom_seq[strand][chrom_it].size() - ORF_Data[i].gene_CDS.start_coord + 1;
-				gene_CDS_end   = gene_CDS_start   				 	+ ORF_Data[i].gene_CDS.length 	   - 1;
-			}
-			
-
-			for( unsigned int j = gene_CDS_start - 1; j < gene_CDS_end; j++ )
-			{	
-				num_nt++;
-				
-				switch( chrom_seq[strand][chrom_it][j] )
-				{
-					case 'A' : 	num_instances_each_nt[ NT_A ]++;
-								break;
-								
-					case 'T' : 	num_instances_each_nt[ NT_T ]++;
-								break;
-								
-					case 'C' : 	num_instances_each_nt[ NT_C ]++;
-								break;
-								
-					case 'G' : 	num_instances_each_nt[ NT_G ]++;
-								break;
-								
-					default  : 	break;
-				}
-			}	
+		const TGenome_Segment gene_strand_pos = get_CDS_strand_pos( genome_partition, ORF_Data[i] );
 		
-
-			for( unsigned int j = gene_CDS_start - 1; j < ( gene_CDS_end - k ); j++ )
-			{	
-				num_instances_each_distance[ k - MIN_NUM_BASES_APART ]++;
-				
-				if	   ( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_G ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_G ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_G ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_G ]++; }
-				else
-				{
-					Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
-				}
-			}
+		#if( NT_PAIR_STATS_REGIONS == NT_PAIR_REGIONS_GENOME_PARTITION )
+			genome_partition.find_segments( SEGMENT_CODING, gene_strand_pos.chrom_it, ORF_Data[i].opposite_strand, gene_strand_pos.start_pos, gene_strand_pos.get_end_pos() - 1, &CDS_segments );
+		#else
+			CDS_segments.assign( 1, gene_strand_pos );
+		#endif
+		
+		for( unsigned int j = 0; j < CDS_segments.size(); j++ )
+		{
+			nt_pair_counts.add_segment( genome_partition.get_strand( CDS_segments[j] ), CDS_segments[j].start_pos, CDS_segments[j].length );
 		}
 	}
 	
+	nt_pair_counts.get_probs( joint_prob_nt, marginal_prob_nt );
+	
 
 
-	for( unsigned int i = 0; i < num_instances_each_pair.size(); i++ )
+	for( unsigned int i = 0; i < joint_prob_nt->size(); i++ )
 	{
-		for( unsigned int j = 0; j < num_instances_each_pair[i].size(); j++ )
+		for( unsigned int j = 0; j < (*joint_prob_nt)[i].size(); j++ )
 		{
-			(*joint_prob_nt)[i][j] = (double)num_instances_each_pair[i][j] / num_instances_each_distance[i];
-			
 			output_text_line( (string)"Prob of case " + get_str( j ) + " for k=" + get_str( i + MIN_NUM_BASES_APART ) + ": " + get_str( (*joint_prob_nt)[i][j] ) );
 		}
 	}
 	
-	for( unsigned int i = 0; i < num_instances_each_nt.size(); i++ )
+	for( unsigned int i = 0; i < marginal_prob_nt->size(); i++ )
 	{
-		(*marginal_prob_nt)[i] = (double)num_instances_each_nt[i] / num_nt;
-			
 		output_text_line( (string)"Prob of case " + get_str( i )  + ": " + get_str( (*marginal_prob_nt)[i] ) );
 	}
 			
@@ -1202,128 +1549,47 @@ void calc_joint_prob_nt_genes( const TFasta_Content & S_Cerevisiae_Chrom, const
 
 
 
-void calc_joint_prob_nt_TL( const TFasta_Content & S_Cerevisiae_Chrom, const vector <TORF_Data> & ORF_Data, vector <vector <double> > * const joint_prob_nt, vector <double> * const marginal_prob_nt )
+// Joint and marginal probabilities over the DNA upstream of each gene's CDS.  With NT_PAIR_REGIONS_ORIGINAL, this is a
+//   fixed window on the strand opposite the gene:  the nucleotides from 400 before the CDS start to 111 after it, and
+//   the pairs starting in its first 12 (a window running off the end of the chromosome is skipped).  With
+//   NT_PAIR_REGIONS_GENOME_PARTITION, it is the 5' TL segments out to the gene's most upstream TSS (see
+//   'build_genome_partition()'), so the parts of a TL overlapping another gene's CDS or an intron are left out
+void calc_joint_prob_nt_TL( const TGenome_Partition & genome_partition, const vector <TORF_Data> & ORF_Data, vector <vector <double> > * const joint_prob_nt, vector <double> * const marginal_prob_nt )
 {
-	vector <vector <unsigned int> > num_instances_each_pair( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, vector <unsigned int>( NUM_NUCLEOTIDE_PAIRS, 0 ) );
-	*joint_prob_nt = vector <vector <double> >   		   ( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, vector <double		>( NUM_NUCLEOTIDE_PAIRS, 0 ) );
-	
-	vector <unsigned int> num_instances_each_distance( MAX_NUM_BASES_APART - MIN_NUM_BASES_APART + 1, 0 );
-	
+	TNt_Pair_Counts nt_pair_counts;
 	
-	vector <unsigned int> num_instances_each_nt( NUM_DIFF_NT, 0 );
-	*marginal_prob_nt = vector <double>		   ( NUM_DIFF_NT, 0 );
-	
-	unsigned int num_nt= 0;
-	
-	
-	vector <vector <string> > chrom_seq( 2, vector <string>( S_Cerevisiae_Chrom.sequence.size(), "" ) );
-	
-	for( unsigned int chrom_it = 0; chrom_it < S_Cerevisiae_Chrom.sequence.size(); chrom_it++ )
-	{
-		chrom_seq[STRAND_W][chrom_it] = S_Cerevisiae_Chrom.sequence[ chrom_it ];
+	#if( NT_PAIR_STATS_REGIONS == NT_PAIR_REGIONS_GENOME_PARTITION )
+		vector <TGenome_Segment> TL_segments;
 		
-		chrom_seq[STRAND_C][chrom_it] = get_inverted_sequence( chrom_seq[STRAND_W][chrom_it] );
-		chrom_seq[STRAND_C][chrom_it] = get_opposite_strand  ( chrom_seq[STRAND_C][chrom_it] );
-	}
-
-
-	for( unsigned int i = 0; i < ORF_Data.size(); i++ )
-	{
-		for( unsigned int k = MIN_NUM_BASES_APART; k <= MAX_NUM_BASES_APART; k++ )
+		for( unsigned int i = 0; i < ORF_Data.size(); i++ )
 		{
-			bool strand;
-			unsigned int gene_CDS_start;
-			unsigned int gene_CDS_end;
-			unsigned int chrom_it = ORF_Data[i].chrom_num - 1;
-
-			if( ORF_Data[i].opposite_strand == FALSE )  
-			{ 
-				strand = STRAND_C;
-				
-				gene_CDS_start = ORF_Data[i].gene_CDS.start_coord;
-				gene_CDS_end   = ORF_Data[i].gene_CDS.start_coord + ORF_Data[i].gene_CDS.length - 1;
-			}
-			else/*( ORF_Data[i].opposite_strand == TRUE )*/ 
-			{ 
-				strand = STRAND_W;
-				
-				gene_CDS_start = chrom_seq[strand][chrom_it].size() - ORF_Data[i].gene_CDS.start_coord + 1;
-				gene_CDS_end   = gene_CDS_start   				 	+ ORF_Data[i].gene_CDS.length 	   - 1;
-			}
+			if( ORF_Data[i].tss_rel_pos.empty() == TRUE ) { continue; }
 			
-
-			for( unsigned int j = gene_CDS_start - 401; j < gene_CDS_start - 389 + 500; j++ )
-			{	
-				num_nt++;
-				
-				switch( chrom_seq[strand][chrom_it][j] )
-				{
-					case 'A' : 	num_instances_each_nt[ NT_A ]++;
-								break;
-								
-					case 'T' : 	num_instances_each_nt[ NT_T ]++;
-								break;
-								
-					case 'C' : 	num_instances_each_nt[ NT_C ]++;
-								break;
-								
-					case 'G' : 	num_instances_each_nt[ NT_G ]++;
-								break;
-								
-					default  : 	break;
-				}
-			}	
-		
-
-			for( unsigned int j = gene_CDS_start - 401; j < gene_CDS_start - 389; j++ )
-			{	
-				
-				num_instances_each_distance[ k - MIN_NUM_BASES_APART ]++;
-				
-				
-				if	   ( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'A' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_G ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'T' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_G ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'C' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_G ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_A ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_T ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_C ]++; }
-				else if( chrom_seq[strand][chrom_it][j] == 'G' && chrom_seq[strand][chrom_it][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_G ]++; }
-				else
-				{
-					Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
-				}
+			const unsigned int TL_length = (-1) * ORF_Data[i].tss_rel_pos[0];
+			const TGenome_Segment gene_strand_pos = get_CDS_strand_pos( genome_partition, ORF_Data[i] );
+			
+			if( TL_length > gene_strand_pos.start_pos ) { continue; }
+			
+			genome_partition.find_segments( SEGMENT_5_PRIME_TL, gene_strand_pos.chrom_it, ORF_Data[i].opposite_strand, gene_strand_pos.start_pos - TL_length, gene_strand_pos.start_pos - 1, &TL_segments );
+			
+			for( unsigned int j = 0; j < TL_segments.size(); j++ )
+			{
+				nt_pair_counts.add_segment( genome_partition.get_strand( TL_segments[j] ), TL_segments[j].start_pos, TL_segments[j].length );
 			}
 		}
-	}
-	
-
-
-	for( unsigned int i = 0; i < num_instances_each_pair.size(); i++ )
-	{
-		for( unsigned int j = 0; j < num_instances_each_pair[i].size(); j++ )
+	#else
+		for( unsigned int i = 0; i < ORF_Data.size(); i++ )
 		{
-			(*joint_prob_nt)[i][j] = (double)num_instances_each_pair[i][j] / num_instances_each_distance[i];
+			const TGenome_Segment gene_strand_pos = get_CDS_strand_pos( genome_partition, ORF_Data[i] );
+			const TStrand_View window_strand = genome_partition.get_strand( gene_strand_pos.chrom_it, !ORF_Data[i].opposite_strand );
 			
-			//output_text_line( (string)"Prob of case " + get_str( j ) + " for k=" + get_str( i + MIN_NUM_BASES_APART ) + ": " + get_str( (*joint_prob_nt)[i][j] ) );
-			//output_text_line( (string)"num  of case " + get_str( j ) + " for k=" + get_str( i + MIN_NUM_BASES_APART ) + ": " + get_str( num_instances_each_pair[i][j] ) );
+			if( gene_strand_pos.start_pos < 400 || gene_strand_pos.start_pos + 112 > window_strand.size() ) { continue; }
+			
+			nt_pair_counts.add_segment( window_strand, gene_strand_pos.start_pos - 400, 512, 12 );
 		}
-	}
+	#endif
 	
-	for( unsigned int i = 0; i < num_instances_each_nt.size(); i++ )
-	{
-		(*marginal_prob_nt)[i] = (double)num_instances_each_nt[i] / num_nt;
-			
-		//output_text_line( (string)"Prob of case " + get_str( i )  + ": " + get_str( (*marginal_prob_nt)[i] ) );
-	}
+	nt_pair_counts.get_probs( joint_prob_nt, marginal_prob_nt );
 			
 	return;
 }
@@ -1331,24 +1597,57 @@ void calc_joint_prob_nt_TL( const TFasta_Content & S_Cerevisiae_Chrom, const vec
 
 
 
+// Rank of a nucleotide in the order used by 'Tenum_nucleotide_pairs' (the pair 'x' and 'y' is 'x_rank * NUM_DIFF_NT +
+//   y_rank'), or NUM_DIFF_NT if the nucleotide isn't recognized
+static unsigned int get_context_nt_rank( const char nt )
+{
+	return Nt_Pair_Rank_Table[ (unsigned char)nt ];
+}
+//==============================================================================
+
+
+
+// Profile the average mutual information (AMI) between each uORF and its gene's CDS at each shift k, print the mean of
+//   each profile, and write every profile to 'uORF_AMI_PROFILES_FILE_NAME'.  The genes are profiled in parallel, each
+//   from its CDS's nucleotide ranks (read from the packed genome once per gene rather than once per pair); the logs of
+//   the pair counts come from a table shared by every thread.  The results (and any errors) are then reported serially,
+//   in gene order, so they don't depend on the number of threads
 void calc_AMI_uORFs( const TFasta_Content & S_Cerevisiae_Chrom, const vector <TORF_Data> & ORF_Data )
 {
-	vector <vector <string> > chrom_seq( 2, vector <string>( S_Cerevisiae_Chrom.sequence.size(), "" ) );
+	// Views of both strands of the shared genome (the Crick strand is complemented as it's read, rather than copied)
+	vector <vector <TStrand_View> > chrom_seq( 2 );
 	
 	for( unsigned int chrom_it = 0; chrom_it < S_Cerevisiae_Chrom.sequence.size(); chrom_it++ )
 	{
-		chrom_seq[STRAND_W][chrom_it] = S_Cerevisiae_Chrom.sequence[ chrom_it ];
-		
-		chrom_seq[STRAND_C][chrom_it] = get_inverted_sequence( chrom_seq[STRAND_W][chrom_it] );
-		chrom_seq[STRAND_C][chrom_it] = get_opposite_strand  ( chrom_seq[STRAND_C][chrom_it] );
+		chrom_seq[STRAND_W].push_back( S_Cerevisiae_Chrom.sequence[ chrom_it ].get_strand( FALSE ) );
+		chrom_seq[STRAND_C].push_back( S_Cerevisiae_Chrom.sequence[ chrom_it ].get_strand( TRUE  ) );
 	}
 
 
+	// ------------------------------
+	// Tabulate 'log10()' of every count a profile may contain (no more than the length of the longest uORF)
+	unsigned int max_pair_count = 1;
+	
 	for( unsigned int i = 0; i < ORF_Data.size(); i++ )
 	{
-		vector <TuORF_Data> uORFs = ORF_Data[i].get_uORFs();
-		
+		const vector <TuORF_Data> & uORFs = ORF_Data[i].get_uORFs();
 		
+		for( unsigned int m = 0; m < uORFs.size(); m++ ) { max_pair_count = max( max_pair_count, uORFs[m].len ); }
+	}
+	
+	vector <double> log10_count( max_pair_count + 1, 0 );
+	for( unsigned int count = 1; count <= max_pair_count; count++ ) { log10_count[count] = log10( (double)count ); }
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Profile each gene's uORFs.  Each task writes only to its own elements of 'AMI_profiles' and 'profile_errors'
+	vector <vector <vector <double> > > AMI_profiles( ORF_Data.size() );
+	vector <string> profile_errors( ORF_Data.size(), "" );
+
+	parallel_for( ORF_Data.size(), [&]( const unsigned int i )
+	{
 		bool strand;
 		unsigned int gene_CDS_start;
 		unsigned int gene_CDS_end;
@@ -1369,163 +1668,173 @@ void calc_AMI_uORFs( const TFasta_Content & S_Cerevisiae_Chrom, const vector <TO
 			gene_CDS_end   = gene_CDS_start   				 	+ ORF_Data[i].gene_CDS.length 	   - 1;
 		}
 		
+		const TStrand_View & chrom = chrom_seq[strand][chrom_it];
+		
+		
+		// The ranks of the CDS's nucleotides (NUM_DIFF_NT for any not recognized, or past the end of the chromosome)
+		const size_t CDS_first_pos = gene_CDS_start - 1;
+		vector <unsigned char> CDS_ranks( gene_CDS_end - CDS_first_pos, NUM_DIFF_NT );
+		
+		for( size_t j = CDS_first_pos; j < gene_CDS_end && j < chrom.size(); j++ ) { CDS_ranks[ j - CDS_first_pos ] = get_context_nt_rank( chrom[j] ); }
+		
+		
+		const vector <TuORF_Data> & uORFs = ORF_Data[i].get_uORFs();
+		
+		AMI_profiles[i].resize( uORFs.size() );
 		
-
 		for( unsigned int m = 0; m < uORFs.size(); m++ )
 		{
-			vector <unsigned int> num_instances_each_nt_x( NUM_DIFF_NT, 0 );
-			vector <unsigned int> num_instances_each_nt_y( NUM_DIFF_NT, 0 );
-			vector <double 		> marginal_prob_nt_x     ( NUM_DIFF_NT, 0 );
-			vector <double 		> marginal_prob_nt_y     ( NUM_DIFF_NT, 0 );
+			const TuORF_Data & uORF = uORFs[m];
+			
+			
+			// The nucleotide frequencies of the uORF (after its start codon), and of the CDS (less the ends it can't overlap)
+			unsigned int num_instances_each_nt_x[ NUM_DIFF_NT + 1 ] = { 0 };
+			unsigned int num_instances_each_nt_y[ NUM_DIFF_NT + 1 ] = { 0 };
 			unsigned int num_nt_x = 0;
 			unsigned int num_nt_y = 0;
 			
+			vector <unsigned char> uORF_ranks( uORF.content.size(), NUM_DIFF_NT );
 			
-			for( unsigned int j = gene_CDS_start - 1 + ( uORFs[m].content.size() - 3 - 1 ); j < gene_CDS_end - ( uORFs[m].content.size() - 3 - 1 ); j++ )
-			{	
-				num_nt_y++;
+			for( unsigned int j = 3; j < uORF.content.size(); j++ )
+			{
+				uORF_ranks[j] = get_context_nt_rank( uORF.content[j] );
 				
-				switch( chrom_seq[strand][chrom_it][j] )
-				{
-					case 'A' : 	num_instances_each_nt_y[ NT_A ]++;
-								break;
-								
-					case 'T' : 	num_instances_each_nt_y[ NT_T ]++;
-								break;
-								
-					case 'C' : 	num_instances_each_nt_y[ NT_C ]++;
-								break;
-								
-					case 'G' : 	num_instances_each_nt_y[ NT_G ]++;
-								break;
-								
-					default  : 	break;
-				}
-			}	
+				num_nt_x++;
+				num_instances_each_nt_x[ uORF_ranks[j] ]++;
+			}
 			
+			for( unsigned int j = gene_CDS_start - 1 + ( uORF.content.size() - 3 - 1 ); j < gene_CDS_end - ( uORF.content.size() - 3 - 1 ); j++ )
+			{
+				num_nt_y++;
+				num_instances_each_nt_y[ CDS_ranks[ j - CDS_first_pos ] ]++;
+			}
 			
-			int num_k_values = gene_CDS_end - gene_CDS_start - ( 2 * uORFs[m].len ) + 3;	
-			if( num_k_values < 0 ) { num_k_values = 0; }
-			unsigned int y_pos_start  = gene_CDS_start - uORFs[m].start_pos - 3 + uORFs[m].len - 1;	
-	
-				
+			double log10_marginal_prob_x[ NUM_DIFF_NT ];
+			double log10_marginal_prob_y[ NUM_DIFF_NT ];
 			
-			for( unsigned int j = 3; j < uORFs[m].content.size(); j++ )
-			{	
-				num_nt_x++;
-				
-				switch( uORFs[m].content[j] )
-				{
-					case 'A' : 	num_instances_each_nt_x[ NT_A ]++;
-								break;
-								
-					case 'T' : 	num_instances_each_nt_x[ NT_T ]++;
-								break;
-								
-					case 'C' : 	num_instances_each_nt_x[ NT_C ]++;
-								break;
-								
-					case 'G' : 	num_instances_each_nt_x[ NT_G ]++;
-								break;
-								
-					default  : 	break;
-				}
-			}	
-				
-			vector <double> AMI_profiles( num_k_values, 0 ); 	
-			double AMI_profile_sum = 0; 	
+			for( unsigned int j = 0; j < NUM_DIFF_NT; j++ )
+			{
+				log10_marginal_prob_x[j] = log10( (double)num_instances_each_nt_x[j] / num_nt_x );
+				log10_marginal_prob_y[j] = log10( (double)num_instances_each_nt_y[j] / num_nt_y );
+			}
 			
-			for( unsigned int k = 0; k < (unsigned int)num_k_values; k++ )
-			{	
-				vector <unsigned int> num_instances_each_pair( NUM_NUCLEOTIDE_PAIRS, 0 );		
-				vector <double      > joint_prob_nt		     ( NUM_NUCLEOTIDE_PAIRS, 0 );
-				
-				unsigned int num_pairs = 0;
 			
+			int num_k_values = gene_CDS_end - gene_CDS_start - ( 2 * uORF.len ) + 3;	
+			if( num_k_values < 0 || uORF.len <= 3 ) { num_k_values = 0; }
 			
-				for( unsigned int j = 3; j < uORFs[m].len; j++ )
-				{
-					num_pairs++;
-					
-					unsigned int y_pos_it = ( uORFs[m].start_pos - 1 ) + j + y_pos_start + k;
-					
-					if( y_pos_it >= chrom_seq[strand][chrom_it].size() )
-					{
-						Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
-					}
-
-					if	   ( uORFs[m].content[j] == 'A' && chrom_seq[strand][chrom_it][y_pos_it] == 'A' ) { num_instances_each_pair[ A_AND_A ]++; }
-					else if( uORFs[m].content[j] == 'A' && chrom_seq[strand][chrom_it][y_pos_it] == 'T' ) { num_instances_each_pair[ A_AND_T ]++; }
-					else if( uORFs[m].content[j] == 'A' && chrom_seq[strand][chrom_it][y_pos_it] == 'C' ) { num_instances_each_pair[ A_AND_C ]++; }
-					else if( uORFs[m].content[j] == 'A' && chrom_seq[strand][chrom_it][y_pos_it] == 'G' ) { num_instances_each_pair[ A_AND_G ]++; }
-					else if( uORFs[m].content[j] == 'T' && chrom_seq[strand][chrom_it][y_pos_it] == 'A' ) { num_instances_each_pair[ T_AND_A ]++; }
-					else if( uORFs[m].content[j] == 'T' && chrom_seq[strand][chrom_it][y_pos_it] == 'T' ) { num_instances_each_pair[ T_AND_T ]++; }
-					else if( uORFs[m].content[j] == 'T' && chrom_seq[strand][chrom_it][y_pos_it] == 'C' ) { num_instances_each_pair[ T_AND_C ]++; }
-					else if( uORFs[m].content[j] == 'T' && chrom_seq[strand][chrom_it][y_pos_it] == 'G' ) { num_instances_each_pair[ T_AND_G ]++; }
-					else if( uORFs[m].content[j] == 'C' && chrom_seq[strand][chrom_it][y_pos_it] == 'A' ) { num_instances_each_pair[ C_AND_A ]++; }
-					else if( uORFs[m].content[j] == 'C' && chrom_seq[strand][chrom_it][y_pos_it] == 'T' ) { num_instances_each_pair[ C_AND_T ]++; }
-					else if( uORFs[m].content[j] == 'C' && chrom_seq[strand][chrom_it][y_pos_it] == 'C' ) { num_instances_each_pair[ C_AND_C ]++; }
-					else if( uORFs[m].content[j] == 'C' && chrom_seq[strand][chrom_it][y_pos_it] == 'G' ) { num_instances_each_pair[ C_AND_G ]++; }
-					else if( uORFs[m].content[j] == 'G' && chrom_seq[strand][chrom_it][y_pos_it] == 'A' ) { num_instances_each_pair[ G_AND_A ]++; }
-					else if( uORFs[m].content[j] == 'G' && chrom_seq[strand][chrom_it][y_pos_it] == 'T' ) { num_instances_each_pair[ G_AND_T ]++; }
-					else if( uORFs[m].content[j] == 'G' && chrom_seq[strand][chrom_it][y_pos_it] == 'C' ) { num_instances_each_pair[ G_AND_C ]++; }
-					else if( uORFs[m].content[j] == 'G' && chrom_seq[strand][chrom_it][y_pos_it] == 'G' ) { num_instances_each_pair[ G_AND_G ]++; }
-					else
-					{
-						Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
-					}
-				}
+			vector <double> & AMI_profile = AMI_profiles[i][m];
+			AMI_profile.assign( num_k_values, 0 );
+			
+			if( num_k_values == 0 ) { continue; }
+			
+			
+			// At shift k, uORF nucleotide j (from 3) is paired with CDS nucleotide 'j + len - 4 + k', so the pairs for every
+			//   k cover CDS nucleotides 'len - 1' through '2 * len - 6 + num_k_values'
+			const size_t last_pair_pos = CDS_first_pos + 2 * uORF.len - 6 + num_k_values;
+			
+			if( last_pair_pos >= chrom.size() )
+			{
+				profile_errors[i] = (string)"Error in 'calc_AMI_uORFs()': uORF " + get_str( m + 1 ) + " of '" + ORF_Data[i].gene_name + "' is paired with positions past the end of the chromosome. ";
+				return;
+			}
+			
+			bool nt_recognized = TRUE;
+			for( unsigned int j = 3; j < uORF.len; j++ ) 								 { if( uORF_ranks[j] == NUM_DIFF_NT ) { nt_recognized = FALSE; } }
+			for( size_t j = uORF.len - 1; j <= last_pair_pos - CDS_first_pos; j++ ) { if( CDS_ranks[j]  == NUM_DIFF_NT ) { nt_recognized = FALSE; } }
+			
+			if( nt_recognized == FALSE )
+			{
+				profile_errors[i] = (string)"Error in 'calc_AMI_uORFs()': Pair of nucleotides not recognized (uORF " + get_str( m + 1 ) + " of '" + ORF_Data[i].gene_name + "'). ";
+				return;
+			}
+			
+			
+			const unsigned int num_pairs = uORF.len - 3;
+			const double log10_num_pairs = log10_count[ num_pairs ];
+			
+			for( unsigned int k = 0; k < (unsigned int)num_k_values; k++ )
+			{
+				unsigned int num_instances_each_pair[ NUM_NUCLEOTIDE_PAIRS ] = { 0 };
+				const unsigned char * const paired_ranks = &CDS_ranks[ uORF.len - 4 + k ];
 				
+				for( unsigned int j = 3; j < uORF.len; j++ ) { num_instances_each_pair[ uORF_ranks[j] * NUM_DIFF_NT + paired_ranks[j] ]++; }
 				
-				for( unsigned int j = 0; j < num_instances_each_pair.size(); j++ )
-				{
-					joint_prob_nt[j] = (double)num_instances_each_pair[j] / num_pairs;
-						
-					//output_text_line( (string)"Prob of case " + get_str( j ) + " for gene " + ORF_Data[i].gene_name + " uORF " + get_str( m ) + ": " + get_str( joint_prob_nt[j] ) );
-					//output_text_line( (string)"num of case "  + get_str( j ) + " for gene " + ORF_Data[i].gene_name + " uORF " + get_str( m ) + ": " + get_str( num_instances_each_pair[j] ) );
-				}
 				
-				for( unsigned int j = 0; j < num_instances_each_nt_x.size(); j++ )
+				// p(x,y) * log10( p(x,y) / p(x) / p(y) ), summed over the pairs which occur
+				for( unsigned int pair_it = 0; pair_it < NUM_NUCLEOTIDE_PAIRS; pair_it++ )
 				{
-					marginal_prob_nt_x[j] = (double)num_instances_each_nt_x[j] / num_nt_x;
-					marginal_prob_nt_y[j] = (double)num_instances_each_nt_y[j] / num_nt_y;
-						
-					//output_text_line( (string)"Prob of case x" + get_str( j ) + " for gene " + ORF_Data[i].gene_name + " uORF " + get_str( m ) + ": " + get_str( marginal_prob_nt_x[j] ) );
-					//output_text_line( (string)"Prob of case y" + get_str( j ) + " for gene " + ORF_Data[i].gene_name + " uORF " + get_str( m ) + ": " + get_str( marginal_prob_nt_y[j] ) );
+					const unsigned int pair_count = num_instances_each_pair[pair_it];
+					
+					if( pair_count != 0 )
+					{
+						AMI_profile[k] += ( (double)pair_count / num_pairs ) * ( log10_count[ pair_count ] - log10_num_pairs - 
+																				 log10_marginal_prob_x[ pair_it / NUM_DIFF_NT ] - 
+																				 log10_marginal_prob_y[ pair_it % NUM_DIFF_NT ] );
+					}
 				}
-				
-				
-				
-				if( joint_prob_nt[ A_AND_A ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ A_AND_A ] * log10( joint_prob_nt[ A_AND_A ] / marginal_prob_nt_x[ NT_A ] / marginal_prob_nt_y[ NT_A ] ) ); }
-				if( joint_prob_nt[ A_AND_T ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ A_AND_T ] * log10( joint_prob_nt[ A_AND_T ] / marginal_prob_nt_x[ NT_A ] / marginal_prob_nt_y[ NT_T ] ) ); }
-				if( joint_prob_nt[ A_AND_C ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ A_AND_C ] * log10( joint_prob_nt[ A_AND_C ] / marginal_prob_nt_x[ NT_A ] / marginal_prob_nt_y[ NT_C ] ) ); }
-				if( joint_prob_nt[ A_AND_G ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ A_AND_G ] * log10( joint_prob_nt[ A_AND_G ] / marginal_prob_nt_x[ NT_A ] / marginal_prob_nt_y[ NT_G ] ) ); }
-				if( joint_prob_nt[ T_AND_A ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ T_AND_A ] * log10( joint_prob_nt[ T_AND_A ] / marginal_prob_nt_x[ NT_T ] / marginal_prob_nt_y[ NT_A ] ) ); }
-				if( joint_prob_nt[ T_AND_T ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ T_AND_T ] * log10( joint_prob_nt[ T_AND_T ] / marginal_prob_nt_x[ NT_T ] / marginal_prob_nt_y[ NT_T ] ) ); }
-				if( joint_prob_nt[ T_AND_C ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ T_AND_C ] * log10( joint_prob_nt[ T_AND_C ] / marginal_prob_nt_x[ NT_T ] / marginal_prob_nt_y[ NT_C ] ) ); }
-				if( joint_prob_nt[ T_AND_G ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ T_AND_G ] * log10( joint_prob_nt[ T_AND_G ] / marginal_prob_nt_x[ NT_T ] / marginal_prob_nt_y[ NT_G ] ) ); }
-				if( joint_prob_nt[ C_AND_A ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ C_AND_A ] * log10( joint_prob_nt[ C_AND_A ] / marginal_prob_nt_x[ NT_C ] / marginal_prob_nt_y[ NT_A ] ) ); }
-				if( joint_prob_nt[ C_AND_T ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ C_AND_T ] * log10( joint_prob_nt[ C_AND_T ] / marginal_prob_nt_x[ NT_C ] / marginal_prob_nt_y[ NT_T ] ) ); }
-				if( joint_prob_nt[ C_AND_C ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ C_AND_C ] * log10( joint_prob_nt[ C_AND_C ] / marginal_prob_nt_x[ NT_C ] / marginal_prob_nt_y[ NT_C ] ) ); }
-				if( joint_prob_nt[ C_AND_G ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ C_AND_G ] * log10( joint_prob_nt[ C_AND_G ] / marginal_prob_nt_x[ NT_C ] / marginal_prob_nt_y[ NT_G ] ) ); }
-				if( joint_prob_nt[ G_AND_A ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ G_AND_A ] * log10( joint_prob_nt[ G_AND_A ] / marginal_prob_nt_x[ NT_G ] / marginal_prob_nt_y[ NT_A ] ) ); }
-				if( joint_prob_nt[ G_AND_T ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ G_AND_T ] * log10( joint_prob_nt[ G_AND_T ] / marginal_prob_nt_x[ NT_G ] / marginal_prob_nt_y[ NT_T ] ) ); }
-				if( joint_prob_nt[ G_AND_C ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ G_AND_C ] * log10( joint_prob_nt[ G_AND_C ] / marginal_prob_nt_x[ NT_G ] / marginal_prob_nt_y[ NT_C ] ) ); }
-				if( joint_prob_nt[ G_AND_G ] != 0 ) { AMI_profiles[k] += ( joint_prob_nt[ G_AND_G ] * log10( joint_prob_nt[ G_AND_G ] / marginal_prob_nt_x[ NT_G ] / marginal_prob_nt_y[ NT_G ] ) ); }
-			
-
-				AMI_profile_sum += AMI_profiles[k];
-				
-				//output_text_line( "    " + /*(string)"AMI for k=" + get_str( k ) + ": " +*/ get_str( AMI_profiles[k] ) );
 			}
+		}
+		
+	}, AMI_PROFILE_GRAIN_SIZE );
+	// ------------------------------
 
 
+
+	// ------------------------------
+	// Report each profile's mean, and write every profile to a binary file:  "uAMI", the numbers of genes and uORFs, each
+	//   gene's name (null-terminated), the index of each gene's first uORF (one more than the number of genes), the index
+	//   of each uORF's first value (one more than the number of uORFs), then the values of each profile (for k = 0, 1,
+	//   ...).  Counts and indexes are 32-bit, values are 32-bit floats, and all are in the machine's byte order
+	string gene_names	  ( "" );
+	string gene_table	  ( "" );
+	string uORF_table	  ( "" );
+	string profile_values( "" );
+	unsigned int num_uORFs  = 0;
+	unsigned int num_values = 0;
+	
+	for( unsigned int i = 0; i < ORF_Data.size(); i++ )
+	{
+		if( profile_errors[i] != "" ) { Errors.handle_error( FATAL, profile_errors[i], __FILE__, __LINE__ ); }
+		
+		gene_names.append( ORF_Data[i].gene_name.c_str(), ORF_Data[i].gene_name.size() + 1 );
+		append_binary_value( &gene_table, num_uORFs );
+		
+		for( unsigned int m = 0; m < AMI_profiles[i].size(); m++ )
+		{
+			const vector <double> & AMI_profile = AMI_profiles[i][m];
+			double AMI_profile_sum = 0;
+			
+			append_binary_value( &uORF_table, num_values );
 			
-			if	  ( num_k_values != 0 )   { output_text_line( /*(string)"AMI for k=" + get_str( k ) + ": " +*/ get_str( AMI_profile_sum / AMI_profiles.size() ) ); }
-			else/*( num_k_values != 0 )*/ { output_text_line( /*(string)"AMI for k=" + get_str( k ) + ": " +*/ get_str( -1 									  ) ); }
+			for( unsigned int k = 0; k < AMI_profile.size(); k++ )
+			{
+				AMI_profile_sum += AMI_profile[k];
+				append_binary_value( &profile_values, (float)AMI_profile[k] );
+			}
+			
+			if	  ( AMI_profile.size() != 0 )   { output_text_line( get_str( AMI_profile_sum / AMI_profile.size() ) ); }
+			else/*( AMI_profile.size() == 0 )*/ { output_text_line( get_str( -1 ) ); }
+			
+			num_uORFs++;
+			num_values += AMI_profile.size();
 		}
 	}
 	
+	append_binary_value( &gene_table, num_uORFs  );
+	append_binary_value( &uORF_table, num_values );
+	
+	
+	string AMI_profiles_file_contents( "uAMI" );
+	append_binary_value( &AMI_profiles_file_contents, (unsigned int)ORF_Data.size() );
+	append_binary_value( &AMI_profiles_file_contents, num_uORFs );
+	AMI_profiles_file_contents += gene_names + gene_table + uORF_table + profile_values;
+	
+	if( write_file_contents( PATH_OUTPUT_FOLDER, uORF_AMI_PROFILES_FILE_NAME, AMI_profiles_file_contents, YES, YES ) )
+	{
+		Errors.handle_error( FATAL, "Error in 'calc_AMI_uORFs()': ", __FILE__, __LINE__ );
+	}
+	// ------------------------------
+	
 
 	return;
 }
@@ -1533,99 +1842,153 @@ void calc_AMI_uORFs( const TFasta_Content & S_Cerevisiae_Chrom, const vector <TO
 
 
 
-void calc_mod_AMI_uORF_context( const TFasta_Content & S_Cerevisiae_Chrom, vector <TORF_Data> * const ORF_Data )
+// Count the occurrences of each nucleotide pair 'k' bases apart in the extended start context of each uORF (for each k
+//   from MIN_NUM_BASES_APART_CONTEXT to MAX_NUM_BASES_APART_CONTEXT), as one row of 'context_profiles' per uORF, in
+//   uORF order.  The uORFs are profiled in parallel; the rows (and any errors) are then recorded serially, in uORF
+//   order, so the results don't depend on the number of threads
+void calc_mod_AMI_uORF_context( vector <TORF_Data> * const ORF_Data, TContext_Profile_Matrix * const context_profiles )
 {
-	vector <vector <unsigned int> > uORFs_mutual_info_vect( 0 );
-	string vectors_to_print = "";
-	
-	
+	// ------------------------------
+	// Gather the contexts (read in place, rather than copied out)
+	vector <unsigned int> ORF_its ( 0 );
+	vector <unsigned int> uORF_its( 0 );
+	vector <const string *> contexts( 0 );
+
 	for( unsigned int i = 0; i < ORF_Data->size(); i++ )
 	{
-		vector <TuORF_Data> uORFs = ORF_Data->at(i).get_uORFs();
-	
+		const vector <TuORF_Data> & uORFs = ORF_Data->at(i).get_uORFs();
+
 		for( unsigned int m = 0; m < uORFs.size(); m++ )
 		{
-			vector <vector <unsigned int> > num_instances_each_pair( MAX_NUM_BASES_APART_CONTEXT - MIN_NUM_BASES_APART_CONTEXT + 1, 
-																	 vector <unsigned int>( NUM_NUCLEOTIDE_PAIRS, 0 ) );
+			ORF_its.push_back ( i );
+			uORF_its.push_back( m );
+			contexts.push_back( &uORFs[m].ext_start_context );
+		}
+	}
+	// ------------------------------
 
-			vector <unsigned int> num_instances_each_nt( NUM_DIFF_NT, 0 );
-			
-			vector <unsigned int> this_uORF_mutual_info_vect( 0 );
-	
-	
-			for( unsigned int k = MIN_NUM_BASES_APART_CONTEXT; k <= MAX_NUM_BASES_APART_CONTEXT; k++ )
-			{
-				for( unsigned int j = 0; j < uORFs[m].ext_start_context.size(); j++ )
-				{	
-					switch( uORFs[m].ext_start_context[j] )
-					{
-						case 'A' : 	num_instances_each_nt[ NT_A ]++;
-									break;
-									
-						case 'T' : 	num_instances_each_nt[ NT_T ]++;
-									break;
-									
-						case 'C' : 	num_instances_each_nt[ NT_C ]++;
-									break;
-									
-						case 'G' : 	num_instances_each_nt[ NT_G ]++;
-									break;
-									
-						default  : 	break;
-					}
-				}	
 
-				
-				
-				for( unsigned int j = 0; j < ( uORFs[m].ext_start_context.size() - k ); j++ )
-				{
-					if	   ( uORFs[m].ext_start_context[j] == 'A' && uORFs[m].ext_start_context[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ A_AND_A ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'A' && uORFs[m].ext_start_context[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ A_AND_T ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'A' && uORFs[m].ext_start_context[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ A_AND_C ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'A' && uORFs[m].ext_start_context[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ A_AND_G ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'T' && uORFs[m].ext_start_context[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ T_AND_A ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'T' && uORFs[m].ext_start_context[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ T_AND_T ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'T' && uORFs[m].ext_start_context[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ T_AND_C ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'T' && uORFs[m].ext_start_context[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ T_AND_G ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'C' && uORFs[m].ext_start_context[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ C_AND_A ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'C' && uORFs[m].ext_start_context[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ C_AND_T ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'C' && uORFs[m].ext_start_context[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ C_AND_C ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'C' && uORFs[m].ext_start_context[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ C_AND_G ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'G' && uORFs[m].ext_start_context[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ G_AND_A ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'G' && uORFs[m].ext_start_context[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ G_AND_T ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'G' && uORFs[m].ext_start_context[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ G_AND_C ]++; }
-					else if( uORFs[m].ext_start_context[j] == 'G' && uORFs[m].ext_start_context[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ][ G_AND_G ]++; }
-					else
-					{
-						Errors.handle_error( FATAL, (string)"Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized (" + uORFs[m].ext_start_context[j] + 
-															" and " + uORFs[m].ext_start_context[j + k] + ").", __FILE__, __LINE__ );
-					}
-				}
-				
-				this_uORF_mutual_info_vect.insert( this_uORF_mutual_info_vect.end(),
-												   num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ].begin(),
-												   num_instances_each_pair[ k - MIN_NUM_BASES_APART_CONTEXT ].end() );
+
+	// ------------------------------
+	// Profile each context.  Each task writes only to its own row of 'context_profiles' and element of 'unrecognized_nt_pos'
+	const unsigned int num_k_values = MAX_NUM_BASES_APART_CONTEXT - MIN_NUM_BASES_APART_CONTEXT + 1;
+
+	if( context_profiles->resize( contexts.size(), num_k_values * NUM_NUCLEOTIDE_PAIRS ) )
+	{
+		Errors.handle_error( FATAL, "Error in 'calc_mod_AMI_uORF_context()': ", __FILE__, __LINE__ );
+	}
+
+	vector <int> unrecognized_nt_pos( contexts.size(), -1 );
+
+	parallel_for( contexts.size(), [&]( const unsigned int item_it )
+	{
+		const string & context = *contexts[item_it];
+
+		// Each nucleotide is ranked once, rather than once per pair it's a member of
+		vector <unsigned int> nt_ranks( context.size(), 0 );
+
+		if( rank_nt_seq( context.data(), context.size(), nt_ranks.data() ) == FALSE )
+		{
+			unrecognized_nt_pos[item_it] = find( nt_ranks.begin(), nt_ranks.end(), (unsigned int)NUM_DIFF_NT ) - nt_ranks.begin();
+			return;
+		}
+
+
+		// 'NUM_NUCLEOTIDE_PAIRS' counts for each k, in order of increasing k (counted straight into the row, which starts
+		//   zeroed; the counts are small enough to be exact as floats)
+		float * const profile = context_profiles->get_row( item_it );
+
+		for( unsigned int k = MIN_NUM_BASES_APART_CONTEXT; k <= MAX_NUM_BASES_APART_CONTEXT; k++ )
+		{
+			float * const k_pair_counts = &profile[ ( k - MIN_NUM_BASES_APART_CONTEXT ) * NUM_NUCLEOTIDE_PAIRS ];
+
+			for( unsigned int j = 0; j + k < nt_ranks.size(); j++ )
+			{
+				k_pair_counts[ nt_ranks[j] * NUM_DIFF_NT + nt_ranks[j + k] ]++;
 			}
+		}
+
+	}, CONTEXT_PROFILE_GRAIN_SIZE );
+	// ------------------------------
+
+
+
+	// ------------------------------
+	// Record the profiles
+	for( unsigned int item_it = 0; item_it < contexts.size(); item_it++ )
+	{
+		if( unrecognized_nt_pos[item_it] != -1 )
+		{
+			Errors.handle_error( FATAL, (string)"Error in 'calc_mod_AMI_uORF_context()': Nucleotide not recognized (" + (*contexts[item_it])[ unrecognized_nt_pos[item_it] ] +
+										" in the start context of uORF " + get_str( uORF_its[item_it] + 1 ) + " of '" + ORF_Data->at( ORF_its[item_it] ).gene_name + "').", __FILE__, __LINE__ );
+		}
+
+		ORF_Data->at( ORF_its[item_it] ).update_context_profile_row( uORF_its[item_it], item_it );
+	}
+	// ------------------------------
 
-			ORF_Data->at(i).update_context_profile(m, this_uORF_mutual_info_vect);
+
+	return;
+}
+//==============================================================================
+
+
+
+// Add the nucleotides and pairs of nucleotides of 'sequence' to the counts.  Each nucleotide is ranked once (rather than
+//   compared once per pair it's a member of) and the pairs at each k are counted by rank, with rank NUM_DIFF_NT standing
+//   for any nucleotide not recognized; returns FALSE if any pair includes one.  Nucleotides not recognized are left out
+//   of the marginal counts (though not out of 'num_nt')
+static bool count_nt_pairs( const string & sequence,
+							vector <vector <unsigned int> > * const num_instances_each_pair,
+							vector <unsigned int> * const num_instances_each_distance,
+							vector <unsigned int> * const num_instances_each_nt,
+							unsigned int * const num_nt )
+{
+	vector <unsigned char> nt_ranks( sequence.size() );
+	vector <unsigned char> nt_codes( sequence.size() );
+	
+	rank_nt_seq  ( sequence.data(), sequence.size(), nt_ranks.data() );
+	encode_nt_seq( sequence.data(), sequence.size(), nt_codes.data() );
+	
+	
+	bool all_pairs_recognized = TRUE;
+	
+	for( unsigned int k = MIN_NUM_BASES_APART; k <= MAX_NUM_BASES_APART && k < sequence.size(); k++ )
+	{
+		unsigned int num_instances_each_rank_pair[ ( NUM_DIFF_NT + 1 ) * ( NUM_DIFF_NT + 1 ) ] = { 0 };
 		
-			/*
-			uORFs_mutual_info_vect.push_back( this_uORF_mutual_info_vect );
-			
-			for( unsigned int j = 0; j < uORFs_mutual_info_vect.back().size(); j++ )
+		for( size_t j = 0; j < ( sequence.size() - k ); j++ )
+		{
+			num_instances_each_rank_pair[ nt_ranks[j] * ( NUM_DIFF_NT + 1 ) + nt_ranks[j + k] ]++;
+		}
+		
+		(*num_instances_each_distance)[ k - MIN_NUM_BASES_APART ] += sequence.size() - k;
+		
+		for( unsigned int x_rank = 0; x_rank <= NUM_DIFF_NT; x_rank++ )
+		{
+			for( unsigned int y_rank = 0; y_rank <= NUM_DIFF_NT; y_rank++ )
 			{
-				vectors_to_print += ( get_str( uORFs_mutual_info_vect.back()[j] ) + '\t');
+				const unsigned int num_instances = num_instances_each_rank_pair[ x_rank * ( NUM_DIFF_NT + 1 ) + y_rank ];
+				
+				if	   ( num_instances == 0 )								{ continue; }
+				else if( x_rank == NUM_DIFF_NT || y_rank == NUM_DIFF_NT )	{ all_pairs_recognized = FALSE; }
+				else														{ (*num_instances_each_pair)[ k - MIN_NUM_BASES_APART ][ x_rank * NUM_DIFF_NT + y_rank ] += num_instances; }
 			}
-			
-			vectors_to_print += '\n';
-			*/
 		}
 	}
 	
-	// write_file_contents( PATH_OUTPUT_FOLDER, "uORF_context_profiles.txt", vectors_to_print );
-
-		
-	return;
+	
+	// Calculate the marginal probabilities
+	unsigned int num_instances_each_code[ NUM_DIFF_NT + 1 ] = { 0 };
+	
+	for( size_t j = 0; j < sequence.size(); j++ ) { num_instances_each_code[ nt_codes[j] ]++; }
+	
+	for( unsigned int nt_it = 0; nt_it < NUM_DIFF_NT; nt_it++ ) { (*num_instances_each_nt)[nt_it] += num_instances_each_code[nt_it]; }
+	
+	*num_nt += sequence.size();
+	
+	
+	return all_pairs_recognized;
 }
 //==============================================================================
 
@@ -1645,63 +2008,13 @@ void calc_joint_prob_nt_genome( const TFasta_Content & S_Cerevisiae_Chrom, vecto
 	unsigned int num_nt= 0;
 
 
-	for( unsigned int k = MIN_NUM_BASES_APART; k <= MAX_NUM_BASES_APART; k++ )
-	{	
-		for( unsigned int i = 0; i < S_Cerevisiae_Chrom.sequence.size(); i++ )
-		{
-			for( unsigned int j = 0; j < ( S_Cerevisiae_Chrom.sequence[i].size() - k ); j++ )
-			{	
-				num_instances_each_distance[ k - MIN_NUM_BASES_APART ]++;
-				
-				if	   ( S_Cerevisiae_Chrom.sequence[i][j] == 'A' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_A ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'A' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_T ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'A' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_C ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'A' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_G ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'T' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_A ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'T' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_T ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'T' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_C ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'T' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_G ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'C' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_A ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'C' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_T ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'C' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_C ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'C' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_G ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'G' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_A ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'G' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_T ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'G' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_C ]++; }
-				else if( S_Cerevisiae_Chrom.sequence[i][j] == 'G' && S_Cerevisiae_Chrom.sequence[i][j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_G ]++; }
-				else
-				{
-					Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
-				}
-			}
-		}
-	}
-	
-
-	// Calculate the marginal probabilities
+	// Each chromosome is unpacked once, rather than read from the packed genome once per pair
 	for( unsigned int i = 0; i < S_Cerevisiae_Chrom.sequence.size(); i++ )
 	{
-		for( unsigned int j = 0; j < S_Cerevisiae_Chrom.sequence[i].size(); j++ )
-		{	
-			num_nt++;
-			
-			switch( S_Cerevisiae_Chrom.sequence[i][j] )
-			{
-				case 'A' : 	num_instances_each_nt[ NT_A ]++;
-							break;
-							
-				case 'T' : 	num_instances_each_nt[ NT_T ]++;
-							break;
-							
-				case 'C' : 	num_instances_each_nt[ NT_C ]++;
-							break;
-							
-				case 'G' : 	num_instances_each_nt[ NT_G ]++;
-							break;
-							
-				default  : 	break;
-			}
-		}	
+		if( count_nt_pairs( S_Cerevisiae_Chrom.sequence[i].substr( 0 ), &num_instances_each_pair, &num_instances_each_distance, &num_instances_each_nt, &num_nt ) == FALSE )
+		{
+			Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
+		}
 	}
 		
 			
@@ -1744,58 +2057,10 @@ void calc_joint_prob_nt_sequence( const string & sequence, vector <vector <doubl
 	unsigned int num_nt= 0;
 
 
-	for( unsigned int k = MIN_NUM_BASES_APART; k <= MAX_NUM_BASES_APART; k++ )
-	{	
-		for( unsigned int j = 0; j < ( sequence.size() - k ); j++ )
-		{	
-			num_instances_each_distance[ k - MIN_NUM_BASES_APART ]++;
-			
-			if	   ( sequence[j] == 'A' && sequence[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_A ]++; }
-			else if( sequence[j] == 'A' && sequence[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_T ]++; }
-			else if( sequence[j] == 'A' && sequence[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_C ]++; }
-			else if( sequence[j] == 'A' && sequence[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ A_AND_G ]++; }
-			else if( sequence[j] == 'T' && sequence[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_A ]++; }
-			else if( sequence[j] == 'T' && sequence[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_T ]++; }
-			else if( sequence[j] == 'T' && sequence[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_C ]++; }
-			else if( sequence[j] == 'T' && sequence[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ T_AND_G ]++; }
-			else if( sequence[j] == 'C' && sequence[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_A ]++; }
-			else if( sequence[j] == 'C' && sequence[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_T ]++; }
-			else if( sequence[j] == 'C' && sequence[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_C ]++; }
-			else if( sequence[j] == 'C' && sequence[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ C_AND_G ]++; }
-			else if( sequence[j] == 'G' && sequence[j + k] == 'A' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_A ]++; }
-			else if( sequence[j] == 'G' && sequence[j + k] == 'T' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_T ]++; }
-			else if( sequence[j] == 'G' && sequence[j + k] == 'C' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_C ]++; }
-			else if( sequence[j] == 'G' && sequence[j + k] == 'G' ) { num_instances_each_pair[ k - MIN_NUM_BASES_APART ][ G_AND_G ]++; }
-			else
-			{
-				Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
-			}
-		}
+	if( count_nt_pairs( sequence, &num_instances_each_pair, &num_instances_each_distance, &num_instances_each_nt, &num_nt ) == FALSE )
+	{
+		Errors.handle_error( FATAL, "Error in 'calc_joint_prob_nt_genes_occurrence()': Pair of nucleotides not recognized. ", __FILE__, __LINE__ );
 	}
-	
-
-	// Calculate the marginal probabilities
-	for( unsigned int j = 0; j < sequence.size(); j++ )
-	{	
-		num_nt++;
-		
-		switch( sequence[j] )
-		{
-			case 'A' : 	num_instances_each_nt[ NT_A ]++;
-						break;
-						
-			case 'T' : 	num_instances_each_nt[ NT_T ]++;
-						break;
-						
-			case 'C' : 	num_instances_each_nt[ NT_C ]++;
-						break;
-						
-			case 'G' : 	num_instances_each_nt[ NT_G ]++;
-						break;
-						
-			default  : 	break;
-		}
-	}	
 		
 			
 
@@ -1863,48 +2128,132 @@ vector <double> calculate_AMI_profile( const TFasta_Content & S_Cerevisiae_Chrom
 
 
 
-void count_uORF_codons( const std::vector <TORF_Data> & ORF_Data )
+// Count the codons of the uORFs observed with at least 5 ribosomes (after their start codons, in each reading frame),
+//   either altogether, by cluster (plus the unclustered uORFs), or by data source (a uORF counting once for each of its
+//   sources).  The genes are split into one block per worker thread, each counted into a histogram of its own; the
+//   histograms are merged once every block is done
+void count_uORF_codons( const vector <TORF_Data> & ORF_Data, const Tenum_codon_breakdowns breakdown )
 {
-	vector <unsigned int> num_codons( pow( (unsigned int)NUM_DIFF_NT, 3 ), 0 );
-
-	for( unsigned int ORF_it = 0; ORF_it < ORF_Data.size(); ORF_it++ )
+	// ------------------------------
+	// Name the groups the uORFs are counted in
+	vector <string> group_names;
+	vector <TInterned_String> source_authors;
+	
+	switch( breakdown )
 	{
-		vector <TuORF_Data> uORFs = ORF_Data[ORF_it].get_uORFs();
+		case CODON_BREAKDOWN_BY_CLUSTER :
+		{
+			for( unsigned int i = 0; i < NUM_CLUSTERS; i++ ) { group_names.push_back( (string)"cluster " + get_str( i ) ); }
+			group_names.push_back( "unclustered" );
+			break;
+		}
 		
-
-		for( unsigned int uORF_it = 0; uORF_it < uORFs.size(); uORF_it++ )
+		case CODON_BREAKDOWN_BY_SOURCE :
 		{
-			if( uORFs[uORF_it].problem == FALSE &&  uORFs[uORF_it].num_ribosomes >= 5 )
+			for( unsigned int i = 0; i < ORF_Data.size(); i++ )
 			{
-				vector <unsigned int> numeric_DNA_uORF = convert_DNA_string_to_num( uORFs[uORF_it].content );
+				const vector <TuORF_Data> & uORFs = ORF_Data[i].get_uORFs();
 				
-				for(unsigned int start_it = 3; start_it < numeric_DNA_uORF.size(); start_it += 3 )
+				for( unsigned int m = 0; m < uORFs.size(); m++ )
 				{
-					unsigned int codon_it = 0;
-					
-					codon_it += ( NUM_DIFF_NT * NUM_DIFF_NT * numeric_DNA_uORF[start_it    ] ) +
-								( 				NUM_DIFF_NT * numeric_DNA_uORF[start_it + 1] ) +
-								( 							  numeric_DNA_uORF[start_it + 2] );
-					
-					num_codons[codon_it]++;
+					for( unsigned int j = 0; j < uORFs[m].source.size(); j++ )
+					{
+						const TInterned_String author = uORFs[m].source[j].get_author();
+						
+						if( find( source_authors.begin(), source_authors.end(), author ) == source_authors.end() )
+						{
+							source_authors.push_back( author );
+							group_names.push_back( author.str() );
+						}
+					}
 				}
 			}
+			break;
+		}
+		
+		default :
+		{
+			group_names.push_back( "all uORFs" );
+			break;
 		}
 	}
+	// ------------------------------
 	
 	
-	for( unsigned int codon_it = 0; codon_it < num_codons.size(); codon_it++ )
+	
+	// ------------------------------
+	// Count each block of genes into its own histogram
+	const unsigned int num_blocks = max( 1u, min( get_num_worker_threads(), (unsigned int)ORF_Data.size() ) );
+	
+	vector <TCodon_Histogram> block_histograms( num_blocks, TCodon_Histogram( group_names.size() ) );
+	vector <string> block_errors( num_blocks, "" );
+	
+	parallel_for( num_blocks, [&]( const unsigned int block_it )
 	{
-		vector <unsigned int> codon_numeric( 3, NT_A );
+		const unsigned int first_ORF_it =   block_it 	  * ORF_Data.size() / num_blocks;
+		const unsigned int end_ORF_it	= ( block_it + 1 ) * ORF_Data.size() / num_blocks;
 		
+		vector <unsigned int> groups;
 		
-		codon_numeric[0] = ( codon_it % ( NUM_DIFF_NT * NUM_DIFF_NT * NUM_DIFF_NT ) ) / ( NUM_DIFF_NT * NUM_DIFF_NT );
-		codon_numeric[1] = ( codon_it % ( NUM_DIFF_NT * NUM_DIFF_NT 			  ) ) /   NUM_DIFF_NT;
-		codon_numeric[2] =   codon_it %   NUM_DIFF_NT;
-		
+		for( unsigned int i = first_ORF_it; i < end_ORF_it; i++ )
+		{
+			const vector <TuORF_Data> & uORFs = ORF_Data[i].get_uORFs();
+			
+			for( unsigned int m = 0; m < uORFs.size(); m++ )
+			{
+				if( uORFs[m].problem == TRUE || uORFs[m].num_ribosomes < 5 ) { continue; }
+				
+				groups.clear();
+				
+				if( breakdown == CODON_BREAKDOWN_BY_CLUSTER )
+				{
+					groups.push_back( ( uORFs[m].cluster >= 0 && uORFs[m].cluster < NUM_CLUSTERS ) ? uORFs[m].cluster : NUM_CLUSTERS );
+				}
+				else if( breakdown == CODON_BREAKDOWN_BY_SOURCE )
+				{
+					for( unsigned int j = 0; j < uORFs[m].source.size(); j++ )
+					{
+						groups.push_back( find( source_authors.begin(), source_authors.end(), uORFs[m].source[j].get_author() ) - source_authors.begin() );
+					}
+				}
+				else/*( breakdown == CODON_BREAKDOWN_NONE )*/ { groups.push_back( 0 ); }
+				
+				
+				if( block_histograms[block_it].add_sequence( uORFs[m].content, 3, groups ) == FALSE )
+				{
+					block_errors[block_it] = (string)"Error in 'count_uORF_codons()': uORF " + get_str( m + 1 ) + " of '" + ORF_Data[i].gene_name + "' contains unrecognized characters. ";
+					return;
+				}
+			}
+		}
+	} );
+	
+	
+	for( unsigned int block_it = 0; block_it < num_blocks; block_it++ )
+	{
+		if( block_errors[block_it] != "" ) { Errors.handle_error( FATAL, block_errors[block_it], __FILE__, __LINE__ ); }
+	}
+	
+	TCodon_Histogram & num_codons = block_histograms[0];
+	for( unsigned int block_it = 1; block_it < num_blocks; block_it++ ) { num_codons.merge( block_histograms[block_it] ); }
+	// ------------------------------
+	
+	
+	
+	// ------------------------------
+	// Report the counts (frame 0, then frames +1 and +2) of each group
+	for( unsigned int group = 0; group < num_codons.get_num_groups(); group++ )
+	{
+		if( breakdown != CODON_BREAKDOWN_NONE ) { output_text_line( (string)"Codons of " + group_names[group] + ":" ); }
 		
-		output_text_line( (string)"Codon " + convert_DNA_num_to_string( codon_numeric ) + ": " + get_str( num_codons[codon_it] ) );
+		for( unsigned int codon_it = 0; codon_it < NUM_CODONS; codon_it++ )
+		{
+			output_text_line( (string)"Codon " + get_codon_str( codon_it ) + ": " + get_str( num_codons.get_count( group, 0, codon_it ) ) + 
+											   "  (frame +1: " + get_str( num_codons.get_count( group, 1, codon_it ) ) + 
+											   ", frame +2: "  + get_str( num_codons.get_count( group, 2, codon_it ) ) + ")" );
+		}
 	}
+	// ------------------------------
 	
 	
 	return;
@@ -1913,7 +2262,9 @@ void count_uORF_codons( const std::vector <TORF_Data> & ORF_Data )
 
 
 
-void cluster_uORF_context_profiles( vector <TORF_Data> * const ORF_Data )
+// Cluster the context profiles (the rows of 'context_profiles', from 'calc_mod_AMI_uORF_context()'), which serve as the
+//   training set as they are, and record each uORF's cluster and distortion
+void cluster_uORF_context_profiles( vector <TORF_Data> * const ORF_Data, TContext_Profile_Matrix * const context_profiles )
 {
 	// Make sure the number of clusters is a power of 2
 	double quotient = NUM_CLUSTERS;
@@ -1922,58 +2273,29 @@ void cluster_uORF_context_profiles( vector <TORF_Data> * const ORF_Data )
 	if( quotient != 1 ) { Errors.handle_error( FATAL, "Error in 'cluster_uORF_context_profiles()': Number of clusters specified is not a power of 2.", __FILE__, __LINE__ ); }
 
 	
-	float ** training_set;
+	float ** training_set = context_profiles->get_rows();
 	float ** clusters;
-	unsigned int vector_dimension = NUM_NUCLEOTIDE_PAIRS * ( MAX_NUM_BASES_APART_CONTEXT - MIN_NUM_BASES_APART_CONTEXT + 1 );
-	
-	unsigned int num_uORFs = 0;
-	for( unsigned int i = 0; i < ORF_Data->size(); i++ )
-	{
-		num_uORFs += ORF_Data->at(i).get_uORFs().size();
-	}
-	
-	training_set = (float **) calloc( num_uORFs, sizeof( float * ) );
-	for( unsigned int i = 0; i < num_uORFs; i++ )
-	{
-		training_set[i] = (float *)calloc( vector_dimension, sizeof( float ) );
-	}
-	
-	unsigned int ts_it = 0;
-	for( unsigned int i = 0; i < ORF_Data->size(); i++ )
-	{
-		vector <TuORF_Data> uORFs = ORF_Data->at(i).get_uORFs();
-
-		for( unsigned int j = 0; j < uORFs.size(); j++ )
-		{
-			copy( uORFs[j].context_profile.begin(), uORFs[j].context_profile.end(), training_set[ts_it] );
-
-			ts_it++;
-		}
-	}
+	unsigned int vector_dimension = context_profiles->get_dimension();
+	unsigned int num_uORFs 		  = context_profiles->get_num_rows();
 	
 	lbg_clustering( vector_dimension, NUM_CLUSTERS, num_uORFs, training_set, &clusters );
 	
-	ts_it = 0;
 	for( unsigned int i = 0; i < ORF_Data->size(); i++ )
 	{
-		vector <TuORF_Data> uORFs = ORF_Data->at(i).get_uORFs();
+		const vector <TuORF_Data> & uORFs = ORF_Data->at(i).get_uORFs();
 
 		for( unsigned int j = 0; j < uORFs.size(); j++ )
 		{
-			float distortion;
-			float * input;
-			input = (float *) calloc( vector_dimension,sizeof( float ) );
-			
-			for( unsigned int k = 0; k < vector_dimension; k++ )
+			if( uORFs[j].context_profile_row < 0 || (unsigned int)uORFs[j].context_profile_row >= num_uORFs )
 			{
-				input[k] = training_set[ts_it][k];
+				Errors.handle_error( FATAL, "Error in 'cluster_uORF_context_profiles()': uORF " + get_str( j + 1 ) + " of '" + ORF_Data->at(i).gene_name + "' has no context profile.", __FILE__, __LINE__ );
 			}
+			
+			float distortion;
+			int cluster = fvqe( training_set[ uORFs[j].context_profile_row ], clusters, NUM_CLUSTERS, vector_dimension, &distortion );
 
-
-			ORF_Data->at(i).update_cluster   ( j, fvqe( training_set[ts_it], clusters, NUM_CLUSTERS, vector_dimension, &distortion ) );
+			ORF_Data->at(i).update_cluster   ( j, cluster 	 );
 			ORF_Data->at(i).update_distortion( j, distortion );
-
-			ts_it++;
 		}
 	}
 	
@@ -2027,13 +2349,6 @@ void cluster_uORF_context_profiles( vector <TORF_Data> * const ORF_Data )
 	}
 
 	free(clusters);
-
-	for( unsigned int i = 0; i < num_uORFs; i++ )
-	{
-		free( training_set[i] );
-	}
-
-	free(training_set);
 	
 	return;
 }
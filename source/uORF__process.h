@@ -58,6 +58,7 @@
 
 // Project-specific header files:  support functions and related
 #include "uORF__compile.h"
+#include "support__genome_partition.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -71,6 +72,112 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+//==============================================================================
+
+// An ORF's place in a sort, so that the sort moves these rather than the ORFs themselves (which are then moved into
+//   the sorted order once).  ORFs are ordered by 'segment_it' (the group to which the sort of each is restricted),
+//   then by 'GO_term' (if not NULL), then by position
+class TORF_Sort_Key
+{
+	public:
+		unsigned int segment_it;
+		const std::string * GO_term;		// The ORF's 'GO_term_to_sort_curr_level' (which must outlive the key)
+		unsigned long long position;		// 'chrom_num' in the upper 32 bits, the CDS start coordinate in the lower 32
+		unsigned int ORF_it;
+		
+		TORF_Sort_Key( const TORF_Data & sorted_ORF, const unsigned int sorted_ORF_it, const unsigned int key_segment_it = 0, const bool sort_by_GO_term = FALSE ) :
+			segment_it( key_segment_it ),
+			GO_term	  ( sort_by_GO_term ? &sorted_ORF.GO_term_to_sort_curr_level : NULL ),
+			position  ( ( (unsigned long long)sorted_ORF.chrom_num << 32 ) | sorted_ORF.gene_CDS.start_coord ),
+			ORF_it	  ( sorted_ORF_it )
+		{ }
+};
+//==============================================================================
+
+
+
+// How 'count_uORF_codons()' breaks down its counts
+enum Tenum_codon_breakdowns
+{
+	CODON_BREAKDOWN_NONE,
+	CODON_BREAKDOWN_BY_CLUSTER,
+	CODON_BREAKDOWN_BY_SOURCE,
+
+	NUM_CODON_BREAKDOWNS
+};
+//==============================================================================
+
+
+
+// Counts of each pair of nucleotides 'k' bases apart (for each 'k' from MIN_NUM_BASES_APART to MAX_NUM_BASES_APART),
+//   and of each nucleotide, over any number of segments of the genome.  Pairs are only counted within a segment, and
+//   only those starting in its first 'num_pair_starts' nucleotides (by default, all of them)
+class TNt_Pair_Counts
+{
+	public:
+		std::vector <std::vector <unsigned long> > num_instances_each_pair;		// By 'k - MIN_NUM_BASES_APART', then pair
+		std::vector <unsigned long> num_instances_each_distance;
+		std::vector <unsigned long> num_instances_each_nt;						// By 'Tenum_nucleotides'
+		unsigned long num_nt;
+
+		void add_segment( const TStrand_View & strand, const size_t start_pos, const size_t length ) { add_segment( strand, start_pos, length, length ); }
+		void add_segment( const TStrand_View & strand, const size_t start_pos, const size_t length, const size_t num_pair_starts );
+		void get_probs( std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt ) const;
+
+		TNt_Pair_Counts( void );
+};
+//==============================================================================
+
+
+
+// Width of each value of a context profile matrix written to disk (the values themselves are always held as floats,
+//   which 'lbg_clustering()' and 'fvqe()' read in place)
+enum Tenum_profile_value_types
+{
+	PROFILE_VALUE_UINT16,
+	PROFILE_VALUE_FLOAT,
+
+	NUM_PROFILE_VALUE_TYPES
+};
+//==============================================================================
+
+
+
+// The context profile of every uORF, as the rows of one contiguous matrix aligned to CONTEXT_PROFILE_ALIGNMENT bytes.
+//   Row pointers into it are kept alongside, so the clustering functions use the matrix as their training set without
+//   copying it, and the whole matrix is written to (or read from) a file as a single block
+class TContext_Profile_Matrix
+{
+	private:
+		float * values;								// 'num_rows * dimension' values, row by row
+		std::vector <float *> rows;
+		unsigned int num_rows;
+		unsigned int dimension;
+
+		void free_values( void );
+
+		// Not copyable (owns 'values')
+		TContext_Profile_Matrix( const TContext_Profile_Matrix & );
+		TContext_Profile_Matrix & operator=( const TContext_Profile_Matrix & );
+
+	public:
+		int resize( const unsigned int new_num_rows, const unsigned int new_dimension );
+
+		float * 	  get_row( const unsigned int row_it ) 		 { return values + (size_t)row_it * dimension; }
+		const float * get_row( const unsigned int row_it ) const { return values + (size_t)row_it * dimension; }
+		float ** 	  get_rows( void ) 							 { return rows.empty() ? NULL : &rows[0]; }
+
+		unsigned int get_num_rows ( void ) const { return num_rows;  }
+		unsigned int get_dimension( void ) const { return dimension; }
+
+		int write( const std::string & file_folder_path, const std::string & file_name, const Tenum_profile_value_types value_type ) const;
+		int read ( const std::string & file_folder_path, const std::string & file_name );
+
+		TContext_Profile_Matrix( void ) : values( NULL ), num_rows( 0 ), dimension( 0 ) { }
+		~TContext_Profile_Matrix( void ) { free_values(); }
+};
+//==============================================================================
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -89,6 +196,8 @@ void check_for_matching_GO_terms( std::vector <TORF_Data> * const ORF_Data );
 
 bool compare_ORF_positions( const TORF_Data & ORF_1, const TORF_Data & ORF_2 );
 bool compare_ORF_GO_terms ( const TORF_Data & ORF_1, const TORF_Data & ORF_2 );
+bool compare_ORF_sort_keys( const TORF_Sort_Key & key_1, const TORF_Sort_Key & key_2 );
+void permute_ORFs( const std::vector <unsigned int> & ORF_order, std::vector <TORF_Data> * const ORF_Data );
 
 void write_uORFs_to_csv( const std::vector <TORF_Data> & ORF_Data, 
 						 const std::vector <Tenum_uORF_CSV_columns> & col_to_write, 
@@ -101,16 +210,18 @@ std::string get_uORF_list_file_name( const bool & file_naming_method, const bool
 void write_sequences_to_fasta( const std::vector <TORF_Data> & ORF_Data );
 
 void count_nucleotides				 ( const TFasta_Content & S_Cerevisiae_Chrom );
-void calc_joint_prob_nt_genes 		 ( const TFasta_Content & S_Cerevisiae_Chrom, const std::vector <TORF_Data> & ORF_Data, std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
-void calc_joint_prob_nt_TL    		 ( const TFasta_Content & S_Cerevisiae_Chrom, const std::vector <TORF_Data> & ORF_Data, std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
+void build_genome_partition		 ( const TFasta_Content & S_Cerevisiae_Chrom, const std::vector <TORF_Data> & ORF_Data, TGenome_Partition * const genome_partition );
+void calc_joint_prob_nt_segments	 ( const TGenome_Partition & genome_partition, const std::vector <Tenum_genome_segment_types> & segment_types, std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
+void calc_joint_prob_nt_genes 		 ( const TGenome_Partition & genome_partition, const std::vector <TORF_Data> & ORF_Data, std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
+void calc_joint_prob_nt_TL    		 ( const TGenome_Partition & genome_partition, const std::vector <TORF_Data> & ORF_Data, std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
 void calc_AMI_uORFs			  		 ( const TFasta_Content & S_Cerevisiae_Chrom, const std::vector <TORF_Data> & ORF_Data );
-void calc_mod_AMI_uORF_context	  	 ( const TFasta_Content & S_Cerevisiae_Chrom, std::vector <TORF_Data> * const ORF_Data );
+void calc_mod_AMI_uORF_context	  	 ( std::vector <TORF_Data> * const ORF_Data, TContext_Profile_Matrix * const context_profiles );
 void calc_joint_prob_nt_genome		 ( const TFasta_Content & S_Cerevisiae_Chrom, 											std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
 void calc_joint_prob_nt_sequence	 ( const string & sequence, 															std::vector <std::vector <double> > * const joint_prob_nt, std::vector <double> * const marginal_prob_nt );
 vector <double> calculate_AMI_profile( const TFasta_Content & S_Cerevisiae_Chrom, const std::vector <TORF_Data> & ORF_Data, const std::vector <std::vector <double> > & joint_prob_nt, const std::vector <double> & marginal_prob_nt );
 
-void count_uORF_codons( const std::vector <TORF_Data> & ORF_Data );
-void cluster_uORF_context_profiles(std::vector<TORF_Data> * const ORF_Data);
+void count_uORF_codons( const std::vector <TORF_Data> & ORF_Data, const Tenum_codon_breakdowns breakdown = CODON_BREAKDOWN_NONE );
+void cluster_uORF_context_profiles( std::vector <TORF_Data> * const ORF_Data, TContext_Profile_Matrix * const context_profiles );
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,1046 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : uORF__query.cpp
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Source code for the query daemon, which loads the uORF
+//				 database once and answers queries about it until told to quit
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Source (.cpp) File
+//      (Note:  (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Global Variable Declarations (including those in other files)
+//      C. Member Function Definitions
+//      D. Non-Member Function Definitions
+//     *E. UNUSED Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <ctime>
+
+#ifndef _WIN32
+	#include <sys/types.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+#include "defs__appl_parameters.h"
+
+// Project-specific header files:  support functions and related
+#include "support__general.h"
+#include "support__logging.h"
+#include "support__file_io.h"
+#include "support__bioinformatics.h"
+#include "uORF__compile.h"
+#include "uORF__process.h"
+
+// Header file for this file
+#include "uORF__query.h"
+
+
+
+#define QUERY_RECV_BUFFER_SIZE				4096
+#define QUERY_MAX_LINE_LENGTH				65536				// Longer lines from a socket client are answered with an error
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Global Variable Declarations (including those in other files)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+extern TErrors Errors;						// Stores information about errors and responds to them in several ways
+
+
+// The uORF fields that 'UORFS' queries can filter on (those 'indexed' are given a 'TAttribute_Index')
+struct TQuery_Field
+{
+	const char * name;
+	double ( *get_value )( const TuORF_Data & uORF );
+	bool indexed;
+};
+
+static const TQuery_Field QUERY_FIELDS[] =
+{
+	{ "AUGCAI", 			 []( const TuORF_Data & uORF ) { return uORF.AUGCAI; 					  }, TRUE  },
+	{ "cluster", 			 []( const TuORF_Data & uORF ) { return (double)uORF.cluster; 			  }, TRUE  },
+	{ "len", 				 []( const TuORF_Data & uORF ) { return (double)uORF.len; 				  }, FALSE },
+	{ "rel_pos", 			 []( const TuORF_Data & uORF ) { return (double)uORF.rel_uORF_pos; 		  }, FALSE },
+	{ "start_pos", 			 []( const TuORF_Data & uORF ) { return (double)uORF.start_pos; 		  }, FALSE },
+	{ "distance_to_tss", 	 []( const TuORF_Data & uORF ) { return (double)uORF.distance_to_tss; 	  }, FALSE },
+	{ "num_ribosomes", 		 []( const TuORF_Data & uORF ) { return (double)uORF.num_ribosomes; 	  }, FALSE },
+	{ "num_mRNA", 			 []( const TuORF_Data & uORF ) { return (double)uORF.num_mRNA; 			  }, FALSE },
+	{ "prob_of_translation", []( const TuORF_Data & uORF ) { return uORF.prob_of_translation; 		  }, TRUE  },
+	{ "cap_distance_index",  []( const TuORF_Data & uORF ) { return uORF.cap_distance_index; 		  }, TRUE  },
+	{ "avg_cap_dist", 		 []( const TuORF_Data & uORF ) { return uORF.avg_cap_dist; 				  }, FALSE },
+	{ "distortion", 		 []( const TuORF_Data & uORF ) { return uORF.distortion; 				  }, TRUE  },
+	{ "in_frame", 			 []( const TuORF_Data & uORF ) { return (double)uORF.in_frame; 			  }, FALSE },
+	{ "start_codon", 		 []( const TuORF_Data & uORF ) { return (double)uORF.start_codon; 		  }, FALSE }
+};
+
+static const unsigned int NUM_QUERY_FIELDS = sizeof( QUERY_FIELDS ) / sizeof( QUERY_FIELDS[0] );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// C. Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+void TInterval_Index::add( const unsigned int first_coord, const unsigned int last_coord, const unsigned int id )
+{
+	nodes.push_back( TInterval_Node( first_coord, last_coord + 1, id ) );
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Sort the intervals, then fill in each node's 'max_end' level by level (leaves are the even positions; a node at
+//   level 'k' has children 2^(k-1) to either side).  A child past the end of the array stands in for the rightmost
+//   existing subtree at that level, whose 'max_end' is tracked in 'last_max_end'
+void TInterval_Index::build( void )
+{
+	sort( nodes.begin(), nodes.end(), []( const TInterval_Node & node_1, const TInterval_Node & node_2 )
+	{
+		return ( node_1.start < node_2.start || ( node_1.start == node_2.start && node_1.id < node_2.id ) );
+	} );
+
+	max_level = -1;
+	if( nodes.empty() ) { return; }
+
+	const size_t num_nodes = nodes.size();
+	size_t last_it = 0;
+	unsigned int last_max_end = 0;
+
+	for( size_t i = 0; i < num_nodes; i += 2 )
+	{
+		last_it = i;
+		last_max_end = nodes[i].max_end = nodes[i].end;
+	}
+
+	int level = 1;
+
+	for( ; ( (size_t)1 << level ) <= num_nodes; level++ )
+	{
+		const size_t child_offset = (size_t)1 << ( level - 1 );
+
+		for( size_t i = ( child_offset << 1 ) - 1; i < num_nodes; i += ( child_offset << 2 ) )
+		{
+			const unsigned int left_max_end  = nodes[ i - child_offset ].max_end;
+			const unsigned int right_max_end = ( i + child_offset < num_nodes ) ? nodes[ i + child_offset ].max_end : last_max_end;
+
+			nodes[i].max_end = max( nodes[i].end, max( left_max_end, right_max_end ) );
+		}
+
+		last_it = ( ( last_it >> level ) & 1 ) ? last_it - child_offset : last_it + child_offset;
+
+		if( last_it < num_nodes && nodes[last_it].max_end > last_max_end ) { last_max_end = nodes[last_it].max_end; }
+	}
+
+	max_level = level - 1;
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Append the IDs of the intervals overlapping [first_coord, last_coord], in order of their start
+void TInterval_Index::find_overlapping( const unsigned int first_coord, const unsigned int last_coord, vector <unsigned int> * const ids ) const
+{
+	if( max_level < 0 ) { return; }
+
+	const size_t num_nodes = nodes.size();
+	const unsigned int query_start = first_coord;
+	const unsigned int query_end   = last_coord + 1;
+
+	// Each entry is a subtree root, its level, and whether its left subtree has been visited
+	struct TVisit { size_t node_it; int level; bool left_done; };
+
+	TVisit stack[64];
+	int stack_size = 0;
+
+	stack[ stack_size++ ] = { ( (size_t)1 << max_level ) - 1, max_level, false };
+
+	while( stack_size > 0 )
+	{
+		const TVisit visit = stack[ --stack_size ];
+
+		if( visit.level <= 3 )
+		{
+			// Small subtree:  scan it in order
+			const size_t first_it = ( visit.node_it >> visit.level ) << visit.level;
+			const size_t last_it  = min( first_it + ( (size_t)1 << ( visit.level + 1 ) ) - 1, num_nodes );
+
+			for( size_t i = first_it; i < last_it && nodes[i].start < query_end; i++ )
+			{
+				if( query_start < nodes[i].end ) { ids->push_back( nodes[i].id ); }
+			}
+		}
+		else if( visit.left_done == false )
+		{
+			const size_t left_it = visit.node_it - ( (size_t)1 << ( visit.level - 1 ) );
+
+			stack[ stack_size++ ] = { visit.node_it, visit.level, true };
+
+			// Skip the left subtree if none of its intervals end after the range starts
+			if( left_it >= num_nodes || nodes[left_it].max_end > query_start )
+			{
+				stack[ stack_size++ ] = { left_it, visit.level - 1, false };
+			}
+		}
+		else if( visit.node_it < num_nodes && nodes[ visit.node_it ].start < query_end )
+		{
+			if( query_start < nodes[ visit.node_it ].end ) { ids->push_back( nodes[ visit.node_it ].id ); }
+
+			stack[ stack_size++ ] = { visit.node_it + ( (size_t)1 << ( visit.level - 1 ) ), visit.level - 1, false };
+		}
+	}
+
+	return;
+}
+//==============================================================================
+
+
+
+void TAttribute_Index::build( const vector <double> & values_by_id )
+{
+	ids.clear();
+
+	for( unsigned int i = 0; i < values_by_id.size(); i++ )
+	{
+		if( values_by_id[i] == values_by_id[i] ) { ids.push_back( i ); }		// Not NaN
+	}
+
+	stable_sort( ids.begin(), ids.end(), [&]( const unsigned int id_1, const unsigned int id_2 ) { return values_by_id[id_1] < values_by_id[id_2]; } );
+
+	values.resize( ids.size() );
+	for( unsigned int i = 0; i < ids.size(); i++ ) { values[i] = values_by_id[ ids[i] ]; }
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// The range [*first_it, *last_it) of the sorted uORFs meeting "<value> <cond_op> <cond_value>".  Returns FALSE if the
+//   condition can't be answered from the index ('!=', which NaN values also meet)
+bool TAttribute_Index::find_range( const string & cond_op, const double cond_value, unsigned int * const first_it, unsigned int * const last_it ) const
+{
+	const unsigned int lower_it = lower_bound( values.begin(), values.end(), cond_value ) - values.begin();
+	const unsigned int upper_it = upper_bound( values.begin(), values.end(), cond_value ) - values.begin();
+
+	if	   ( cond_value != cond_value ) { *first_it = 0; 		*last_it = 0; 			   }	// NaN:  nothing compares true
+	else if( cond_op == "<"  ) 			{ *first_it = 0; 		*last_it = lower_it; 	   }
+	else if( cond_op == "<=" ) 			{ *first_it = 0; 		*last_it = upper_it; 	   }
+	else if( cond_op == ">"  ) 			{ *first_it = upper_it; *last_it = values.size(); }
+	else if( cond_op == ">=" ) 			{ *first_it = lower_it; *last_it = values.size(); }
+	else if( cond_op == "="  ) 			{ *first_it = lower_it; *last_it = upper_it; 	   }
+	else 								{ return FALSE; }
+
+	return TRUE;
+}
+//==============================================================================
+
+
+
+// Load the database the same way a batch run does (so a snapshot always matches the uORF list the run would write), but
+//   without writing any of the run's output files, so that a RELOAD doesn't overwrite them
+int TQuery_Snapshot::load( void )
+{
+	const chrono::steady_clock::time_point load_start = chrono::steady_clock::now();
+
+	S_Cerevisiae_Chrom.reset( new TFasta_Content( PATH_S_CEREVISIA_FASTA_FOLDER, S_CEREVISIAE_GFF_FILE_NAME ) );
+
+	if( S_Cerevisiae_Chrom->get_contents_from_gff() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TQuery_Snapshot::load()': Unable to read the genome. ", __FILE__, __LINE__ );
+	}
+
+	parse_GO_hierarchy( &All_GO_Annotations );
+
+	compile_uORF_list( *S_Cerevisiae_Chrom, &ORF_Data );
+	sort_and_consolidate( &ORF_Data );
+	determine_ORF_and_uORF_characteristics( *S_Cerevisiae_Chrom, &ORF_Data, FALSE );
+
+	build_indexes();
+
+	load_time_ms 	 = chrono::duration <double, milli>( chrono::steady_clock::now() - load_start ).count();
+	load_finish_time = get_abs_time_formatted( time( NULL ) );
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+void TQuery_Snapshot::build_indexes( void )
+{
+	ORF_first_uORF.assign( 1, 0 );
+
+	for( unsigned int i = 0; i < ORF_Data.size(); i++ )
+	{
+		const vector <TuORF_Data> ORF_uORFs = ORF_Data[i].get_uORFs();
+
+		uORFs.insert( uORFs.end(), ORF_uORFs.begin(), ORF_uORFs.end() );
+		uORF_ORF_it.insert( uORF_ORF_it.end(), ORF_uORFs.size(), i );
+		ORF_first_uORF.push_back( uORFs.size() );
+
+		// A gene listed more than once keeps its first position (as with 'find_ORF()')
+		ORF_it_by_gene.insert( make_pair( ORF_Data[i].gene_name.get_symbol(), i ) );
+
+
+		// Each ORF's annotations already include the parents of its terms, so a term's list covers its descendants too
+		vector <TSymbol_ID> ORF_terms;
+
+		for( unsigned int j = 0; j < ORF_Data[i].GO_Annotations.size(); j++ )
+		{
+			for( unsigned int k = 0; k < ORF_Data[i].GO_Annotations[j].GO_Terms.size(); k++ )
+			{
+				ORF_terms.push_back( ORF_Data[i].GO_Annotations[j].GO_Terms[k].name.get_symbol() );
+			}
+		}
+
+		sort( ORF_terms.begin(), ORF_terms.end() );
+		ORF_terms.erase( unique( ORF_terms.begin(), ORF_terms.end() ), ORF_terms.end() );
+
+		for( unsigned int j = 0; j < ORF_terms.size(); j++ )
+		{
+			ORF_its_by_GO_term[ ORF_terms[j] ].push_back( i );
+		}
+
+
+		// Each uORF spans 'len' nucleotides from its start codon, in the direction of transcription
+		const unsigned int interval_it = ORF_Data[i].chrom_num * 2 + ( ORF_Data[i].opposite_strand == TRUE ? 1 : 0 );
+		if( interval_it >= uORF_intervals.size() ) { uORF_intervals.resize( interval_it + 1 ); }
+
+		for( unsigned int j = ORF_first_uORF[i]; j < ORF_first_uORF[i + 1]; j++ )
+		{
+			const unsigned int span = ( uORFs[j].len > 0 ) ? uORFs[j].len - 1 : 0;
+
+			if	  ( ORF_Data[i].opposite_strand == FALSE ) { uORF_intervals[interval_it].add( uORFs[j].start_pos, uORFs[j].start_pos + span, j ); }
+			else/*( ORF_Data[i].opposite_strand == TRUE )*/{ uORF_intervals[interval_it].add( ( uORFs[j].start_pos > span ) ? uORFs[j].start_pos - span : 0, uORFs[j].start_pos, j ); }
+		}
+	}
+
+	for( unsigned int i = 0; i < uORF_intervals.size(); i++ ) { uORF_intervals[i].build(); }
+
+
+	uORF_attributes.assign( NUM_QUERY_FIELDS, TAttribute_Index() );
+
+	for( unsigned int i = 0; i < NUM_QUERY_FIELDS; i++ )
+	{
+		if( QUERY_FIELDS[i].indexed == FALSE ) { continue; }
+
+		vector <double> values_by_id( uORFs.size() );
+		for( unsigned int j = 0; j < uORFs.size(); j++ ) { values_by_id[j] = QUERY_FIELDS[i].get_value( uORFs[j] ); }
+
+		uORF_attributes[i].build( values_by_id );
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// "gene, rel_pos, start_pos, len, AUGCAI, cluster, prob_of_translation, sequence" (tab-separated)
+string TQuery_Snapshot::format_uORF_row( const unsigned int uORF_it ) const
+{
+	const TuORF_Data & uORF = uORFs[uORF_it];
+
+	ostringstream row_oss;
+	row_oss << ORF_Data[ uORF_ORF_it[uORF_it] ].gene_name << "\t"
+			<< uORF.rel_uORF_pos 		<< "\t"
+			<< uORF.start_pos 			<< "\t"
+			<< uORF.len 				<< "\t"
+			<< uORF.AUGCAI 				<< "\t"
+			<< uORF.cluster 			<< "\t"
+			<< uORF.prob_of_translation << "\t"
+			<< uORF.content 			<< "\n";
+
+	return row_oss.str();
+}
+//==============================================================================
+
+
+
+shared_ptr <const TQuery_Snapshot> TQuery_Daemon::get_snapshot( void ) const
+{
+	return atomic_load( &snapshot );
+}
+//------------------------------------------------------------------------------
+
+
+// Load the first snapshot (on the calling thread, so a failure here ends the program as it would a batch run)
+int TQuery_Daemon::load( void )
+{
+	shared_ptr <TQuery_Snapshot> new_snapshot( new TQuery_Snapshot );
+
+	if( new_snapshot->load() )
+	{
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TQuery_Daemon::load()': ", __FILE__, __LINE__ );
+	}
+
+	atomic_store( &snapshot, shared_ptr <const TQuery_Snapshot>( new_snapshot ) );
+
+	return SUCCESSFUL;
+}
+//------------------------------------------------------------------------------
+
+
+// Returns FALSE if a reload is already in progress
+bool TQuery_Daemon::start_reload( void )
+{
+	lock_guard <mutex> reload_lock( reload_mutex );
+
+	if( reload_in_progress == true || stop_requested == true ) { return FALSE; }
+
+	if( reload_thread.joinable() ) { reload_thread.join(); }
+
+	reload_in_progress = true;
+	reload_thread = thread( &TQuery_Daemon::reload, this );
+
+	return TRUE;
+}
+//------------------------------------------------------------------------------
+
+
+// Run on a thread of its own.  The load is run as a task, so that an error while loading abandons only the new snapshot
+void TQuery_Daemon::reload( void )
+{
+	TError_Collector reload_errors( "'TQuery_Daemon::reload()' (loading a new snapshot)", TASK_ERROR_SKIP );
+	shared_ptr <TQuery_Snapshot> new_snapshot( new TQuery_Snapshot );
+
+	reload_errors.run_task( 0, [&]( )
+	{
+		if( new_snapshot->load() )
+		{
+			Errors.handle_error( FATAL, "Unable to load the new snapshot. ", __FILE__, __LINE__ );
+		}
+	} );
+
+	if( reload_errors.did_task_fail( 0 ) == FALSE )
+	{
+		atomic_store( &snapshot, shared_ptr <const TQuery_Snapshot>( new_snapshot ) );
+		num_reloads++;
+
+		output_text_line( "Query daemon:  reloaded the uORF database (" + format_time_elapsed( 0, new_snapshot->load_time_ms, MILLISECONDS ) + ")" );
+	}
+	else/*( reload_errors.did_task_fail( 0 ) == TRUE )*/
+	{
+		reload_errors.report();
+		output_text_line( "Query daemon:  reload failed; still answering queries from the previous snapshot" );
+	}
+
+	reload_in_progress = false;
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Answer one query, returning "OK <n>" followed by 'n' lines of results, or "ERR <message>" (each line ending in '\n').
+//   Called concurrently by every client, so it must not report errors through 'Errors'
+string TQuery_Daemon::answer_query( const string & query_line, bool * const quit )
+{
+	const chrono::steady_clock::time_point query_start = chrono::steady_clock::now();
+
+	*quit = FALSE;
+
+	istringstream query_iss( query_line );
+	string command;
+	query_iss >> command;
+	transform( command.begin(), command.end(), command.begin(), ::toupper );
+
+	const shared_ptr <const TQuery_Snapshot> curr_snapshot = get_snapshot();
+
+	ostringstream results_oss;
+	unsigned int num_results = 0;
+	string error_msg = "";
+
+
+	if( command == "" )
+	{
+		return "";
+	}
+	else if( command == "GENE" )
+	{
+		// "GENE <systematic name>":  the gene's uORFs
+		string gene_name;
+		query_iss >> gene_name;
+
+		const TSymbol_ID gene_symbol = get_symbol_table().find( gene_name );
+		const unordered_map <TSymbol_ID, unsigned int>::const_iterator gene_it = curr_snapshot->ORF_it_by_gene.find( gene_symbol );
+
+		if( gene_name == "" || gene_it == curr_snapshot->ORF_it_by_gene.end() )
+		{
+			error_msg = "unknown gene '" + gene_name + "'";
+		}
+		else
+		{
+			for( unsigned int i = curr_snapshot->ORF_first_uORF[gene_it->second]; i < curr_snapshot->ORF_first_uORF[gene_it->second + 1]; i++ )
+			{
+				results_oss << curr_snapshot->format_uORF_row( i );
+				num_results++;
+			}
+		}
+	}
+	else if( command == "UORFS" )
+	{
+		// "UORFS [<field> <op> <value> [AND <field> <op> <value> ...]]":  every uORF meeting all of the conditions
+		vector <unsigned int> cond_fields;
+		vector <string> 	  cond_ops;
+		vector <double> 	  cond_values;
+
+		string field_name;
+
+		while( error_msg == "" && query_iss >> field_name )
+		{
+			string cap_field_name = field_name;
+			transform( cap_field_name.begin(), cap_field_name.end(), cap_field_name.begin(), ::toupper );
+
+			if( cap_field_name == "AND" ) { continue; }
+
+			// Field names are matched regardless of case
+			unsigned int field_it = 0;
+
+			for( ; field_it < NUM_QUERY_FIELDS; field_it++ )
+			{
+				string cap_query_field = QUERY_FIELDS[field_it].name;
+				transform( cap_query_field.begin(), cap_query_field.end(), cap_query_field.begin(), ::toupper );
+
+				if( cap_query_field == cap_field_name ) { break; }
+			}
+
+			string cond_op;
+			double cond_value;
+
+			if( field_it >= NUM_QUERY_FIELDS )
+			{
+				error_msg = "unknown field '" + field_name + "'";
+			}
+			else if( !( query_iss >> cond_op >> cond_value ) )
+			{
+				error_msg = "expected '<op> <value>' after '" + field_name + "'";
+			}
+			else if( cond_op != "<" && cond_op != "<=" && cond_op != ">" && cond_op != ">=" && cond_op != "=" && cond_op != "!=" )
+			{
+				error_msg = "unknown operator '" + cond_op + "'";
+			}
+			else
+			{
+				cond_fields.push_back( field_it );
+				cond_ops.push_back( cond_op );
+				cond_values.push_back( cond_value );
+			}
+		}
+
+		// Start from the narrowest range any indexed condition selects (or from every uORF, if none is indexed), so a
+		//   selective query only looks at about as many uORFs as it returns
+		const unsigned int num_uORFs = curr_snapshot->uORFs.size();
+		unsigned int plan_cond_it = cond_fields.size();
+		unsigned int plan_first_it = 0;
+		unsigned int plan_last_it  = num_uORFs;
+
+		for( unsigned int j = 0; error_msg == "" && j < cond_fields.size(); j++ )
+		{
+			const TAttribute_Index & attribute_index = curr_snapshot->uORF_attributes[ cond_fields[j] ];
+			unsigned int first_it, last_it;
+
+			if( QUERY_FIELDS[ cond_fields[j] ].indexed == TRUE &&
+				attribute_index.find_range( cond_ops[j], cond_values[j], &first_it, &last_it ) == TRUE &&
+				last_it - first_it < plan_last_it - plan_first_it )
+			{
+				plan_cond_it  = j;
+				plan_first_it = first_it;
+				plan_last_it  = last_it;
+			}
+		}
+
+		vector <unsigned int> candidates;
+
+		if( error_msg == "" && plan_cond_it < cond_fields.size() )
+		{
+			candidates.reserve( plan_last_it - plan_first_it );
+
+			for( unsigned int i = plan_first_it; i < plan_last_it; i++ ) { candidates.push_back( curr_snapshot->uORF_attributes[ cond_fields[plan_cond_it] ].get_id( i ) ); }
+
+			sort( candidates.begin(), candidates.end() );		// Results are listed in ORF order, however they were found
+		}
+		else if( error_msg == "" )
+		{
+			candidates.resize( num_uORFs );
+			for( unsigned int i = 0; i < num_uORFs; i++ ) { candidates[i] = i; }
+		}
+
+		for( unsigned int candidate_it = 0; candidate_it < candidates.size(); candidate_it++ )
+		{
+			const unsigned int i = candidates[candidate_it];
+			bool conds_met = TRUE;
+
+			for( unsigned int j = 0; j < cond_fields.size() && conds_met == TRUE; j++ )
+			{
+				if( j == plan_cond_it ) { continue; }
+
+				const double value = QUERY_FIELDS[ cond_fields[j] ].get_value( curr_snapshot->uORFs[i] );
+
+				if	   ( cond_ops[j] == "<"  ) { conds_met = ( value <  cond_values[j] ); }
+				else if( cond_ops[j] == "<=" ) { conds_met = ( value <= cond_values[j] ); }
+				else if( cond_ops[j] == ">"  ) { conds_met = ( value >  cond_values[j] ); }
+				else if( cond_ops[j] == ">=" ) { conds_met = ( value >= cond_values[j] ); }
+				else if( cond_ops[j] == "="  ) { conds_met = ( value == cond_values[j] ); }
+				else/*( cond_ops[j] == "!=" )*/{ conds_met = ( value != cond_values[j] ); }
+			}
+
+			if( conds_met == TRUE )
+			{
+				results_oss << curr_snapshot->format_uORF_row( i );
+				num_results++;
+			}
+		}
+	}
+	else if( command == "REGION" )
+	{
+		// "REGION <chrom> <first coord> <last coord> [+|-]":  the uORFs overlapping the coordinates (on either strand,
+		//   unless one is given)
+		unsigned int chrom_num, first_coord, last_coord;
+		string strand = "";
+
+		if( !( query_iss >> chrom_num >> first_coord >> last_coord ) || first_coord > last_coord )
+		{
+			error_msg = "expected '<chrom> <first coord> <last coord> [+|-]'";
+		}
+		else if( ( query_iss >> strand ) && strand != "+" && strand != "-" )
+		{
+			error_msg = "unknown strand '" + strand + "'";
+		}
+		else
+		{
+			vector <unsigned int> overlapping;
+
+			for( unsigned int opposite_strand = 0; opposite_strand < 2; opposite_strand++ )
+			{
+				const unsigned int interval_it = chrom_num * 2 + opposite_strand;
+
+				if( interval_it >= curr_snapshot->uORF_intervals.size() || strand == ( opposite_strand == 0 ? "-" : "+" ) ) { continue; }
+
+				curr_snapshot->uORF_intervals[interval_it].find_overlapping( first_coord, last_coord, &overlapping );
+			}
+
+			sort( overlapping.begin(), overlapping.end() );
+
+			for( unsigned int i = 0; i < overlapping.size(); i++ )
+			{
+				results_oss << curr_snapshot->format_uORF_row( overlapping[i] );
+				num_results++;
+			}
+		}
+	}
+	else if( command == "GO" )
+	{
+		// "GO <term>":  the genes annotated with the term (or any of its descendants)
+		string GO_term;
+		getline( query_iss >> ws, GO_term );
+
+		while( GO_term.size() > 0 && is_char_white_space( GO_term, GO_term.size() - 1 ) ) { GO_term.erase( GO_term.size() - 1 ); }
+
+		const TSymbol_ID term_symbol = get_symbol_table().find( GO_term );
+		const unordered_map <TSymbol_ID, vector <unsigned int> >::const_iterator term_it = curr_snapshot->ORF_its_by_GO_term.find( term_symbol );
+
+		if( term_it == curr_snapshot->ORF_its_by_GO_term.end() )
+		{
+			bool term_in_hierarchy = FALSE;
+
+			for( unsigned int i = 0; i < curr_snapshot->All_GO_Annotations.size() && term_in_hierarchy == FALSE; i++ )
+			{
+				for( unsigned int j = 0; j < curr_snapshot->All_GO_Annotations[i].GO_Terms.size(); j++ )
+				{
+					if( curr_snapshot->All_GO_Annotations[i].GO_Terms[j].name.get_symbol() == term_symbol ) { term_in_hierarchy = TRUE; break; }
+				}
+			}
+
+			if( term_in_hierarchy == FALSE ) { error_msg = "unknown GO term '" + GO_term + "'"; }
+		}
+		else
+		{
+			for( unsigned int i = 0; i < term_it->second.size(); i++ )
+			{
+				results_oss << curr_snapshot->ORF_Data[ term_it->second[i] ].gene_name << "\n";
+				num_results++;
+			}
+		}
+	}
+	else if( command == "STATS" )
+	{
+		const unsigned long long queries_answered = num_queries;
+
+		results_oss << "genes\t"			  << curr_snapshot->ORF_Data.size() 			<< "\n"
+					<< "uORFs\t"			  << curr_snapshot->uORFs.size() 				<< "\n"
+					<< "GO_terms_annotated\t" << curr_snapshot->ORF_its_by_GO_term.size() 	<< "\n"
+					<< "loaded\t"			  << curr_snapshot->load_finish_time 			<< "\n"
+					<< "load_time_ms\t"		  << curr_snapshot->load_time_ms 				<< "\n"
+					<< "reloads\t"			  << num_reloads 								<< "\n"
+					<< "reload_in_progress\t" << ( reload_in_progress == true ? 1 : 0 ) 	<< "\n"
+					<< "queries\t"			  << queries_answered 							<< "\n"
+					<< "avg_query_time_us\t"  << ( queries_answered == 0 ? 0 : total_query_time_us / queries_answered ) << "\n";
+		num_results = 9;
+	}
+	else if( command == "RELOAD" )
+	{
+		if( start_reload() == FALSE ) { error_msg = "reload already in progress"; }
+		else 						  { results_oss << "reload started\n"; num_results = 1; }
+	}
+	else if( command == "HELP" )
+	{
+		results_oss << "GENE <systematic name>\n"
+					<< "UORFS [<field> <op> <value> [AND ...]]    (ops: < <= > >= = !=)\n"
+					<< "REGION <chrom> <first coord> <last coord> [+|-]\n"
+					<< "GO <term>\n"
+					<< "STATS\n"
+					<< "RELOAD\n"
+					<< "QUIT\n"
+					<< "uORF rows:  gene, rel_pos, start_pos, len, AUGCAI, cluster, prob_of_translation, sequence\n"
+					<< "fields:";
+		for( unsigned int i = 0; i < NUM_QUERY_FIELDS; i++ ) { results_oss << " " << QUERY_FIELDS[i].name; }
+		results_oss << "  (indexed:";
+		for( unsigned int i = 0; i < NUM_QUERY_FIELDS; i++ ) { if( QUERY_FIELDS[i].indexed == TRUE ) { results_oss << " " << QUERY_FIELDS[i].name; } }
+		results_oss << ")\n";
+		num_results = 9;
+	}
+	else if( command == "QUIT" )
+	{
+		*quit = TRUE;
+	}
+	else
+	{
+		error_msg = "unknown command '" + command + "' (try HELP)";
+	}
+
+
+	num_queries++;
+	total_query_time_us += chrono::duration_cast <chrono::microseconds>( chrono::steady_clock::now() - query_start ).count();
+
+	if( error_msg != "" ) { return "ERR " + error_msg + "\n"; }
+
+	return "OK " + get_str( num_results ) + "\n" + results_oss.str();
+}
+//------------------------------------------------------------------------------
+
+
+// Listen for clients on a Unix domain socket at 'path' (replacing any socket left behind by an earlier run)
+int TQuery_Daemon::start_socket_server( const string & path )
+{
+	#ifdef _WIN32
+		return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TQuery_Daemon::start_socket_server()': Local sockets are not supported on Windows (use stdin). ", __FILE__, __LINE__ );
+	#else
+		struct sockaddr_un socket_addr;
+		memset( &socket_addr, 0, sizeof( socket_addr ) );
+		socket_addr.sun_family = AF_UNIX;
+
+		if( path.size() >= sizeof( socket_addr.sun_path ) )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TQuery_Daemon::start_socket_server()': Socket path \"" + path + "\" is too long. ", __FILE__, __LINE__ );
+		}
+
+		strncpy( socket_addr.sun_path, path.c_str(), sizeof( socket_addr.sun_path ) - 1 );
+
+		listen_socket = socket( AF_UNIX, SOCK_STREAM, 0 );
+
+		if( listen_socket < 0 )
+		{
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, (string)"Error in 'TQuery_Daemon::start_socket_server()': Unable to create socket (" + strerror( errno ) + "). ", __FILE__, __LINE__ );
+		}
+
+		unlink( path.c_str() );
+
+		if( bind( listen_socket, (struct sockaddr *)&socket_addr, sizeof( socket_addr ) ) != 0 || listen( listen_socket, SOMAXCONN ) != 0 )
+		{
+			const int socket_errno = errno;
+
+			close( listen_socket );
+			listen_socket = -1;
+
+			return Errors.handle_error( PASS_UP_ONE_LEVEL, "Error in 'TQuery_Daemon::start_socket_server()': Unable to listen on \"" + path + "\" (" + strerror( socket_errno ) + "). ", __FILE__, __LINE__ );
+		}
+
+		socket_path = path;
+		accept_thread = thread( &TQuery_Daemon::accept_connections, this );
+
+		return SUCCESSFUL;
+	#endif
+}
+//------------------------------------------------------------------------------
+
+
+void TQuery_Daemon::accept_connections( void )
+{
+	#ifndef _WIN32
+		while( stop_requested == false )
+		{
+			const int connection_socket = accept( listen_socket, NULL, NULL );
+
+			if( connection_socket < 0 )
+			{
+				if( errno == EINTR || errno == ECONNABORTED ) { continue; }
+				break;		// The listening socket was shut down by 'stop()'
+			}
+
+			lock_guard <mutex> connection_lock( connection_mutex );
+
+			if( stop_requested == true ) { close( connection_socket ); break; }
+
+			// Join the threads of clients that have since disconnected
+			for( unsigned int i = 0; i < connection_threads.size(); )
+			{
+				if( find( finished_connection_threads.begin(), finished_connection_threads.end(), connection_threads[i].get_id() ) != finished_connection_threads.end() )
+				{
+					connection_threads[i].join();
+					connection_threads.erase( connection_threads.begin() + i );
+				}
+				else { i++; }
+			}
+
+			finished_connection_threads.clear();
+
+			connection_sockets.push_back( connection_socket );
+			connection_threads.push_back( thread( &TQuery_Daemon::serve_connection, this, connection_socket ) );
+		}
+	#endif
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Answer one client's queries until it quits or disconnects
+void TQuery_Daemon::serve_connection( const int connection_socket )
+{
+	#ifndef _WIN32
+		string pending_input = "";
+		char recv_buffer[QUERY_RECV_BUFFER_SIZE];
+		bool quit = FALSE;
+
+		while( quit == FALSE )
+		{
+			const ssize_t num_received = recv( connection_socket, recv_buffer, QUERY_RECV_BUFFER_SIZE, 0 );
+
+			if( num_received < 0 && errno == EINTR ) { continue; }
+			if( num_received <= 0 ) { break; }
+
+			pending_input.append( recv_buffer, num_received );
+
+			size_t line_end_pos;
+			string response = "";
+
+			while( quit == FALSE && ( line_end_pos = pending_input.find( '\n' ) ) != string::npos )
+			{
+				string query_line = pending_input.substr( 0, line_end_pos );
+				pending_input.erase( 0, line_end_pos + 1 );
+
+				if( query_line.size() > 0 && query_line[ query_line.size() - 1 ] == '\r' ) { query_line.erase( query_line.size() - 1 ); }
+
+				response += answer_query( query_line, &quit );
+			}
+
+			if( pending_input.size() > QUERY_MAX_LINE_LENGTH )
+			{
+				response += "ERR query too long\n";
+				quit = TRUE;
+			}
+
+			// Send every response to this batch of queries at once
+			for( size_t num_sent = 0; num_sent < response.size(); )
+			{
+				#ifdef MSG_NOSIGNAL
+					const ssize_t send_result = send( connection_socket, response.data() + num_sent, response.size() - num_sent, MSG_NOSIGNAL );
+				#else
+					const ssize_t send_result = send( connection_socket, response.data() + num_sent, response.size() - num_sent, 0 );
+				#endif
+
+				if( send_result < 0 && errno == EINTR ) { continue; }
+				if( send_result <= 0 ) { quit = TRUE; break; }
+
+				num_sent += send_result;
+			}
+		}
+
+		lock_guard <mutex> connection_lock( connection_mutex );
+
+		connection_sockets.erase( find( connection_sockets.begin(), connection_sockets.end(), connection_socket ) );
+		close( connection_socket );
+
+		finished_connection_threads.push_back( this_thread::get_id() );
+
+		connection_cond.notify_all();
+	#endif
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Answer queries from stdin until "QUIT" (or the end of input)
+void TQuery_Daemon::serve_stdin( void )
+{
+	string query_line;
+	bool quit = FALSE;
+
+	while( quit == FALSE && stop_requested == false && getline( cin, query_line ) )
+	{
+		if( query_line.size() > 0 && query_line[ query_line.size() - 1 ] == '\r' ) { query_line.erase( query_line.size() - 1 ); }
+
+		// The answer goes to the console only (not the program log), and is shown before the next query is read
+		Log_Backend.write( answer_query( query_line, &quit ), LOG_TO_CONSOLE_ONLY );
+		Log_Backend.flush();
+	}
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+// Stop accepting clients, disconnect those connected (joining their threads), and wait for any reload to finish
+void TQuery_Daemon::stop( void )
+{
+	stop_requested = true;
+
+	#ifndef _WIN32
+		if( listen_socket >= 0 )
+		{
+			shutdown( listen_socket, SHUT_RDWR );
+
+			if( accept_thread.joinable() ) { accept_thread.join(); }
+
+			close( listen_socket );
+			listen_socket = -1;
+
+			unlink( socket_path.c_str() );
+		}
+
+		unique_lock <mutex> connection_lock( connection_mutex );
+
+		for( unsigned int i = 0; i < connection_sockets.size(); i++ ) { shutdown( connection_sockets[i], SHUT_RDWR ); }
+
+		while( connection_sockets.empty() == false ) { connection_cond.wait( connection_lock ); }
+
+		vector <thread> finished_threads;
+		finished_threads.swap( connection_threads );
+		finished_connection_threads.clear();
+
+		connection_lock.unlock();
+
+		for( unsigned int i = 0; i < finished_threads.size(); i++ ) { finished_threads[i].join(); }
+	#endif
+
+	lock_guard <mutex> reload_lock( reload_mutex );
+
+	if( reload_thread.joinable() ) { reload_thread.join(); }
+
+	return;
+}
+//------------------------------------------------------------------------------
+
+
+TQuery_Daemon::~TQuery_Daemon( void )
+{
+	stop();
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+// Load the uORF database once, then answer queries from stdin (and, if 'QUERY_DAEMON_SOCKET_PATH' isn't empty, from
+//   local socket clients) until "QUIT" is read from stdin
+void run_query_daemon( void )
+{
+	TQuery_Daemon Query_Daemon;
+
+	if( Query_Daemon.load() )
+	{
+		Errors.handle_error( FATAL, "Error in 'run_query_daemon()': ", __FILE__, __LINE__ );
+	}
+
+	const string socket_path = QUERY_DAEMON_SOCKET_PATH;
+
+	if( socket_path != "" && Query_Daemon.start_socket_server( socket_path ) )
+	{
+		Errors.handle_error( NONFATAL, "Error in 'run_query_daemon()': Answering queries from stdin only. ", __FILE__, __LINE__ );
+	}
+
+	output_text_line( "Query daemon:  " + get_str( (unsigned int)Query_Daemon.get_snapshot()->uORFs.size() ) + " uORFs loaded; answering queries on stdin" +
+					  ( Query_Daemon.is_socket_server_running() == TRUE ? " and \"" + socket_path + "\"" : "" ) + " (type HELP for commands)" );
+
+	Query_Daemon.serve_stdin();
+	Query_Daemon.stop();
+
+	return;
+}
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
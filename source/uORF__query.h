@@ -0,0 +1,256 @@
+//==============================================================================
+// Project	   : uORF
+// Name        : uORF__query.h
+// Author      : Garin Newcomb
+// Email       : gpnewcomb@live.com
+// Version     : See "Revision History" below
+// Copyright   : Copyright 2014 University of Nebraska-Lincoln
+// Description : Header file declaring the query daemon, which loads the uORF
+//				 database once and answers queries about it until told to quit
+//==============================================================================
+//
+//  Revision History
+//      v0.0.0 - 2026/10/19 - Garin Newcomb
+//          Initial creation of file
+//
+//    	Appl Version at Last File Update::  v0.1.6 - 2026/10/19 - Garin Newcomb
+//      	[Note:  until program released, all files tracking with program revision level -- see "version.h" file]
+//
+//==============================================================================
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  Table of Contents -- Header (.h) File
+//      (Note: (*) indicates that the section is not present in this file)
+//
+//      A. Include Statements, Preprocessor Directives, and Related
+//      B. Type (and Member Function) Declarations and Definitions
+//     *C. Global Variable Declarations (including those in other files)
+//      D. Non-Member Function Declarations
+//     *E. Templated (Non-Member) Function Declarations
+//     *F. Inline (Non-Member) Function Declarations and Definitions
+//     *G. UNUSED Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef uORF__QUERY_H
+#define uORF__QUERY_H
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// A. Include Statements, Preprocessor Directives, and Related
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Standard libraries and related
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <unordered_map>
+
+// Project-specific header files:  definitions and related information
+#include "defs__general.h"
+
+// Project-specific header files:  support functions and related
+#include "support__intern.h"
+#include "support__bioinformatics.h"
+#include "support__file_io.h"
+#include "uORF__compile.h"
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// B. Type (and Member Function) Declarations and Definitions
+//
+////////////////////////////////////////////////////////////////////////////////
+
+//==============================================================================
+
+class TInterval_Node
+{
+	public:
+		unsigned int start;			// Half-open:  [start, end)
+		unsigned int end;
+		unsigned int max_end;		// Largest 'end' in the node's subtree
+		unsigned int id;
+
+		TInterval_Node( const unsigned int node_start, const unsigned int node_end, const unsigned int node_id ) :
+			start  ( node_start ),
+			end	   ( node_end   ),
+			max_end( node_end   ),
+			id	   ( node_id    )
+		{ }
+};
+//==============================================================================
+
+
+
+// Static interval tree, stored implicitly in an array sorted by start (node 'i' at level 'k' has the 2^(k+1) - 1 nodes
+//   centered on it as its subtree), so finding the intervals overlapping a range takes O(log n + number found)
+class TInterval_Index
+{
+	private:
+		std::vector <TInterval_Node> nodes;
+		int max_level;
+
+	public:
+		void add( const unsigned int first_coord, const unsigned int last_coord, const unsigned int id );
+		void build( void );
+		void find_overlapping( const unsigned int first_coord, const unsigned int last_coord, std::vector <unsigned int> * const ids ) const;
+
+		TInterval_Index( void ) : max_level( -1 ) { }
+};
+//==============================================================================
+
+
+
+// The uORFs sorted by one numeric attribute, so a condition on it selects a contiguous range (uORFs whose value is
+//   not a number are left out, since they meet no condition but '!=')
+class TAttribute_Index
+{
+	private:
+		std::vector <double> values;
+		std::vector <unsigned int> ids;
+
+	public:
+		void build( const std::vector <double> & values_by_id );
+		bool find_range( const std::string & cond_op, const double cond_value, unsigned int * const first_it, unsigned int * const last_it ) const;
+		unsigned int get_id( const unsigned int it ) const { return ids[it]; }
+		bool empty( void ) const { return ids.empty(); }
+};
+//==============================================================================
+
+
+
+// Everything one load of the database produced (the genome, the GO hierarchy, and the consolidated ORFs), along with
+//   the indexes used to answer queries.  Never modified once loaded, so any number of queries may read it at once
+class TQuery_Snapshot
+{
+	private:
+		// Not copyable (owns the genome)
+		TQuery_Snapshot( const TQuery_Snapshot & );
+		TQuery_Snapshot & operator=( const TQuery_Snapshot & );
+
+		void build_indexes( void );
+
+	public:
+		std::unique_ptr <TFasta_Content> S_Cerevisiae_Chrom;
+		std::vector <TGO_Annotation> All_GO_Annotations;
+		std::vector <TORF_Data> ORF_Data;
+
+		// Every ORF's uORFs, in ORF order; ORF 'i' has uORFs 'ORF_first_uORF[i]' through 'ORF_first_uORF[i + 1] - 1'
+		std::vector <TuORF_Data> uORFs;
+		std::vector <unsigned int> uORF_ORF_it;
+		std::vector <unsigned int> ORF_first_uORF;
+
+		// Secondary indexes:  by gene, GO term (inverted), position ('chrom_num * 2 + strand'), and numeric attribute
+		std::unordered_map <TSymbol_ID, unsigned int> ORF_it_by_gene;
+		std::unordered_map <TSymbol_ID, std::vector <unsigned int> > ORF_its_by_GO_term;		// Includes the terms' parents
+		std::vector <TInterval_Index> uORF_intervals;
+		std::vector <TAttribute_Index> uORF_attributes;										// One per query field (empty if not indexed)
+
+		double load_time_ms;
+		std::string load_finish_time;
+
+		int load( void );
+		std::string format_uORF_row( const unsigned int uORF_it ) const;
+
+		TQuery_Snapshot( void ) : load_time_ms( 0 ) { }
+};
+//==============================================================================
+
+
+
+// Answers queries (one per line) from stdin and, on POSIX systems, from clients of a local socket.  Each query reads
+//   whichever snapshot is current when it starts; 'RELOAD' builds a new snapshot in the background and swaps it in once
+//   complete, so queries are never held up by a reload (and a reload that fails leaves the old snapshot in place)
+class TQuery_Daemon
+{
+	private:
+		std::shared_ptr <const TQuery_Snapshot> snapshot;		// Only accessed through 'std::atomic_load()/atomic_store()'
+
+		std::atomic <bool> reload_in_progress;
+		std::atomic <unsigned int> num_reloads;
+		std::thread reload_thread;
+		std::mutex reload_mutex;
+
+		std::atomic <unsigned long long> num_queries;
+		std::atomic <unsigned long long> total_query_time_us;
+
+		std::atomic <bool> stop_requested;
+		int listen_socket;
+		std::string socket_path;
+		std::thread accept_thread;
+
+		std::mutex connection_mutex;
+		std::condition_variable connection_cond;
+		std::vector <int> connection_sockets;		// Clients currently connected (each served by a thread of its own)
+		std::vector <std::thread> connection_threads;						// Joined once finished, or by 'stop()'
+		std::vector <std::thread::id> finished_connection_threads;			// Finished, but not yet joined
+
+		// Not copyable (owns threads)
+		TQuery_Daemon( const TQuery_Daemon & );
+		TQuery_Daemon & operator=( const TQuery_Daemon & );
+
+		void reload( void );
+		void accept_connections( void );
+		void serve_connection( const int connection_socket );
+
+	public:
+		std::shared_ptr <const TQuery_Snapshot> get_snapshot( void ) const;
+
+		int  load( void );
+		bool start_reload( void );
+
+		std::string answer_query( const std::string & query_line, bool * const quit );
+
+		int  start_socket_server( const std::string & path );
+		bool is_socket_server_running( void ) const { return listen_socket >= 0; }
+		void serve_stdin( void );
+		void stop( void );
+
+		TQuery_Daemon( void ) :
+			reload_in_progress ( false ),
+			num_reloads		   ( 0 	   ),
+			num_queries		   ( 0 	   ),
+			total_query_time_us( 0 	   ),
+			stop_requested	   ( false ),
+			listen_socket	   ( -1    )
+		{ }
+		~TQuery_Daemon( void );
+};
+//==============================================================================
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// D. Non-Member Function Declarations
+//
+////////////////////////////////////////////////////////////////////////////////
+
+void run_query_daemon( void );
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif  // uORF__QUERY_H